@@ -17,11 +17,18 @@ if(NOT CMAKE_BUILD_TYPE AND NOT CMAKE_CONFIGURATION_TYPES)
     "Debug" "Release" "MinSizeRel" "RelWithDebInfo")
 endif()
 
-# Target
-add_library(${LIBRARY_NAME} ${LIBRARY_TYPE} ${SOURCES} ${HEADERS})
+# Targets: asset library without OpenGL, full library linking the asset library
+add_library(${LIBRARY_NAME}_assets ${LIBRARY_TYPE} ${ASSETS_SOURCES})
+target_link_libraries(${LIBRARY_NAME}_assets ${CMAKE_THREAD_LIBS_INIT})
+set(LIBRARY_TARGETS ${LIBRARY_NAME}_assets)
+if(NOT SCG_ASSETS_ONLY)
+  add_library(${LIBRARY_NAME} ${LIBRARY_TYPE} ${SOURCES} ${HEADERS})
+  target_link_libraries(${LIBRARY_NAME} ${LIBRARY_NAME}_assets)
+  set(LIBRARY_TARGETS ${LIBRARY_TARGETS} ${LIBRARY_NAME})
+endif()
 
-# Install library
-install(TARGETS ${LIBRARY_NAME}
+# Install libraries
+install(TARGETS ${LIBRARY_TARGETS}
   EXPORT ${PROJECT_EXPORT}
   RUNTIME DESTINATION "${INSTALL_BIN_DIR}" COMPONENT bin
   LIBRARY DESTINATION "${INSTALL_LIB_DIR}" COMPONENT shlib
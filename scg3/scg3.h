@@ -158,6 +158,65 @@
  *
  * \section sec_release_notes Release Notes
  *
+ * Version 0.7 (in development)
+ *
+ * - add StaticBatch node merging static sub-trees into multi-draw indirect batches
+ *   (shader phong_batch_vert.glsl)
+ * - add pre-baked texture containers with gamma-correct mipmaps (TextureContainer,
+ *   TextureCoreFactory::bake2DTextureFile())
+ * - add TextureArrayBuilder packing textures into a Texture2DArrayCore, such that
+ *   StaticBatch merges shapes with different textures (shader texture2d_array_modulate.glsl)
+ * - add TextureStreamer streaming mipmap levels of StreamedTexture2DCore textures
+ *   under a GPU memory budget (worker thread, LRU eviction)
+ * - add ResourceCache sharing cores of the geometry, shader, and texture factories
+ *   (setResourceCache()), cameras share their internal cores
+ * - add ShaderBinaryCache storing linked program binaries on disk
+ *   (ShaderCoreFactory::setBinaryCache())
+ * - add shader variants with #include and #define preprocessing
+ *   (ShaderCoreFactory::createShaderVariant(), shaders phong_variant_*.glsl)
+ * - share compiled shader objects between programs of a ShaderCoreFactory,
+ *   reference-counted deletion by ShaderCore::clear()
+ * - add batch shader creation with parallel preprocessing and compilation
+ *   (ShaderCoreFactory::createShaders(), ShaderCore::initAsync()), optional warm-up draws
+ * - upload light data of all light scopes once per frame as a packed UBO, bound by range
+ *   (RenderState::uploadLights())
+ * - add clustered forward lighting for thousands of point and spot lights (LightCluster,
+ *   blinn_phong_clustered_lighting.glsl)
+ * - add material table storing many materials in one buffer texture, addressed by index per draw,
+ *   allowing StaticBatch to merge shapes of different materials (MaterialTable)
+ * - add cascaded shadow maps for directional and spot lights, caching the depth of static
+ *   casters per cascade (ShadowMap, shadow_depth_*.glsl, GeometryCore bounding boxes)
+ * - add DeferredRenderer with G-buffer geometry pass and light volumes
+ *   (shaders phong_variant_frag.glsl with GBUFFER = 1, deferred_lighting_*.glsl)
+ * - add headless mode rendering into a frame buffer object of an offscreen EGL context
+ *   (OGLConfig::headless, Viewer::renderFrames()), compile Glad sources in CMake build
+ * - add asynchronous frame capture by a ring of pixel pack buffers, writing frames to
+ *   PNG files, raw files, or pipes by a worker thread (FrameCapture, FrameSink)
+ * - add scg3_bench executable (CMake) rendering procedural stress scenes without vertical
+ *   synchronization (OGLConfig::swapInterval), reporting CPU and GPU frame time percentiles
+ * - add scg3_microbench executable (CMake) measuring scene graph hot paths with stubbed
+ *   OpenGL functions (ns and heap allocations per operation)
+ * - add frame profiler timing main loop phases, render passes, and tagged sub-trees on CPU
+ *   and GPU with rolling percentiles (FrameProfiler, ViewState::getFrameTimeStats())
+ * - add trace scopes for frames, render passes, asset loading, and shader compilation,
+ *   buffered per thread and exported as Chrome trace JSON (Tracer, SCG_TRACE_SCOPE(),
+ *   key 't' of KeyboardController, CMake option SCG_TRACING)
+ * - add per-frame render statistics (draw calls, triangles, shapes, program/texture/buffer
+ *   binds, uniform uploads, uploaded bytes) with history (RenderStats,
+ *   Renderer::getRenderStats(), Renderer::getRenderStatsHistory()), used by scg3_bench
+ * - add KHR_debug output replacing glGetError() polling in checkGLError(), with severity
+ *   filtering, performance warning counter, object labels from core names and node
+ *   meta-information, and debug groups around render passes (GLDebug, OGLConfig::debug)
+ * - add null OpenGL backend without context, counting calls and redundant state changes
+ *   per function and recording the call stream for golden-file comparison (NullGL,
+ *   OGLConfig::nullGL), used by scg3_microbench and scg3_bench --null-gl
+ * - add asset library scg3_assets without OpenGL (not including the scene graph): mesh data
+ *   and generation (MeshFactory), OBJ loading, matrix stack; GeometryCoreFactory creates
+ *   geometry cores from mesh data
+ * - add on-screen performance HUD with frame time graph, render statistics, and cache memory,
+ *   rasterized into a texture drawn by a single quad (PerformanceHUD,
+ *   ViewState::setHUDVisible(), key p of KeyboardController)
+ *
  * Version 0.6 (March 2019)
  *
  * - introduced in BIN-CG1 lecture of summer 2019
@@ -224,6 +283,7 @@
 #include <GLFW/glfw3.h>
 
 #include "src/Animation.h"
+#include "src/BatchTraverser.h"
 #include "src/BumpMapCore.h"
 #include "src/Camera.h"
 #include "src/CameraController.h"
@@ -232,34 +292,58 @@
 #include "src/Controller.h"
 #include "src/Core.h"
 #include "src/CubeMapCore.h"
+#include "src/DeferredRenderer.h"
+#include "src/FrameCapture.h"
+#include "src/FrameProfiler.h"
+#include "src/FrameSink.h"
 #include "src/GeometryCore.h"
 #include "src/GeometryCoreFactory.h"
+#include "src/GLDebug.h"
 #include "src/Group.h"
 #include "src/InfoTraverser.h"
 #include "src/KeyboardController.h"
 #include "src/Leaf.h"
 #include "src/Light.h"
+#include "src/LightCluster.h"
 #include "src/LightPosition.h"
 #include "src/MaterialCore.h"
+#include "src/MaterialTable.h"
+#include "src/MatrixStack.h"
+#include "src/MeshData.h"
+#include "src/MeshFactory.h"
 #include "src/MouseController.h"
 #include "src/Node.h"
+#include "src/NullGL.h"
 #include "src/OrthographicCamera.h"
+#include "src/PerformanceHUD.h"
 #include "src/PerspectiveCamera.h"
 #include "src/PreTraverser.h"
 #include "src/Renderer.h"
 #include "src/RenderState.h"
 #include "src/RenderTraverser.h"
+#include "src/ResourceCache.h"
+#include "src/scg_core_utilities.h"
 #include "src/scg_glm.h"
 #include "src/scg_internals.h"
 #include "src/scg_stb_image.h"
 #include "src/scg_utilities.h"
+#include "src/ShaderBinaryCache.h"
 #include "src/ShaderCore.h"
 #include "src/ShaderCoreFactory.h"
+#include "src/ShadowMap.h"
 #include "src/Shape.h"
 #include "src/StandardRenderer.h"
+#include "src/StaticBatch.h"
+#include "src/StreamedTexture2DCore.h"
+#include "src/Texture2DArrayCore.h"
 #include "src/Texture2DCore.h"
+#include "src/TextureArrayBuilder.h"
+#include "src/TextureContainer.h"
 #include "src/TextureCore.h"
 #include "src/TextureCoreFactory.h"
+#include "src/TextureLayerCore.h"
+#include "src/TextureStreamer.h"
+#include "src/Tracer.h"
 #include "src/TransformAnimation.h"
 #include "src/Transformation.h"
 #include "src/Traverser.h"
@@ -0,0 +1,161 @@
+/**
+ * \file blinn_phong_clustered_lighting.glsl
+ * \brief Blinn Phong lighting shader with clustered lights, provides external
+ *    function applyLighting() to fragment shader, to be used within LightCluster nodes.
+ */
+
+#version 150
+
+const int MAX_NUMBER_OF_LIGHTS = 10;
+
+// number of RGBA texels per cluster light (cf. LightCluster::LIGHT_TEXELS)
+const int LIGHT_TEXELS = 7;
+
+struct Light {
+  vec4 position;
+  vec4 ambient;
+  vec4 diffuse;
+  vec4 specular;
+  vec4 halfVector;      // used as vec3, expected as normalized
+  vec4 spotDirection;   // used as vec3, expected as normalized
+  float spotCosCutoff;
+  float spotExponent;   
+};
+
+layout(std140) uniform LightBlock {
+  Light lights[MAX_NUMBER_OF_LIGHTS];
+};
+
+struct Material {
+  vec4 emission;
+  vec4 ambient;
+  vec4 diffuse;
+  vec4 specular;
+  float shininess;  
+};
+
+layout(std140) uniform MaterialBlock {
+  Material material;
+};
+
+layout(std140) uniform LightClusterBlock {
+  ivec4 clusterGridSize;      // number of clusters in x, y, z, logarithmic depth slices
+  vec4 clusterViewport;       // viewport origin and size
+  vec4 clusterDepthParams;    // depth slice scale and bias
+};
+
+uniform samplerBuffer clusterLights;          // light parameters in eye coordinates
+uniform usamplerBuffer clusterLightIndices;   // light indices of all clusters
+uniform usamplerBuffer clusterGrid;           // offset and number of light indices per cluster
+
+uniform int nLights;
+uniform vec4 globalAmbientLight;
+
+
+// --- declarations ---
+
+
+void addLight(const in Light light, const in float range, const in vec3 ecVertex,
+    const in vec3 v, const in vec3 n, inout vec4 ambient, inout vec4 diffuse, inout vec4 specular);
+
+
+// --- implementations ---
+
+  
+void applyLighting(const in vec3 ecVertex, const in vec3 ecNormal, 
+    out vec4 emissionAmbientDiffuse, out vec4 specular) {
+  
+  // normalized view direction and surface normal
+  vec3 v = normalize(-ecVertex);
+  vec3 n = normalize(ecNormal);
+  
+  // add contributions of light sources of Light nodes
+  vec4 ambient = vec4(0., 0., 0., 0.);
+  vec4 diffuse = vec4(0., 0., 0., 0.);
+  specular = vec4(0., 0., 0., 0.);
+  for (int i = 0; i < nLights; ++i) {
+    addLight(lights[i], 0., ecVertex, v, n, ambient, diffuse, specular);
+  }
+  
+  // determine cluster from window coordinates and depth
+  ivec3 cluster;
+  cluster.xy = clamp(ivec2((gl_FragCoord.xy - clusterViewport.xy) / clusterViewport.zw
+      * vec2(clusterGridSize.xy)), ivec2(0), clusterGridSize.xy - 1);
+  float depth = -ecVertex.z;
+  float slice = (clusterGridSize.w != 0 ? log(max(depth, 1e-6)) : depth) 
+      * clusterDepthParams.x + clusterDepthParams.y;
+  cluster.z = clamp(int(floor(slice)), 0, clusterGridSize.z - 1);
+  uvec2 indexRange = texelFetch(clusterGrid, 
+      (cluster.z * clusterGridSize.y + cluster.y) * clusterGridSize.x + cluster.x).xy;
+  
+  // add contributions of cluster lights
+  for (uint k = 0u; k < indexRange.y; ++k) {
+    int offset = LIGHT_TEXELS * int(texelFetch(clusterLightIndices, int(indexRange.x + k)).x);
+    Light light;
+    light.position = texelFetch(clusterLights, offset);
+    light.ambient = texelFetch(clusterLights, offset + 1);
+    light.diffuse = texelFetch(clusterLights, offset + 2);
+    light.specular = texelFetch(clusterLights, offset + 3);
+    light.halfVector = texelFetch(clusterLights, offset + 4);
+    light.spotDirection = texelFetch(clusterLights, offset + 5);
+    vec4 params = texelFetch(clusterLights, offset + 6);
+    light.spotCosCutoff = params.x;
+    light.spotExponent = params.y;
+    addLight(light, params.z, ecVertex, v, n, ambient, diffuse, specular);
+  }
+  
+  // multiply with material parameters, add emission and global ambient light
+  emissionAmbientDiffuse = material.emission 
+      + material.ambient * (globalAmbientLight + ambient) 
+      + material.diffuse * diffuse;
+  specular *= material.specular;  
+}
+
+
+void addLight(const in Light light, const in float range, const in vec3 ecVertex,
+    const in vec3 v, const in vec3 n, inout vec4 ambient, inout vec4 diffuse, inout vec4 specular) {
+
+  vec3 s, h;
+  float attenuation = 1.;
+  if (light.position.w < 0.001) {
+    // directional light: normalized light source direction and half vector 
+    // (half vector is provided by application)
+    s = normalize(light.position.xyz);
+    h = light.halfVector.xyz;
+  }
+  else {
+    // point light or spotlight: normalized light source direction and half vector
+    vec3 l = light.position.xyz - ecVertex;
+    s = normalize(l);
+    h = normalize(v + s);
+    
+    // smooth falloff towards range (if any)
+    if (range > 0.) {
+      float d = length(l) / range;
+      attenuation = clamp(1. - d * d * d * d, 0., 1.);
+      attenuation *= attenuation;
+    }
+    
+    // check if surface point is inside spotlight cone, spot attenuation from center to edges
+    if (light.spotCosCutoff >= 0.001) {
+      float dirDotS = dot(light.spotDirection.xyz, -s);
+      if (dirDotS < light.spotCosCutoff) {
+        return;
+      }
+      attenuation *= pow(dirDotS, light.spotExponent);
+    }
+  }
+  
+  // ambient
+  ambient += attenuation * light.ambient;
+  
+  // diffuse
+  float sDotN = max(0., dot(s, n));
+  diffuse += attenuation * light.diffuse * sDotN;
+
+  // specular
+  float hDotN = dot(h, n);
+  if (hDotN > 0.) {
+    specular += attenuation * light.specular * pow(hDotN, material.shininess);
+  }
+}
@@ -1,11 +1,25 @@
 /**
  * \file blinn_phong_lighting.glsl
  * \brief Blinn Phong lighting shader, provides external function applyLighting()
- *    to vertex or fragment shader.
+ *    to vertex or fragment shader, may be included by shader variants.
+ *
+ * Defines: N_LIGHTS (number of lights), MATERIAL_TABLE (0 or 1, fragment shader only),
+ *   SHADOW (0 or 1, fragment shader only, requires ShadowMap node),
+ *   GBUFFER (0 or 1, fragment shader only, emission and ambient terms for DeferredRenderer)
  */
 
 #version 150
 
+#ifndef MATERIAL_TABLE
+#define MATERIAL_TABLE 0
+#endif
+#ifndef SHADOW
+#define SHADOW 0
+#endif
+#ifndef GBUFFER
+#define GBUFFER 0
+#endif
+
 const int MAX_NUMBER_OF_LIGHTS = 10;
 
 struct Light {
@@ -31,13 +45,41 @@ struct Material {
   float shininess;  
 };
 
+#if MATERIAL_TABLE
+// material fetched from material table (cf. MaterialTable) by index provided by
+// vertex shader, or taken from material block if index is negative
+const int MATERIAL_TEXELS = 5;
+layout(std140) uniform MaterialBlock {
+  Material blockMaterial;
+};
+uniform samplerBuffer materials;
+flat in int materialTableIndex;
+Material material;
+#else
 layout(std140) uniform MaterialBlock {
   Material material;
 };
+#endif
 
+// number of lights as compile-time constant if defined by shader variant
+#ifdef N_LIGHTS
+const int nLights = N_LIGHTS;
+#else
 uniform int nLights;
+#endif
 uniform vec4 globalAmbientLight;
 
+#if SHADOW
+// shadow map of one light (cf. ShadowMap), cascades stored as array layers
+const int MAX_SHADOW_CASCADES = 4;
+layout(std140) uniform ShadowBlock {
+  mat4 shadowMatrices[MAX_SHADOW_CASCADES];  // eye to shadow map coordinates
+  vec4 shadowCascadeEnds;                    // far depth of each cascade
+  ivec4 shadowParams;                        // number of cascades, light index
+};
+uniform sampler2DArrayShadow shadowMap;
+#endif
+
 
 // --- declarations ---
 
@@ -51,6 +93,10 @@ void pointLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const
 void spotLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const in vec3 n, 
     inout vec4 ambient, inout vec4 diffuse, inout vec4 specular);
 
+#if SHADOW
+float shadowVisibility(const in vec3 ecVertex);
+#endif
+
 
 // --- implementations ---
 
@@ -58,6 +104,21 @@ void spotLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const
 void applyLighting(const in vec3 ecVertex, const in vec3 ecNormal, 
     out vec4 emissionAmbientDiffuse, out vec4 specular) {
   
+#if MATERIAL_TABLE
+  // fetch material parameters
+  if (materialTableIndex >= 0) {
+    int offset = MATERIAL_TEXELS * materialTableIndex;
+    material.emission = texelFetch(materials, offset);
+    material.ambient = texelFetch(materials, offset + 1);
+    material.diffuse = texelFetch(materials, offset + 2);
+    material.specular = texelFetch(materials, offset + 3);
+    material.shininess = texelFetch(materials, offset + 4).x;
+  }
+  else {
+    material = blockMaterial;
+  }
+#endif
+
   // normalized view direction and surface normal
   vec3 v = normalize(-ecVertex);
   vec3 n = normalize(ecNormal);
@@ -67,6 +128,10 @@ void applyLighting(const in vec3 ecVertex, const in vec3 ecNormal,
   vec4 diffuse = vec4(0., 0., 0., 0.);
   specular = vec4(0., 0., 0., 0.);
   for (int i = 0; i < nLights; ++i) {
+#if SHADOW
+    vec4 diffuseOld = diffuse;
+    vec4 specularOld = specular;
+#endif
     if (lights[i].position.w < 0.001) {
       directionalLight(i, v, n, ambient, diffuse, specular);
     }
@@ -78,13 +143,28 @@ void applyLighting(const in vec3 ecVertex, const in vec3 ecNormal,
         spotLight(i, ecVertex, v, n, ambient, diffuse, specular);
       }
     }
+#if SHADOW
+    // attenuate diffuse and specular contributions of shadowed light
+    if (i == shadowParams.y) {
+      float visibility = shadowVisibility(ecVertex);
+      diffuse = mix(diffuseOld, diffuse, visibility);
+      specular = mix(specularOld, specular, visibility);
+    }
+#endif
   }
   
   // multiply with material parameters, add emission and global ambient light
+#if GBUFFER
+  // deferred shading: diffuse and specular terms are added by lighting pass
+  emissionAmbientDiffuse = material.emission 
+      + material.ambient * (globalAmbientLight + ambient);
+  specular = vec4(0., 0., 0., 0.);
+#else
   emissionAmbientDiffuse = material.emission 
       + material.ambient * (globalAmbientLight + ambient) 
       + material.diffuse * diffuse;
   specular *= material.specular;  
+#endif
 }
 
 
@@ -159,3 +239,35 @@ void spotLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const
     }
   }
 }
+
+
+#if SHADOW
+float shadowVisibility(const in vec3 ecVertex) {
+
+  // select cascade by depth, no shadow beyond last cascade
+  float depth = -ecVertex.z;
+  int cascade = 0;
+  while (cascade < shadowParams.x - 1 && depth > shadowCascadeEnds[cascade]) {
+    ++cascade;
+  }
+  if (depth > shadowCascadeEnds[cascade]) {
+    return 1.;
+  }
+
+  // transform into shadow map coordinates, no shadow outside of shadow map
+  vec4 coord = shadowMatrices[cascade] * vec4(ecVertex, 1.);
+  coord.xyz /= coord.w;
+  if (any(lessThan(coord.xyz, vec3(0.))) || any(greaterThan(coord.xyz, vec3(1.)))) {
+    return 1.;
+  }
+
+  // percentage closer filtering, 2x2 bilinear depth comparisons
+  vec2 texelSize = 1. / vec2(textureSize(shadowMap, 0).xy);
+  float visibility = 0.;
+  for (int j = 0; j < 4; ++j) {
+    vec2 offset = (vec2(j & 1, j >> 1) - 0.5) * texelSize;
+    visibility += texture(shadowMap, vec4(coord.xy + offset, float(cascade), coord.z));
+  }
+  return 0.25 * visibility;
+}
+#endif
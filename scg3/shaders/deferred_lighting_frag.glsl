@@ -0,0 +1,148 @@
+/**
+ * \file deferred_lighting_frag.glsl
+ * \brief Fragment shader of DeferredRenderer lighting passes, applies Blinn Phong lighting
+ *    to the G-buffer.
+ */
+
+#version 150
+
+// number of RGBA texels per light (cf. DeferredRenderer::LIGHT_TEXELS)
+const int LIGHT_TEXELS = 8;
+
+struct Light {
+  vec4 position;
+  vec4 ambient;
+  vec4 diffuse;
+  vec4 specular;
+  vec4 halfVector;      // used as vec3, expected as normalized
+  vec4 spotDirection;   // used as vec3, expected as normalized
+  float spotCosCutoff;
+  float spotExponent;   
+};
+
+uniform sampler2D gBufferBase;          // emission and ambient terms
+uniform sampler2D gBufferAlbedo;        // diffuse material color
+uniform sampler2D gBufferSpecular;      // specular material color
+uniform sampler2D gBufferNormal;        // normal in eye coordinates, shininess
+uniform sampler2D gBufferDepth;
+uniform samplerBuffer deferredLights;   // light parameters and rectangles in eye coordinates
+uniform mat4 inverseProjection;
+uniform vec4 viewport;                  // viewport origin and size
+uniform int nScreenLights;
+uniform int isLightVolume;
+
+flat in int lightIndex;
+
+out vec4 fragColor;
+
+
+// --- declarations ---
+
+
+void addLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const in vec3 n,
+    const in float shininess, inout vec4 diffuse, inout vec4 specular);
+
+
+// --- implementations ---
+
+
+void main(void) {
+  
+  // skip background
+  ivec2 texel = ivec2(gl_FragCoord.xy - viewport.xy);
+  float depth = texelFetch(gBufferDepth, texel, 0).r;
+  if (depth == 1.) {
+    discard;
+  }
+  
+  // reconstruct eye coordinates from depth
+  vec2 ndc = (gl_FragCoord.xy - viewport.xy) / viewport.zw * 2. - 1.;
+  vec4 ecVertex = inverseProjection * vec4(ndc, depth * 2. - 1., 1.);
+  ecVertex.xyz /= ecVertex.w;
+  
+  // normalized view direction and surface normal
+  vec4 normalShininess = texelFetch(gBufferNormal, texel, 0);
+  vec3 v = normalize(-ecVertex.xyz);
+  vec3 n = normalize(normalShininess.xyz);
+  
+  // add contributions of screen lights or of single light volume
+  vec4 diffuse = vec4(0., 0., 0., 0.);
+  vec4 specular = vec4(0., 0., 0., 0.);
+  if (isLightVolume != 0) {
+    addLight(lightIndex, ecVertex.xyz, v, n, normalShininess.w, diffuse, specular);
+  }
+  else {
+    for (int i = 0; i < nScreenLights; ++i) {
+      addLight(i, ecVertex.xyz, v, n, normalShininess.w, diffuse, specular);
+    }
+  }
+  
+  // multiply with material colors, add emission and ambient terms of full-screen pass
+  vec4 color = texelFetch(gBufferAlbedo, texel, 0) * diffuse
+      + texelFetch(gBufferSpecular, texel, 0) * specular;
+  if (isLightVolume != 0) {
+    fragColor = vec4(clamp(color.rgb, 0., 1.), 0.);
+  }
+  else {
+    vec4 base = texelFetch(gBufferBase, texel, 0);
+    fragColor = vec4(clamp(base.rgb + color.rgb, 0., 1.), base.a);
+  }
+}
+
+
+void addLight(const in int idx, const in vec3 ecVertex, const in vec3 v, const in vec3 n,
+    const in float shininess, inout vec4 diffuse, inout vec4 specular) {
+
+  int offset = LIGHT_TEXELS * idx;
+  Light light;
+  light.position = texelFetch(deferredLights, offset);
+  light.diffuse = texelFetch(deferredLights, offset + 2);
+  light.specular = texelFetch(deferredLights, offset + 3);
+  light.halfVector = texelFetch(deferredLights, offset + 4);
+  light.spotDirection = texelFetch(deferredLights, offset + 5);
+  vec4 params = texelFetch(deferredLights, offset + 6);
+  light.spotCosCutoff = params.x;
+  light.spotExponent = params.y;
+  float range = params.z;
+  
+  vec3 s, h;
+  float attenuation = 1.;
+  if (light.position.w < 0.001) {
+    // directional light: normalized light source direction and half vector 
+    // (half vector is provided by application)
+    s = normalize(light.position.xyz);
+    h = light.halfVector.xyz;
+  }
+  else {
+    // point light or spotlight: normalized light source direction and half vector
+    vec3 l = light.position.xyz - ecVertex;
+    s = normalize(l);
+    h = normalize(v + s);
+    
+    // smooth falloff towards range (if any)
+    if (range > 0.) {
+      float d = length(l) / range;
+      attenuation = clamp(1. - d * d * d * d, 0., 1.);
+      attenuation *= attenuation;
+    }
+    
+    // check if surface point is inside spotlight cone, spot attenuation from center to edges
+    if (light.spotCosCutoff >= 0.001) {
+      float dirDotS = dot(light.spotDirection.xyz, -s);
+      if (dirDotS < light.spotCosCutoff) {
+        return;
+      }
+      attenuation *= pow(dirDotS, light.spotExponent);
+    }
+  }
+  
+  // diffuse
+  float sDotN = max(0., dot(s, n));
+  diffuse += attenuation * light.diffuse * sDotN;
+
+  // specular
+  float hDotN = dot(h, n);
+  if (hDotN > 0.) {
+    specular += attenuation * light.specular * pow(hDotN, shininess);
+  }
+}
@@ -0,0 +1,35 @@
+/**
+ * \file deferred_lighting_vert.glsl
+ * \brief Vertex shader of DeferredRenderer lighting passes, draws a full-screen quad
+ *    or a screen-space rectangle per light volume (no vertex attributes).
+ */
+
+#version 150
+
+// number of RGBA texels per light (cf. DeferredRenderer::LIGHT_TEXELS)
+const int LIGHT_TEXELS = 8;
+
+uniform samplerBuffer deferredLights;   // light parameters and rectangles in eye coordinates
+uniform int isLightVolume;
+uniform int firstVolumeLight;
+
+flat out int lightIndex;
+
+
+void main() {
+  
+  // quad corner from vertex ID (triangle strip)
+  vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+  
+  if (isLightVolume != 0) {
+    // screen-space rectangle of light volume in normalized device coordinates
+    lightIndex = firstVolumeLight + gl_InstanceID;
+    vec4 rect = texelFetch(deferredLights, LIGHT_TEXELS * lightIndex + LIGHT_TEXELS - 1);
+    gl_Position = vec4(mix(rect.xy, rect.zw, corner), 0., 1.);
+  }
+  else {
+    // full-screen quad
+    lightIndex = -1;
+    gl_Position = vec4(corner * 2. - 1., 0., 1.);
+  }
+}
@@ -0,0 +1,73 @@
+/**
+ * \file phong_batch_vert.glsl
+ * \brief Phong vertex shader for static batches (cf. StaticBatch).
+ *
+ * The model matrix, normal matrix, and texture matrix of each draw command
+ * are fetched from the buffer texture drawData, indexed by the per-draw
+ * attribute vDrawIndex.
+ *
+ * Defines: MATERIAL_TABLE (0 or 1, passes material index of draw command
+ * to fragment shader, cf. MaterialTable)
+ */
+
+#version 150
+
+#ifndef MATERIAL_TABLE
+#define MATERIAL_TABLE 0
+#endif
+
+in vec4 vVertex;
+in vec3 vNormal;
+in vec4 vTexCoord0;
+in int vDrawIndex;
+
+uniform mat4 modelViewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat3 normalMatrix;
+uniform mat4 textureMatrix;
+uniform samplerBuffer drawData;
+#if MATERIAL_TABLE
+uniform int materialIndex;
+#endif
+
+smooth out vec3 ecVertex;
+smooth out vec3 ecNormal;
+smooth out vec4 texCoord0;
+#if MATERIAL_TABLE
+flat out int materialTableIndex;
+#endif
+
+// number of RGBA texels per draw command (cf. StaticBatch::DRAW_DATA_TEXELS)
+const int DRAW_DATA_TEXELS = 12;
+
+
+void main() {
+
+  // fetch model, normal, and texture matrices of current draw command
+  int offset = DRAW_DATA_TEXELS * vDrawIndex;
+  mat4 modelMatrix = mat4(texelFetch(drawData, offset),
+                          texelFetch(drawData, offset + 1),
+                          texelFetch(drawData, offset + 2),
+                          texelFetch(drawData, offset + 3));
+  mat3 modelNormalMatrix = mat3(texelFetch(drawData, offset + 4).xyz,
+                                texelFetch(drawData, offset + 5).xyz,
+                                texelFetch(drawData, offset + 6).xyz);
+  mat4 drawTextureMatrix = mat4(texelFetch(drawData, offset + 8),
+                                texelFetch(drawData, offset + 9),
+                                texelFetch(drawData, offset + 10),
+                                texelFetch(drawData, offset + 11));
+
+  // transform vertex position and normal into eye coordinates
+  vec4 ecVertex4 = modelViewMatrix * (modelMatrix * vVertex);
+  ecVertex = ecVertex4.xyz;
+  ecNormal = normalMatrix * (modelNormalMatrix * vNormal);
+
+  // set output values
+  gl_Position = projectionMatrix * ecVertex4;
+  texCoord0 = textureMatrix * (drawTextureMatrix * vTexCoord0);
+#if MATERIAL_TABLE
+  // material of draw command, or inherited material if negative
+  int drawMaterialIndex = int(texelFetch(drawData, offset + 7).x);
+  materialTableIndex = (drawMaterialIndex >= 0) ? drawMaterialIndex : materialIndex;
+#endif
+}
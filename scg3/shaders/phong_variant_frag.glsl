@@ -0,0 +1,98 @@
+/**
+ * \file phong_variant_frag.glsl
+ * \brief Phong fragment shader for shader variants (ShaderCoreFactory::createShaderVariant()),
+ *    includes Blinn Phong lighting.
+ *
+ * Defines: N_LIGHTS (number of lights), TEXTURE (0 or 1), BUMP (0 or 1),
+ *   MATERIAL_TABLE (0 or 1), SHADOW (0 or 1), GBUFFER (0 or 1)
+ *
+ * With GBUFFER = 1, the G-buffer of DeferredRenderer is written instead of the final color
+ * (SHADOW and color matrix are not supported).
+ */
+
+#version 150
+
+#ifndef TEXTURE
+#define TEXTURE 0
+#endif
+#ifndef BUMP
+#define BUMP 0
+#endif
+#ifndef GBUFFER
+#define GBUFFER 0
+#endif
+
+smooth in vec3 ecVertex;
+smooth in vec3 ecNormal;
+smooth in vec4 texCoord0;
+#if BUMP
+smooth in vec3 ecTangent;
+smooth in vec3 ecBinormal;
+#endif
+
+uniform mat4 colorMatrix;
+#if TEXTURE
+uniform sampler2D texture0;
+#endif
+#if BUMP
+uniform sampler2D texture1;   // normal map
+#endif
+
+out vec4 fragColor;
+#if GBUFFER
+out vec4 gAlbedo;
+out vec4 gSpecular;
+out vec4 gNormal;
+#endif
+
+
+// --- implementations ---
+
+
+#include "blinn_phong_lighting.glsl"
+
+
+void main(void) {
+  
+  // determine normal, from normal map in tangent space if bump mapping is enabled
+#if BUMP
+  vec3 tcNormal = texture(texture1, texCoord0.st).rgb * 2. - 1.;
+  vec3 n = mat3(normalize(ecTangent), normalize(ecBinormal), normalize(ecNormal)) * tcNormal;
+#else
+  vec3 n = ecNormal;
+#endif
+
+  // apply lighting model
+  vec4 emissionAmbientDiffuse, specular;
+  applyLighting(ecVertex, n, emissionAmbientDiffuse, specular);
+  
+#if GBUFFER
+  // write G-buffer: emission and ambient terms, diffuse and specular material colors,
+  // normal and shininess
+#if TEXTURE
+  vec4 texColor = texture(texture0, texCoord0.st);
+#else
+  vec4 texColor = vec4(1., 1., 1., 1.);
+#endif
+  fragColor = clamp(emissionAmbientDiffuse * texColor, 0., 1.);
+  gAlbedo = clamp(material.diffuse * texColor, 0., 1.);
+  gSpecular = clamp(material.specular, 0., 1.);
+  gNormal = vec4(normalize(n), material.shininess);
+#else
+
+  // apply texture and determine color
+#if TEXTURE
+  vec4 texColor = texture(texture0, texCoord0.st);
+  vec4 color = clamp(emissionAmbientDiffuse * texColor + specular, 0., 1.);
+#else
+  vec4 color = clamp(emissionAmbientDiffuse + specular, 0., 1.);
+#endif
+
+  // transform color by color matrix
+  vec4 transformedColor = colorMatrix * vec4(color.rgb, 1.);
+  transformedColor /= transformedColor.a;   // perspective division
+    
+  // set final fragment color
+  fragColor = clamp(vec4(transformedColor.rgb, color.a), 0., 1.);
+#endif
+}
@@ -0,0 +1,62 @@
+/**
+ * \file phong_variant_vert.glsl
+ * \brief Phong vertex shader for shader variants (ShaderCoreFactory::createShaderVariant()).
+ *
+ * Defines: BUMP (0 or 1), MATERIAL_TABLE (0 or 1)
+ */
+
+#version 150
+
+#ifndef BUMP
+#define BUMP 0
+#endif
+#ifndef MATERIAL_TABLE
+#define MATERIAL_TABLE 0
+#endif
+
+in vec4 vVertex;
+in vec3 vNormal;
+in vec4 vTexCoord0;
+#if BUMP
+in vec3 vTangent;
+in vec3 vBinormal;
+#endif
+
+uniform mat4 modelViewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat4 mvpMatrix;
+uniform mat3 normalMatrix;
+uniform mat4 textureMatrix;
+#if MATERIAL_TABLE
+uniform int materialIndex;
+#endif
+
+smooth out vec3 ecVertex;
+smooth out vec3 ecNormal;
+smooth out vec4 texCoord0;
+#if BUMP
+smooth out vec3 ecTangent;
+smooth out vec3 ecBinormal;
+#endif
+#if MATERIAL_TABLE
+flat out int materialTableIndex;
+#endif
+
+
+void main() {
+  
+  // transform vertex position and normal into eye coordinates 
+  ecVertex = (modelViewMatrix * vVertex).xyz;
+  ecNormal = normalMatrix * vNormal;
+#if BUMP
+  ecTangent = normalMatrix * vTangent;
+  ecBinormal = normalMatrix * vBinormal;
+#endif
+      
+  // set output values
+  gl_Position = mvpMatrix * vVertex;
+  texCoord0 = textureMatrix * vTexCoord0;
+#if MATERIAL_TABLE
+  materialTableIndex = materialIndex;
+#endif
+}
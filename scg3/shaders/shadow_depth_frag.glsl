@@ -0,0 +1,15 @@
+/**
+ * \file shadow_depth_frag.glsl
+ * \brief Depth-only fragment shader, used by ShadowMap to render shadow casters.
+ */
+
+#version 150
+
+
+// --- implementations ---
+
+
+void main(void) {
+  
+  // depth is written implicitly, no color output
+}
@@ -0,0 +1,17 @@
+/**
+ * \file shadow_depth_vert.glsl
+ * \brief Depth-only vertex shader, used by ShadowMap to render shadow casters.
+ */
+
+#version 150
+
+in vec4 vVertex;
+
+uniform mat4 mvpMatrix;
+
+
+void main() {
+  
+  // transform vertex position into light clip coordinates
+  gl_Position = mvpMatrix * vVertex;
+}
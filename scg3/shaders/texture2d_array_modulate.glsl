@@ -0,0 +1,19 @@
+/**
+ * \file texture2d_array_modulate.glsl
+ * \brief Determine fragment color with 2D array texture modulation,
+ *    provides external function applyTexture() to fragment shader.
+ *
+ * The layer is given by the r (third) texture coordinate, which is set
+ * by the texture matrix of a TextureLayerCore.
+ */
+
+#version 150
+
+uniform sampler2DArray texture0;
+
+
+vec4 applyTexture(const in vec4 texCoord, const in vec4 emissionAmbientDiffuse,
+    const in vec4 specular) {
+  vec4 texColor = texture(texture0, vec3(texCoord.st, floor(texCoord.p + 0.5)));
+  return clamp(emissionAmbientDiffuse * texColor + specular, 0., 1.);
+}
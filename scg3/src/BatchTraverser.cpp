@@ -0,0 +1,121 @@
+/**
+ * \file BatchTraverser.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include "BatchTraverser.h"
+#include "GeometryCore.h"
+#include "Group.h"
+#include "MaterialCore.h"
+#include "RenderState.h"
+#include "Shape.h"
+#include "TextureCore.h"
+#include "TextureLayerCore.h"
+#include "Transformation.h"
+
+namespace scg {
+
+
+BatchTraverser::BatchTraverser(RenderState* renderState)
+    : Traverser(renderState) {
+  stateStack_.push_back(CoreState());
+}
+
+
+BatchTraverser::~BatchTraverser() {
+}
+
+
+void BatchTraverser::clear() {
+  items_.clear();
+  stateStack_.clear();
+  stateStack_.push_back(CoreState());
+}
+
+
+const std::vector<BatchItem>& BatchTraverser::getItems() const {
+  return items_;
+}
+
+
+void BatchTraverser::visitShape(Shape* node) {
+  assert(!stateStack_.empty());
+  CoreState state = stateStack_.back();
+  for (auto core : node->getCores()) {
+    auto geometryCore = std::dynamic_pointer_cast<GeometryCore>(core);
+    if (geometryCore) {
+      BatchItem item = { geometryCore, state.material, state.texture,
+          renderState_->modelViewStack.getMatrix(), state.textureMatrix };
+      items_.push_back(item);
+    }
+    else {
+      std::vector<CoreSP> cores(1, core);
+      applyCores_(cores, state);
+    }
+  }
+}
+
+
+void BatchTraverser::visitGroup(Group* node) {
+  assert(!stateStack_.empty());
+  CoreState state = stateStack_.back();
+  applyCores_(node->getCores(), state);
+  stateStack_.push_back(state);
+}
+
+
+void BatchTraverser::visitPostGroup(Group* node) {
+  assert(stateStack_.size() > 1);
+  stateStack_.pop_back();
+}
+
+
+void BatchTraverser::visitTransformation(Transformation* node) {
+  node->render(renderState_);
+}
+
+
+void BatchTraverser::visitPostTransformation(Transformation* node) {
+  node->renderPost(renderState_);
+}
+
+
+void BatchTraverser::applyCores_(const std::vector<CoreSP>& cores, CoreState& state) {
+  for (auto core : cores) {
+    auto materialCore = std::dynamic_pointer_cast<MaterialCore>(core);
+    if (materialCore) {
+      state.material = materialCore;
+      continue;
+    }
+    auto textureCore = std::dynamic_pointer_cast<TextureCore>(core);
+    if (textureCore) {
+      // layer cores only select a layer of the inherited array texture
+      state.textureMatrix *= textureCore->getMatrix();
+      if (!std::dynamic_pointer_cast<TextureLayerCore>(textureCore)) {
+        state.texture = textureCore;
+      }
+    }
+  }
+}
+
+
+} /* namespace scg */
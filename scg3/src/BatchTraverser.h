@@ -0,0 +1,141 @@
+/**
+ * \file BatchTraverser.h
+ * \brief A traverser that collects shapes to be merged into a StaticBatch (visitor pattern).
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BATCHTRAVERSER_H_
+#define BATCHTRAVERSER_H_
+
+#include <vector>
+#include "scg_glm.h"
+#include "scg_internals.h"
+#include "Traverser.h"
+
+namespace scg {
+
+
+/**
+ * \brief Geometry core with its inherited material, texture, model matrix,
+ *   and texture matrix, collected by BatchTraverser.
+ */
+struct BatchItem {
+  GeometryCoreSP geometry;
+  MaterialCoreSP material;
+  TextureCoreSP texture;
+  glm::mat4 modelMatrix;
+  glm::mat4 textureMatrix;
+};
+
+
+/**
+ * \brief A traverser that collects shapes to be merged into a StaticBatch (visitor pattern).
+ *
+ * Transformations are accumulated in the model-view stack of the render state,
+ * material and texture cores of groups and shapes are inherited as during rendering.
+ * The texture matrices of all texture cores are accumulated per item, while
+ * TextureLayerCore nodes do not change the inherited texture object, such that
+ * shapes referring to different layers of an array texture share a batch.
+ * Shader and color cores are ignored, light and camera nodes are skipped, but their
+ * sub-trees are traversed.
+ */
+class BatchTraverser: public Traverser {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  BatchTraverser(RenderState* renderState);
+
+  /**
+   * Destructor.
+   */
+  virtual ~BatchTraverser();
+
+  /**
+   * Clear collected items.
+   */
+  void clear();
+
+  /**
+   * Get collected items in traversal order.
+   */
+  const std::vector<BatchItem>& getItems() const;
+
+  // leaf nodes
+
+  /**
+   * Visit Shape node: collect geometry cores.
+   */
+  virtual void visitShape(Shape* node);
+
+  // composite nodes
+
+  /**
+   * Visit Group node: apply material and texture cores.
+   */
+  virtual void visitGroup(Group* node);
+
+  /**
+   * Visit Group node after traversing sub-tree: restore material and texture.
+   */
+  virtual void visitPostGroup(Group* node);
+
+  /**
+   * Visit Transformation node: update model-view matrix of RenderState.
+   */
+  virtual void visitTransformation(Transformation* node);
+
+  /**
+   * Visit Transformation node after traversing sub-tree: restore model-view
+   * matrix of RenderState.
+   */
+  virtual void visitPostTransformation(Transformation* node);
+
+protected:
+
+  /**
+   * Material, texture, and texture matrix inherited from ancestor nodes.
+   */
+  struct CoreState {
+    CoreState() : textureMatrix(1.0f) {}
+    MaterialCoreSP material;
+    TextureCoreSP texture;
+    glm::mat4 textureMatrix;
+  };
+
+  /**
+   * Update core state by material and texture cores of a node.
+   */
+  void applyCores_(const std::vector<CoreSP>& cores, CoreState& state);
+
+protected:
+
+  std::vector<CoreState> stateStack_;
+  std::vector<BatchItem> items_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* BATCHTRAVERSER_H_ */
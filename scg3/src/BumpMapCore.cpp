@@ -22,6 +22,7 @@
  */
 
 #include "BumpMapCore.h"
+#include "RenderState.h"
 #include "scg_utilities.h"
 
 namespace scg {
@@ -86,6 +87,7 @@ void BumpMapCore::render(RenderState* renderState) {
     // bind texture
     assert(glIsTexture(tex_));
     glBindTexture(GL_TEXTURE_2D, tex_);
+    ++renderState->stats.nTextureBinds;
   }
 
   // save normal map binding
@@ -96,6 +98,7 @@ void BumpMapCore::render(RenderState* renderState) {
   assert(glIsTexture(texNormal_));
   glBindTexture(GL_TEXTURE_2D, texNormal_);
   glActiveTexture(GL_TEXTURE0);
+  ++renderState->stats.nTextureBinds;
 
   assert(!checkGLError());
 }
@@ -25,6 +25,7 @@
 #include "GeometryCore.h"
 #include "GeometryCoreFactory.h"
 #include "RenderState.h"
+#include "ResourceCache.h"
 #include "ShaderCore.h"
 #include "ShaderCoreFactory.h"
 #include "Traverser.h"
@@ -38,11 +39,8 @@ Camera::Camera()
   // initialize direction vectors (viewDir_, upDir_, rightDir_, centerPt_) and transformation matrix (matrix_)
   update_();
 
-  // create coordinate axes
-  ShaderCoreFactory shaderFactory;
-  cores_.push_back(shaderFactory.createColorShader());    // cores_[0]: color shader
-  GeometryCoreFactory geometryFactory;
-  cores_.push_back(geometryFactory.createXYZAxes(0.1f));  // cores_[1]: center point geometry
+  // note: coordinate axes for drawing the center point are created on first use in render(),
+  // such that cameras can be created without OpenGL context
 }
 
 
@@ -205,6 +203,15 @@ void Camera::render(RenderState* renderState) {
 
   // if enabled, render xyz coordinate axes at center point
   if (isDrawCenter_) {
+    if (cores_.size() < 2) {
+      // create coordinate axes, shared by all cameras
+      ShaderCoreFactory shaderFactory;
+      shaderFactory.setResourceCache(ResourceCache::getDefault());
+      cores_.push_back(shaderFactory.createColorShader());    // cores_[0]: color shader
+      GeometryCoreFactory geometryFactory;
+      geometryFactory.setResourceCache(ResourceCache::getDefault());
+      cores_.push_back(geometryFactory.createXYZAxes(0.1f));  // cores_[1]: center point geometry
+    }
     assert(cores_.size() >= 2);
     assert(std::dynamic_pointer_cast<ShaderCore>(cores_[0]));
     cores_[0]->render(renderState);       // color shader
@@ -23,6 +23,9 @@
 
 #include <cassert>
 #include "Composite.h"
+#include "FrameProfiler.h"
+#include "GLDebug.h"
+#include "Traverser.h"
 
 namespace scg {
 
@@ -93,6 +96,18 @@ Composite* Composite::removeChild(Node* node) {
 void Composite::traverse(Traverser* traverser) {
   // check if node and its sub-tree are visible
   if (isVisible_) {
+    // time node and its sub-tree if tagged for profiling
+    FrameProfiler* profiler = isProfiled_ ? traverser->getFrameProfiler() : nullptr;
+    if (profiler) {
+      profiler->beginNode(this);
+    }
+
+    // enclose node and its sub-tree in debug group if labeled
+    bool isDebugGroup = isLabeled_ && GLDebug::isActive();
+    if (isDebugGroup) {
+      GLDebug::pushGroup(getMetaInfo(GLDebug::META_INFO_KEY).c_str());
+    }
+
     // process node
     accept(traverser);
 
@@ -103,6 +118,13 @@ void Composite::traverse(Traverser* traverser) {
 
     // post-process node
     acceptPost(traverser);
+
+    if (isDebugGroup) {
+      GLDebug::popGroup();
+    }
+    if (profiler) {
+      profiler->endScope();
+    }
   }
 
   // recursively traverse siblings (if any)
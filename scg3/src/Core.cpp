@@ -39,4 +39,9 @@ void Core::renderPost(RenderState* renderState) {
 }
 
 
+void Core::setDebugLabel(const std::string& label) {
+  // do nothing by default
+}
+
+
 } /* namespace scg */
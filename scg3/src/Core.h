@@ -25,6 +25,8 @@
 #ifndef CORE_H_
 #define CORE_H_
 
+#include <string>
+
 namespace scg {
 
 
@@ -57,6 +59,12 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+  /**
+   * Label OpenGL objects of this core for GL debuggers (cf. GLDebug), if debug output
+   * is active. Does nothing by default.
+   */
+  virtual void setDebugLabel(const std::string& label);
+
 };
 
 
@@ -99,6 +99,8 @@ void CubeMapCore::render(RenderState* renderState) {
   viewMatrix[3] = glm::vec4(0.f, 0.f, 0.f, 1.f);
   glm::mat4 skyboxMatrix = renderState->projectionStack.getMatrix() * viewMatrix * renderState->getModelMatrix();
   renderState->getShader()->setUniformMatrix4fv("skyboxMatrix", 1, glm::value_ptr(skyboxMatrix));
+  ++renderState->stats.nTextureBinds;
+  renderState->stats.nUniformUploads += 2;
 
   assert(!checkGLError());
 }
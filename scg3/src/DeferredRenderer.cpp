@@ -0,0 +1,405 @@
+/**
+ * \file DeferredRenderer.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include "Camera.h"
+#include "DeferredRenderer.h"
+#include "FrameProfiler.h"
+#include "GLDebug.h"
+#include "Light.h"
+#include "Node.h"
+#include "PreTraverser.h"
+#include "RenderState.h"
+#include "RenderTraverser.h"
+#include "ShaderCore.h"
+#include "Tracer.h"
+#include "Viewer.h"
+#include "scg_glm.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+namespace {
+
+// G-buffer samplers, in order of DeferredRenderer::tex_
+const OGLSampler* const GBUFFER_SAMPLERS[5] = {
+    &OGLConstants::G_BUFFER_BASE, &OGLConstants::G_BUFFER_ALBEDO,
+    &OGLConstants::G_BUFFER_SPECULAR, &OGLConstants::G_BUFFER_NORMAL,
+    &OGLConstants::G_BUFFER_DEPTH };
+
+// G-buffer color formats, in order of DeferredRenderer::tex_
+const GLenum GBUFFER_FORMATS[4] = { GL_RGBA8, GL_RGBA8, GL_RGBA8, GL_RGBA16F };
+
+// minimum clip coordinate w of bounding box corners in front of the eye
+const float MIN_CLIP_W = 1e-4f;
+
+}
+
+
+DeferredRenderer::DeferredRenderer()
+    : nScreenLights_(0), nVolumeLights_(0), width_(0), height_(0), fbo_(0), tex_(),
+      lightTBO_(0), lightTex_(0), vao_(0), maxTexels_(0) {
+}
+
+
+DeferredRenderer::~DeferredRenderer() {
+  if (isGLContextActive()) {
+    clearGBuffer_();
+  }
+}
+
+
+DeferredRendererSP DeferredRenderer::create() {
+  return std::make_shared<DeferredRenderer>();
+}
+
+
+DeferredRenderer* DeferredRenderer::setLightingShader(ShaderCoreSP lightingShader) {
+  lightingShader_ = lightingShader;
+  return this;
+}
+
+
+DeferredRenderer* DeferredRenderer::addLight(LightSP light, float range) {
+  assert(light);
+  assert(range >= 0.f);
+  lights_.push_back(light);
+  ranges_.push_back(range);
+  return this;
+}
+
+
+DeferredRenderer* DeferredRenderer::clearLights() {
+  lights_.clear();
+  ranges_.clear();
+  return this;
+}
+
+
+int DeferredRenderer::getNScreenLights() const {
+  return nScreenLights_;
+}
+
+
+int DeferredRenderer::getNVolumeLights() const {
+  return nVolumeLights_;
+}
+
+
+void DeferredRenderer::render() {
+  assert(viewer_);
+  assert(scene_);
+  assert(camera_);
+  assert(lightingShader_);
+
+  // check if camera projection has to be updated
+  if (viewer_->isWindowResized()) {
+    camera_->updateProjection();
+  }
+
+  // save projection and modelview matrices, set modelview matrix to identity
+  renderState_->projectionStack.pushMatrix();
+  renderState_->modelViewStack.pushMatrix();
+  renderState_->modelViewStack.setIdentity();
+
+  // pass 1: save camera projection and view transformation, collect lights
+  {
+    FrameProfiler::Scope scope(frameProfiler_, FrameProfiler::PRE_PASS);
+    SCG_TRACE_SCOPE("pre-pass traversal");
+    SCG_GL_DEBUG_GROUP("pre-pass traversal");
+    scene_->traverse(preTraverser_.get());
+
+    // upload lights of all scopes at once
+    renderState_->uploadLights();
+  }
+
+  // apply projection and view transformation as determined in previous frame
+  renderState_->applyProjectionViewTransform();
+
+  // G-buffer and lighting passes are timed as render pass
+  FrameProfiler::Scope scope(frameProfiler_, FrameProfiler::RENDER_PASS);
+
+  // adjust G-buffer to viewport
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  if (fbo_ == 0 || viewport[2] != width_ || viewport[3] != height_) {
+    createGBuffer_(viewport[2], viewport[3]);
+  }
+
+  // pass 2: render scene into G-buffer
+  GLint drawFboOld;
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFboOld);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo_);
+  glViewport(0, 0, width_, height_);
+  const GLfloat clearColor[4] = { 0.f, 0.f, 0.f, 0.f };
+  const GLfloat clearDepth = 1.f;
+  for (GLint i = 0; i < 4; ++i) {
+    glClearBufferfv(GL_COLOR, i, clearColor);
+  }
+  glClearBufferfv(GL_DEPTH, 0, &clearDepth);
+  {
+    SCG_TRACE_SCOPE("G-buffer traversal");
+    SCG_GL_DEBUG_GROUP("G-buffer traversal");
+    scene_->traverse(renderTraverser_.get());
+  }
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFboOld);
+  glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+  // upload lights in eye coordinates
+  SCG_TRACE_SCOPE("lighting pass");
+  SCG_GL_DEBUG_GROUP("lighting pass");
+  packLights_();
+  if ((nScreenLights_ + nVolumeLights_) * LIGHT_TEXELS > maxTexels_) {
+    throw std::runtime_error("Number of lights exceeds maximum buffer texture size"
+        " [DeferredRenderer::render()]");
+  }
+  glBindBuffer(GL_TEXTURE_BUFFER, lightTBO_);
+  glBufferData(GL_TEXTURE_BUFFER, lightData_.size() * sizeof(float), lightData_.data(),
+      GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  renderState_->stats.nUploadedBytes += static_cast<long>(lightData_.size() * sizeof(float));
+
+  // bind G-buffer and light textures
+  for (int i = 0; i < 5; ++i) {
+    glActiveTexture(GL_TEXTURE0 + GBUFFER_SAMPLERS[i]->texUnit);
+    glBindTexture(GL_TEXTURE_2D, tex_[i]);
+  }
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DEFERRED_LIGHTS.texUnit);
+  glBindTexture(GL_TEXTURE_BUFFER, lightTex_);
+  glActiveTexture(GL_TEXTURE0);
+  renderState_->stats.nTextureBinds += 6;
+
+  // save state, disable depth test
+  GLboolean isDepthTestOld = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean isBlendOld = glIsEnabled(GL_BLEND);
+  GLint blendFuncOld[4];
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blendFuncOld[0]);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blendFuncOld[1]);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendFuncOld[2]);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blendFuncOld[3]);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+
+  // set lighting shader uniforms
+  lightingShader_->render(renderState_.get());
+  glm::mat4 inverseProjection = glm::inverse(renderState_->getProjection());
+  const GLfloat viewportf[4] = {
+      static_cast<GLfloat>(viewport[0]), static_cast<GLfloat>(viewport[1]),
+      static_cast<GLfloat>(viewport[2]), static_cast<GLfloat>(viewport[3]) };
+  lightingShader_->setUniformMatrix4fv("inverseProjection", 1, glm::value_ptr(inverseProjection));
+  lightingShader_->setUniform4fv("viewport", 1, viewportf);
+  lightingShader_->setUniform1i("nScreenLights", nScreenLights_);
+  lightingShader_->setUniform1i("firstVolumeLight", nScreenLights_);
+  glBindVertexArray(vao_);
+
+  // pass 3: base color and screen lights (full-screen quad)
+  lightingShader_->setUniform1i("isLightVolume", 0);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+  ++renderState_->stats.nDrawCalls;
+  renderState_->stats.addPrimitives(GL_TRIANGLE_STRIP, 4);
+  renderState_->stats.nUniformUploads += 5;
+
+  // pass 4: light volumes (one screen-space rectangle per light), additive blending
+  if (nVolumeLights_ > 0) {
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    lightingShader_->setUniform1i("isLightVolume", 1);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, nVolumeLights_);
+    ++renderState_->stats.nDrawCalls;
+    ++renderState_->stats.nUniformUploads;
+    renderState_->stats.nVertices += 4 * nVolumeLights_;
+    renderState_->stats.nTriangles += 2 * nVolumeLights_;
+  }
+
+  // restore state
+  glBindVertexArray(0);
+  lightingShader_->renderPost(renderState_.get());
+  glBlendFuncSeparate(blendFuncOld[0], blendFuncOld[1], blendFuncOld[2], blendFuncOld[3]);
+  if (isBlendOld) {
+    glEnable(GL_BLEND);
+  }
+  else {
+    glDisable(GL_BLEND);
+  }
+  if (isDepthTestOld) {
+    glEnable(GL_DEPTH_TEST);
+  }
+
+  // restore projection and modelview matrices
+  renderState_->modelViewStack.popMatrix();
+  renderState_->projectionStack.popMatrix();
+
+  assert(!checkGLError());
+}
+
+
+void DeferredRenderer::packLights_() {
+  const glm::mat4& viewTransform = renderState_->getViewTransform();
+  const glm::mat4& projection = renderState_->getProjection();
+  const size_t lightFloats = 4 * LIGHT_TEXELS;
+  static_assert(4 * (LIGHT_TEXELS - 1) * sizeof(float) == Light::BUFFER_SIZE,
+      "light texels do not match light buffer size");
+
+  // screen lights: lights of Light nodes, directional lights, lights with unlimited range
+  renderState_->getUploadedLights(sceneLights_);
+  lightData_.assign((sceneLights_.size() + lights_.size() + 1) * lightFloats, 0.f);
+  float* data = lightData_.data();
+  for (auto light : sceneLights_) {
+    light->writeBuffer(reinterpret_cast<GLubyte*>(data), viewTransform);
+    data += lightFloats;
+  }
+  for (size_t i = 0; i < lights_.size(); ++i) {
+    if (ranges_[i] <= 0.f || lights_[i]->getPosition().w < 0.001f) {
+      lights_[i]->writeBuffer(reinterpret_cast<GLubyte*>(data), viewTransform);
+      data += lightFloats;
+    }
+  }
+  nScreenLights_ = static_cast<int>((data - lightData_.data()) / lightFloats);
+
+  // light volumes: screen-space rectangles of bounding boxes, culled if outside
+  nVolumeLights_ = 0;
+  for (size_t i = 0; i < lights_.size(); ++i) {
+    if (ranges_[i] <= 0.f || lights_[i]->getPosition().w < 0.001f) {
+      continue;
+    }
+    lights_[i]->writeBuffer(reinterpret_cast<GLubyte*>(data), viewTransform);
+    const float range = ranges_[i];
+    data[lightFloats - 6] = range;
+    glm::vec4 rect(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+        -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    bool isBehindEye = false;
+    for (int corner = 0; corner < 8; ++corner) {
+      glm::vec4 clip = projection * glm::vec4(
+          data[0] + ((corner & 1) ? range : -range),
+          data[1] + ((corner & 2) ? range : -range),
+          data[2] + ((corner & 4) ? range : -range), 1.f);
+      isBehindEye |= (clip.w <= MIN_CLIP_W);
+      float invW = 1.f / std::max(clip.w, MIN_CLIP_W);
+      rect.x = std::min(rect.x, clip.x * invW);
+      rect.y = std::min(rect.y, clip.y * invW);
+      rect.z = std::max(rect.z, clip.x * invW);
+      rect.w = std::max(rect.w, clip.y * invW);
+    }
+    if (data[2] - range > 0.f) {
+      continue;   // completely behind the eye
+    }
+    if (isBehindEye) {
+      rect = glm::vec4(-1.f, -1.f, 1.f, 1.f);
+    }
+    else if (rect.z < -1.f || rect.x > 1.f || rect.w < -1.f || rect.y > 1.f) {
+      continue;   // outside of view frustum
+    }
+    rect = glm::clamp(rect, -1.f, 1.f);
+    memcpy(data + lightFloats - 4, glm::value_ptr(rect), 4 * sizeof(float));
+    data += lightFloats;
+    ++nVolumeLights_;
+  }
+  lightData_.resize(std::max(nScreenLights_ + nVolumeLights_, 1) * lightFloats);
+}
+
+
+void DeferredRenderer::createGBuffer_(GLsizei width, GLsizei height) {
+  clearGBuffer_();
+  width_ = width;
+  height_ = height;
+
+  // color and depth textures, nearest neighbor sampling
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::G_BUFFER_BASE.texUnit);
+  GLint texOld;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texOld);
+  glGenTextures(5, tex_);
+  for (int i = 0; i < 5; ++i) {
+    glBindTexture(GL_TEXTURE_2D, tex_[i]);
+    if (i < 4) {
+      glTexImage2D(GL_TEXTURE_2D, 0, GBUFFER_FORMATS[i], width_, height_, 0, GL_RGBA,
+          GL_UNSIGNED_BYTE, nullptr);
+    }
+    else {
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, width_, height_, 0,
+          GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  }
+  glBindTexture(GL_TEXTURE_2D, texOld);
+  glActiveTexture(GL_TEXTURE0);
+
+  // framebuffer with four color attachments
+  GLint drawFboOld, readFboOld;
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFboOld);
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFboOld);
+  glGenFramebuffers(1, &fbo_);
+  glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+  const GLenum drawBuffers[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1,
+      GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
+  for (int i = 0; i < 4; ++i) {
+    glFramebufferTexture2D(GL_FRAMEBUFFER, drawBuffers[i], GL_TEXTURE_2D, tex_[i], 0);
+  }
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, tex_[4], 0);
+  glDrawBuffers(4, drawBuffers);
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFboOld);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, readFboOld);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    throw std::runtime_error("G-buffer is incomplete [DeferredRenderer::createGBuffer_()]");
+  }
+
+  // light buffer texture, empty vertex array
+  glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels_);
+  glGenBuffers(1, &lightTBO_);
+  glBindBuffer(GL_TEXTURE_BUFFER, lightTBO_);
+  glBufferData(GL_TEXTURE_BUFFER, 16, nullptr, GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DEFERRED_LIGHTS.texUnit);
+  glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld);
+  glGenTextures(1, &lightTex_);
+  glBindTexture(GL_TEXTURE_BUFFER, lightTex_);
+  glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, lightTBO_);
+  glBindTexture(GL_TEXTURE_BUFFER, texOld);
+  glActiveTexture(GL_TEXTURE0);
+  glGenVertexArrays(1, &vao_);
+
+  assert(!checkGLError());
+}
+
+
+void DeferredRenderer::clearGBuffer_() {
+  if (fbo_ != 0) {
+    glDeleteFramebuffers(1, &fbo_);
+    glDeleteTextures(5, tex_);
+    glDeleteBuffers(1, &lightTBO_);
+    glDeleteTextures(1, &lightTex_);
+    glDeleteVertexArrays(1, &vao_);
+    fbo_ = lightTBO_ = lightTex_ = vao_ = 0;
+  }
+}
+
+
+} /* namespace scg */
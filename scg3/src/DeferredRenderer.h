@@ -0,0 +1,163 @@
+/**
+ * \file DeferredRenderer.h
+ * \brief A renderer that uses deferred shading, i.e., a geometry pass into a G-buffer followed by lighting passes.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEFERREDRENDERER_H_
+#define DEFERREDRENDERER_H_
+
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "StandardRenderer.h"
+
+namespace scg {
+
+
+/**
+ * \brief A renderer that uses deferred shading, i.e., a geometry pass into a G-buffer
+ *    followed by lighting passes.
+ *
+ * The scene is rendered by the traversers of StandardRenderer into a compact G-buffer,
+ * using shaders that write the following fragment outputs (e.g., shader variants with
+ * GBUFFER = 1, cf. phong_variant_frag.glsl):
+ * - OGLConstants::FRAG_COLOR (RGBA8): emission and ambient terms, modulated by texture
+ * - OGLConstants::G_ALBEDO (RGBA8): diffuse material color, modulated by texture
+ * - OGLConstants::G_SPECULAR (RGBA8): specular material color
+ * - OGLConstants::G_NORMAL (RGBA16F): normal in eye coordinates, shininess
+ * - depth (32-bit float), from which the eye coordinates are reconstructed
+ *
+ * The diffuse and specular contributions are then accumulated into the current
+ * frame buffer by the lighting shader (cf. setLightingShader(), deferred_lighting_vert.glsl,
+ * deferred_lighting_frag.glsl), which reads the light parameters from the buffer texture
+ * OGLConstants::DEFERRED_LIGHTS (cf. LightCluster for the layout):
+ * - a full-screen pass for all lights of Light nodes collected by the PreTraverser
+ *   and all lights with unlimited range
+ * - one screen-space rectangle per light with limited range (light volume), added
+ *   by additive blending, such that the cost of a light is proportional to its
+ *   screen area rather than to the scene's overdraw
+ *
+ * In contrast to forward rendering, the lights of Light nodes are applied to the whole
+ * scene, independent of their scopes. Light nodes contribute ambient light via the
+ * geometry pass, while the ambient intensities of lights added by addLight() are ignored.
+ * The color matrix is not applied and transparency is not supported.
+ */
+class DeferredRenderer: public StandardRenderer {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  DeferredRenderer();
+
+  /**
+   * Destructor.
+   */
+  virtual ~DeferredRenderer();
+
+  /**
+   * Create shared pointer.
+   */
+  static DeferredRendererSP create();
+
+  /**
+   * Set shader of lighting passes (cf. deferred_lighting_vert.glsl, deferred_lighting_frag.glsl).
+   */
+  DeferredRenderer* setLightingShader(ShaderCoreSP lightingShader);
+
+  /**
+   * Add light that is not part of the scene graph, i.e., its position is
+   * given in world coordinates. The light has to be initialized by Light::init().
+   *
+   * \param light light to be added
+   * \param range range of point or spot light, 0 for unlimited range
+   */
+  DeferredRenderer* addLight(LightSP light, float range = 0.f);
+
+  /**
+   * Remove all lights added by addLight().
+   */
+  DeferredRenderer* clearLights();
+
+  /**
+   * Get number of lights applied by the full-screen pass in the last frame.
+   */
+  int getNScreenLights() const;
+
+  /**
+   * Get number of light volumes rendered in the last frame (excluding culled lights).
+   */
+  int getNVolumeLights() const;
+
+  /**
+   * Render the scene, called by Viewer::startMainLoop().
+   */
+  virtual void render();
+
+public:
+
+  // number of RGBA texels per light in buffer texture: light parameters and range
+  // (cf. LightCluster::LIGHT_TEXELS), screen-space rectangle in normalized device coordinates
+  static const int LIGHT_TEXELS = 8;
+
+protected:
+
+  /**
+   * Pack light parameters and screen-space rectangles of all lights in eye coordinates,
+   * screen lights first, culled light volumes are skipped.
+   */
+  void packLights_();
+
+  /**
+   * Create G-buffer textures and frame buffer object of given size.
+   */
+  void createGBuffer_(GLsizei width, GLsizei height);
+
+  /**
+   * Delete OpenGL objects.
+   */
+  void clearGBuffer_();
+
+protected:
+
+  ShaderCoreSP lightingShader_;
+  std::vector<LightSP> lights_;
+  std::vector<float> ranges_;
+  std::vector<const Light*> sceneLights_;
+  std::vector<float> lightData_;
+  int nScreenLights_;
+  int nVolumeLights_;
+  GLsizei width_, height_;
+  GLuint fbo_;
+  GLuint tex_[5];               // base, albedo, specular, normal, depth
+  GLuint lightTBO_;
+  GLuint lightTex_;
+  GLuint vao_;                  // empty vertex array for attribute-less drawing
+  GLint maxTexels_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* DEFERREDRENDERER_H_ */
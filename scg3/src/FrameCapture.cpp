@@ -0,0 +1,316 @@
+/**
+ * \file FrameCapture.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include "FrameCapture.h"
+#include "scg_utilities.h"
+#include "Tracer.h"
+
+namespace scg {
+
+
+FrameCapture::FrameCapture()
+    : ringSize_(3), maxQueuedFrames_(8), next_(0), width_(0), height_(0), frameIndex_(0),
+      isBusy_(false), isStopped_(false), nCapturedFrames_(0), nDroppedFrames_(0),
+      nFailedFrames_(0), nReportedFailedFrames_(0),
+      totalLatency_(0.), maxLatency_(0.) {
+  worker_ = std::thread(&FrameCapture::run_, this);
+}
+
+
+FrameCapture::~FrameCapture() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  requestCondition_.notify_all();
+  worker_.join();
+  if (isGLContextActive()) {
+    deleteRing_();
+  }
+}
+
+
+FrameCaptureSP FrameCapture::create() {
+  return std::make_shared<FrameCapture>();
+}
+
+
+FrameCapture* FrameCapture::addSink(FrameSinkSP sink) {
+  assert(sink);
+  sinks_.push_back(sink);
+  return this;
+}
+
+
+FrameCapture* FrameCapture::setRingSize(int ringSize) {
+  assert(ringSize > 0);
+  ringSize_ = ringSize;
+  return this;
+}
+
+
+FrameCapture* FrameCapture::setMaxQueuedFrames(int maxQueuedFrames) {
+  assert(maxQueuedFrames > 0);
+  maxQueuedFrames_ = maxQueuedFrames;
+  return this;
+}
+
+
+void FrameCapture::capture() {
+  SCG_TRACE_SCOPE("frame capture");
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  if (viewport[2] <= 0 || viewport[3] <= 0) {
+    return;
+  }
+  if (viewport[2] != width_ || viewport[3] != height_
+      || static_cast<int>(ring_.size()) != ringSize_) {
+    allocateRing_(viewport[2], viewport[3]);
+  }
+
+  // retrieve signaled frames in order, starting with the oldest one
+  const int n = static_cast<int>(ring_.size());
+  for (int i = 0; i < n; ++i) {
+    Slot& slot = ring_[(next_ + i) % n];
+    if (!slot.fence) {
+      continue;
+    }
+    if (glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+      break;
+    }
+    retrieve_(slot);
+  }
+
+  // all buffers in flight: wait for the oldest one
+  Slot& slot = ring_[next_];
+  if (slot.fence) {
+    while (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000)
+        == GL_TIMEOUT_EXPIRED) {
+    }
+    retrieve_(slot);
+  }
+
+  // start asynchronous readback
+  slot.frame.index = frameIndex_++;
+  slot.frame.width = width_;
+  slot.frame.height = height_;
+  slot.frame.captureTime = getTime();
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+  glReadPixels(viewport[0], viewport[1], width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  next_ = (next_ + 1) % n;
+
+  assert(!checkGLError());
+}
+
+
+void FrameCapture::finish() {
+
+  // retrieve all frames in flight, oldest first
+  const int n = static_cast<int>(ring_.size());
+  for (int i = 0; i < n; ++i) {
+    Slot& slot = ring_[(next_ + i) % n];
+    if (slot.fence) {
+      while (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000)
+          == GL_TIMEOUT_EXPIRED) {
+      }
+      retrieve_(slot);
+    }
+  }
+
+  // wait for worker thread
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return frames_.empty() && !isBusy_; });
+    if (nFailedFrames_ > nReportedFailedFrames_) {
+      std::cerr << "Frame capture: " << nFailedFrames_ - nReportedFailedFrames_
+          << " frame(s) failed, last error: " << lastError_ << std::endl;
+      nReportedFailedFrames_ = nFailedFrames_;
+    }
+  }
+  for (auto sink : sinks_) {
+    sink->flush();
+  }
+}
+
+
+long FrameCapture::getNCapturedFrames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return nCapturedFrames_;
+}
+
+
+long FrameCapture::getNDroppedFrames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return nDroppedFrames_;
+}
+
+
+long FrameCapture::getNFailedFrames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return nFailedFrames_;
+}
+
+
+std::string FrameCapture::getLastError() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lastError_;
+}
+
+
+double FrameCapture::getAverageLatency() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return (nCapturedFrames_ > 0) ? 1000. * totalLatency_ / nCapturedFrames_ : 0.;
+}
+
+
+double FrameCapture::getMaxLatency() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return 1000. * maxLatency_;
+}
+
+
+void FrameCapture::allocateRing_(int width, int height) {
+  finish();
+  deleteRing_();
+  width_ = width;
+  height_ = height;
+  next_ = 0;
+  ring_.resize(ringSize_);
+  for (auto& slot : ring_) {
+    glGenBuffers(1, &slot.buffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, 4 * width * height, nullptr, GL_STREAM_READ);
+    slot.fence = nullptr;
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  assert(!checkGLError());
+}
+
+
+void FrameCapture::deleteRing_() {
+  for (auto& slot : ring_) {
+    if (slot.fence) {
+      glDeleteSync(slot.fence);
+    }
+    glDeleteBuffers(1, &slot.buffer);
+  }
+  ring_.clear();
+}
+
+
+void FrameCapture::retrieve_(Slot& slot) {
+  glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+
+  // drop frame if worker thread cannot keep up
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int>(frames_.size()) >= maxQueuedFrames_) {
+      ++nDroppedFrames_;
+      return;
+    }
+  }
+
+  // copy pixels from mapped buffer
+  const size_t size = 4 * static_cast<size_t>(slot.frame.width) * slot.frame.height;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+  auto data = static_cast<const unsigned char*>(
+      glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT));
+  if (data) {
+    CapturedFrame frame;
+    frame.index = slot.frame.index;
+    frame.width = slot.frame.width;
+    frame.height = slot.frame.height;
+    frame.captureTime = slot.frame.captureTime;
+    frame.pixels.assign(data, data + size);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      frames_.push_back(std::move(frame));
+    }
+    requestCondition_.notify_one();
+  }
+  else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++nDroppedFrames_;
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+
+void FrameCapture::run_() {
+  Tracer::setThreadName("frame capture");
+  while (true) {
+    CapturedFrame frame;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      requestCondition_.wait(lock, [this]() { return isStopped_ || !frames_.empty(); });
+      if (isStopped_) {
+        return;
+      }
+      frame = std::move(frames_.front());
+      frames_.pop_front();
+      isBusy_ = true;
+    }
+
+    // write frame outside of render thread, a failing sink must not terminate the thread
+    std::string error;
+    {
+      SCG_TRACE_SCOPE("write frame");
+      for (auto sink : sinks_) {
+        try {
+          sink->write(frame);
+        }
+        catch (const std::exception& exc) {
+          error = exc.what();
+        }
+      }
+    }
+
+    double latency = getTime() - frame.captureTime;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (error.empty()) {
+        ++nCapturedFrames_;
+        totalLatency_ += latency;
+        maxLatency_ = std::max(maxLatency_, latency);
+      }
+      else {
+        ++nFailedFrames_;
+        lastError_ = error;
+      }
+      isBusy_ = false;
+    }
+    doneCondition_.notify_all();
+  }
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,211 @@
+/**
+ * \file FrameCapture.h
+ * \brief Asynchronous frame capture by a ring of pixel pack buffers, frames are passed to sinks by a worker thread.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMECAPTURE_H_
+#define FRAMECAPTURE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "FrameSink.h"
+
+namespace scg {
+
+
+/**
+ * \brief Asynchronous frame capture by a ring of pixel pack buffers, frames are passed to sinks
+ *   by a worker thread.
+ *
+ * capture() starts an asynchronous readback of the current viewport into the next
+ * pixel pack buffer of the ring and inserts a fence. The buffer is mapped when its fence
+ * has been signaled, usually some frames later, such that the render thread does not stall
+ * on the GPU. Mapped frames are copied and queued for the worker thread, which writes
+ * them to all sinks. If the queue is full, i.e., the sinks are too slow, frames are dropped.
+ *
+ * Example:
+ * \code
+ * auto capture = FrameCapture::create();
+ * capture->addSink(PNGFileSink::create("frame_%05d.png"));
+ * viewer->setFrameCapture(capture);
+ * \endcode
+ */
+class FrameCapture {
+
+public:
+
+  /**
+   * Constructor, starts worker thread.
+   */
+  FrameCapture();
+
+  /**
+   * Destructor, stops worker thread, deletes pixel pack buffers and fences.
+   * Pending frames are discarded, call finish() before to write them.
+   */
+  virtual ~FrameCapture();
+
+  /**
+   * Create shared pointer.
+   */
+  static FrameCaptureSP create();
+
+  /**
+   * Add sink receiving all captured frames.
+   * \return this pointer for method chaining
+   */
+  FrameCapture* addSink(FrameSinkSP sink);
+
+  /**
+   * Set number of pixel pack buffers, i.e., maximum number of frames in flight (default: 3).
+   * \return this pointer for method chaining
+   */
+  FrameCapture* setRingSize(int ringSize);
+
+  /**
+   * Set maximum number of frames waiting for the worker thread (default: 8).
+   * Further frames are dropped.
+   * \return this pointer for method chaining
+   */
+  FrameCapture* setMaxQueuedFrames(int maxQueuedFrames);
+
+  /**
+   * Capture current viewport of read frame buffer, called by the viewer after rendering.
+   * Maps buffers of previous frames whose fences have been signaled and queues them for
+   * the sinks. Waits for the oldest buffer only if all buffers are in flight.
+   */
+  void capture();
+
+  /**
+   * Map all buffers in flight, wait until the worker thread has written all queued frames,
+   * and flush sinks. Frames that failed to be written since the last call are reported
+   * on stderr.
+   */
+  void finish();
+
+  /**
+   * Get number of frames written to sinks.
+   */
+  long getNCapturedFrames() const;
+
+  /**
+   * Get number of frames dropped because of a full queue or a failed readback.
+   */
+  long getNDroppedFrames() const;
+
+  /**
+   * Get number of frames that at least one sink failed to write, e.g., because a file
+   * could not be opened.
+   */
+  long getNFailedFrames() const;
+
+  /**
+   * Get error message of last failed frame, empty if none.
+   */
+  std::string getLastError() const;
+
+  /**
+   * Get average latency from readback request to completion of sinks (milliseconds).
+   */
+  double getAverageLatency() const;
+
+  /**
+   * Get maximum latency from readback request to completion of sinks (milliseconds).
+   */
+  double getMaxLatency() const;
+
+protected:
+
+  /**
+   * Pixel pack buffer of the ring, fence is null if not in flight.
+   */
+  struct Slot {
+    GLuint buffer;
+    GLsync fence;
+    CapturedFrame frame;
+  };
+
+  /**
+   * (Re-)allocate ring of pixel pack buffers for given viewport size.
+   */
+  void allocateRing_(int width, int height);
+
+  /**
+   * Delete pixel pack buffers and fences.
+   */
+  void deleteRing_();
+
+  /**
+   * Map buffer of slot, copy pixels, and queue frame for worker thread (or drop it).
+   */
+  void retrieve_(Slot& slot);
+
+  /**
+   * Worker thread: write queued frames to sinks.
+   */
+  void run_();
+
+protected:
+
+  std::vector<FrameSinkSP> sinks_;
+  std::vector<Slot> ring_;
+  int ringSize_;
+  int maxQueuedFrames_;
+  int next_;
+  int width_;
+  int height_;
+  long frameIndex_;
+
+  std::thread worker_;
+  mutable std::mutex mutex_;
+  std::condition_variable requestCondition_;
+  std::condition_variable doneCondition_;
+  std::deque<CapturedFrame> frames_;
+  bool isBusy_;
+  bool isStopped_;
+  long nCapturedFrames_;
+  long nDroppedFrames_;
+  long nFailedFrames_;
+  long nReportedFailedFrames_;
+  std::string lastError_;
+  double totalLatency_;
+  double maxLatency_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(FrameCapture);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* FRAMECAPTURE_H_ */
@@ -0,0 +1,363 @@
+/**
+ * \file FrameProfiler.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "FrameProfiler.h"
+#include "Node.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+const char* FrameProfiler::META_INFO_KEY = "profile";
+
+static const char* PHASE_NAMES[FrameProfiler::N_PHASES] = {
+    "controllers", "animations", "pre-pass", "render pass", "HUD", "swap", "frame"
+};
+
+
+void FrameProfiler::Series::add(double sample, size_t windowSize) {
+  if (samples.size() < windowSize) {
+    samples.push_back(sample);
+    next = samples.size() % windowSize;
+  }
+  else {
+    samples[next] = sample;
+    next = (next + 1) % windowSize;
+  }
+}
+
+
+FrameProfiler::FrameProfiler()
+    : isEnabled_(false), isGPUTiming_(true), isActive_(false), isGPUActive_(false),
+      windowSize_(120), latency_(3), frameIndex_(0), nMissedGPUFrames_(0) {
+  timers_.resize(N_PHASES);
+  for (int i = 0; i < N_PHASES; ++i) {
+    timers_[i].name = PHASE_NAMES[i];
+  }
+}
+
+
+FrameProfiler::~FrameProfiler() {
+  if (isGLContextActive()) {
+    deleteQueries_();
+  }
+}
+
+
+bool FrameProfiler::isEnabled() const {
+  return isEnabled_;
+}
+
+
+FrameProfiler* FrameProfiler::setEnabled(bool isEnabled) {
+  isEnabled_ = isEnabled;
+  return this;
+}
+
+
+FrameProfiler* FrameProfiler::setGPUTiming(bool isGPUTiming) {
+  isGPUTiming_ = isGPUTiming;
+  return this;
+}
+
+
+FrameProfiler* FrameProfiler::setWindowSize(int nFrames) {
+  windowSize_ = static_cast<size_t>(std::max(nFrames, 1));
+  for (auto& timer : timers_) {
+    timer.cpuSeries = Series();
+    timer.gpuSeries = Series();
+  }
+  return this;
+}
+
+
+FrameProfiler* FrameProfiler::setLatency(int nFrames) {
+  latency_ = std::max(nFrames, 1);
+  return this;
+}
+
+
+void FrameProfiler::beginFrame() {
+  assert(openScopes_.empty());
+
+  // GPU timing requires timestamp queries (OpenGL 3.3), query objects are
+  // released when timing is switched off
+  bool isGPUActive = isEnabled_ && isGPUTiming_ && glQueryCounter != nullptr;
+  if (isGPUActive_ && !isGPUActive) {
+    deleteQueries_();
+  }
+  isActive_ = isEnabled_;
+  isGPUActive_ = isGPUActive;
+  if (!isActive_) {
+    return;
+  }
+
+  for (auto& timer : timers_) {
+    timer.cpuTime = 0.;
+    timer.isUsed = false;
+  }
+
+  // reuse the oldest frame slot, reading back its queries first
+  if (isGPUActive_) {
+    if (frameQueries_.size() != static_cast<size_t>(latency_ + 1)) {
+      deleteQueries_();
+      frameQueries_.resize(latency_ + 1);
+    }
+    auto& frameQueries = frameQueries_[frameIndex_ % frameQueries_.size()];
+    retrieve_(frameQueries);
+    frameQueries.nUsed = 0;
+    frameQueries.timers.clear();
+  }
+
+  beginTimer_(FRAME);
+}
+
+
+void FrameProfiler::endFrame() {
+  if (!isActive_) {
+    return;
+  }
+  endScope();
+  assert(openScopes_.empty());
+
+  for (auto& timer : timers_) {
+    if (timer.isUsed) {
+      timer.cpuSeries.add(timer.cpuTime, windowSize_);
+    }
+  }
+  if (isGPUActive_) {
+    frameQueries_[frameIndex_ % frameQueries_.size()].isPending = true;
+  }
+  ++frameIndex_;
+  assert(!checkGLError());
+}
+
+
+void FrameProfiler::beginPhase(Phase phase) {
+  if (isActive_) {
+    beginTimer_(phase);
+  }
+}
+
+
+void FrameProfiler::beginNode(const Node* node) {
+  if (!isActive_) {
+    return;
+  }
+  auto tag = node->getMetaInfo(META_INFO_KEY);
+  auto it = tagTimers_.find(tag);
+  int timer;
+  if (it != tagTimers_.end()) {
+    timer = it->second;
+  }
+  else {
+    timer = static_cast<int>(timers_.size());
+    timers_.push_back(Timer());
+    timers_.back().name = tag;
+    tagTimers_[tag] = timer;
+  }
+  beginTimer_(timer);
+}
+
+
+void FrameProfiler::endScope() {
+  if (!isActive_ || openScopes_.empty()) {
+    return;
+  }
+  auto& scope = openScopes_.back();
+  auto& timer = timers_[scope.timer];
+  timer.cpuTime += std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - scope.startTime).count();
+  timer.isUsed = true;
+  if (scope.queryPair >= 0) {
+    auto& frameQueries = frameQueries_[frameIndex_ % frameQueries_.size()];
+    frameQueries.lastQuery = 2 * scope.queryPair + 1;
+    glQueryCounter(frameQueries.queries[frameQueries.lastQuery], GL_TIMESTAMP);
+  }
+  openScopes_.pop_back();
+}
+
+
+FrameTimeStats FrameProfiler::getCPUStats(Phase phase) const {
+  return computeStats(timers_[phase].cpuSeries.samples);
+}
+
+
+FrameTimeStats FrameProfiler::getGPUStats(Phase phase) const {
+  return computeStats(timers_[phase].gpuSeries.samples);
+}
+
+
+std::vector<std::string> FrameProfiler::getNodeTags() const {
+  std::vector<std::string> tags;
+  for (size_t i = N_PHASES; i < timers_.size(); ++i) {
+    tags.push_back(timers_[i].name);
+  }
+  return tags;
+}
+
+
+FrameTimeStats FrameProfiler::getNodeCPUStats(const std::string& tag) const {
+  auto it = tagTimers_.find(tag);
+  return (it != tagTimers_.end()) ?
+      computeStats(timers_[it->second].cpuSeries.samples) : FrameTimeStats();
+}
+
+
+FrameTimeStats FrameProfiler::getNodeGPUStats(const std::string& tag) const {
+  auto it = tagTimers_.find(tag);
+  return (it != tagTimers_.end()) ?
+      computeStats(timers_[it->second].gpuSeries.samples) : FrameTimeStats();
+}
+
+
+long FrameProfiler::getNMissedGPUFrames() const {
+  return nMissedGPUFrames_;
+}
+
+
+std::string FrameProfiler::getReport() const {
+  std::stringstream report;
+  report << std::fixed << std::setprecision(3);
+  report << std::left << std::setw(16) << "[ms]" << std::right
+      << std::setw(9) << "cpu min" << std::setw(9) << "avg"
+      << std::setw(9) << "p95" << std::setw(9) << "p99"
+      << std::setw(10) << "gpu min" << std::setw(9) << "avg"
+      << std::setw(9) << "p95" << std::setw(9) << "p99" << std::endl;
+  for (const auto& timer : timers_) {
+    if (timer.cpuSeries.samples.empty()) {
+      continue;
+    }
+    auto cpu = computeStats(timer.cpuSeries.samples);
+    auto gpu = computeStats(timer.gpuSeries.samples);
+    report << std::left << std::setw(16) << timer.name.substr(0, 15) << std::right
+        << std::setw(9) << cpu.min << std::setw(9) << cpu.avg
+        << std::setw(9) << cpu.p95 << std::setw(9) << cpu.p99;
+    if (gpu.nSamples > 0) {
+      report << std::setw(10) << gpu.min << std::setw(9) << gpu.avg
+          << std::setw(9) << gpu.p95 << std::setw(9) << gpu.p99;
+    }
+    report << std::endl;
+  }
+  return report.str();
+}
+
+
+FrameTimeStats FrameProfiler::computeStats(std::vector<double> samples) {
+  FrameTimeStats stats;
+  if (samples.empty()) {
+    return stats;
+  }
+  std::sort(samples.begin(), samples.end());
+  stats.nSamples = static_cast<int>(samples.size());
+  stats.min = samples.front();
+  stats.max = samples.back();
+  double sum = 0.;
+  for (auto sample : samples) {
+    sum += sample;
+  }
+  stats.avg = sum / stats.nSamples;
+  auto percentile = [&samples](double p) {
+    auto rank = static_cast<size_t>(std::ceil(p * samples.size()));
+    return samples[std::max(rank, static_cast<size_t>(1)) - 1];
+  };
+  stats.p95 = percentile(0.95);
+  stats.p99 = percentile(0.99);
+  return stats;
+}
+
+
+void FrameProfiler::beginTimer_(int timer) {
+  OpenScope scope;
+  scope.timer = timer;
+  scope.queryPair = -1;
+  if (isGPUActive_) {
+    auto& frameQueries = frameQueries_[frameIndex_ % frameQueries_.size()];
+    if (2 * frameQueries.nUsed >= static_cast<int>(frameQueries.queries.size())) {
+      GLuint queries[2];
+      glGenQueries(2, queries);
+      frameQueries.queries.push_back(queries[0]);
+      frameQueries.queries.push_back(queries[1]);
+    }
+    scope.queryPair = frameQueries.nUsed++;
+    frameQueries.timers.push_back(timer);
+    glQueryCounter(frameQueries.queries[2 * scope.queryPair], GL_TIMESTAMP);
+  }
+  scope.startTime = std::chrono::steady_clock::now();
+  openScopes_.push_back(scope);
+}
+
+
+void FrameProfiler::retrieve_(FrameQueries& frameQueries) {
+  if (!frameQueries.isPending) {
+    return;
+  }
+  frameQueries.isPending = false;
+  if (frameQueries.nUsed == 0) {
+    return;
+  }
+
+  // the query issued last (end of frame scope, not of the scope opened last) completes
+  // last, if it is not available the frame is discarded instead of stalling the pipeline
+  GLint isAvailable = GL_FALSE;
+  glGetQueryObjectiv(frameQueries.queries[frameQueries.lastQuery], GL_QUERY_RESULT_AVAILABLE,
+      &isAvailable);
+  if (!isAvailable) {
+    ++nMissedGPUFrames_;
+    return;
+  }
+
+  // sum up times per timer, then add to series
+  std::vector<double> gpuTimes(timers_.size(), -1.);
+  for (int i = 0; i < frameQueries.nUsed; ++i) {
+    GLuint64 beginTime = 0, endTime = 0;
+    glGetQueryObjectui64v(frameQueries.queries[2 * i], GL_QUERY_RESULT, &beginTime);
+    glGetQueryObjectui64v(frameQueries.queries[2 * i + 1], GL_QUERY_RESULT, &endTime);
+    int timer = frameQueries.timers[i];
+    gpuTimes[timer] = std::max(gpuTimes[timer], 0.) + 1.e-6 * static_cast<double>(endTime - beginTime);
+  }
+  for (size_t i = 0; i < timers_.size(); ++i) {
+    if (gpuTimes[i] >= 0.) {
+      timers_[i].gpuSeries.add(gpuTimes[i], windowSize_);
+    }
+  }
+}
+
+
+void FrameProfiler::deleteQueries_() {
+  for (auto& frameQueries : frameQueries_) {
+    if (!frameQueries.queries.empty()) {
+      glDeleteQueries(static_cast<GLsizei>(frameQueries.queries.size()),
+          frameQueries.queries.data());
+    }
+  }
+  frameQueries_.clear();
+}
+
+
+} /* namespace scg */
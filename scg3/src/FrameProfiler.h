@@ -0,0 +1,321 @@
+/**
+ * \file FrameProfiler.h
+ * \brief CPU and GPU timing of frame phases and tagged sub-trees, with rolling statistics.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMEPROFILER_H_
+#define FRAMEPROFILER_H_
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief Rolling statistics of frame times (milliseconds).
+ */
+struct FrameTimeStats {
+
+  FrameTimeStats()
+      : min(0.), avg(0.), p95(0.), p99(0.), max(0.), nSamples(0) {
+  }
+
+  double min, avg, p95, p99, max;
+  int nSamples;
+
+};
+
+
+/**
+ * \brief CPU and GPU timing of frame phases and tagged sub-trees, with rolling statistics.
+ *
+ * The profiler is owned by ViewState (cf. ViewState::getFrameProfiler()) and disabled
+ * by default. When enabled, Viewer times the main loop phases (controllers, animations,
+ * performance HUD, swap), and the renderer times its pre-pass and render pass. In addition,
+ * sub-trees can be tagged for attribution, the render pass time of all nodes with the same
+ * tag is summed up per frame:
+ * \code
+ * teapotGroup->setMetaInfo(FrameProfiler::META_INFO_KEY, "teapots");
+ * viewer->getViewState()->getFrameProfiler()->setEnabled(true);
+ * ...
+ * auto stats = profiler->getNodeGPUStats("teapots");
+ * \endcode
+ *
+ * CPU times are measured by scoped timers (steady clock). GPU times are measured by
+ * timestamp queries (glQueryCounter(), allowing nested scopes) and read back a number
+ * of frames later (latency) without stalling; results that are still unavailable
+ * are discarded and counted by getNMissedGPUFrames().
+ */
+class FrameProfiler {
+
+public:
+
+  /**
+   * Frame phases, FRAME covers the complete frame.
+   */
+  enum Phase {
+    CONTROLLERS = 0,
+    ANIMATIONS,
+    PRE_PASS,
+    RENDER_PASS,
+    HUD,
+    SWAP,
+    FRAME,
+    N_PHASES
+  };
+
+  /**
+   * Meta-information key of tagged nodes (cf. Node::setMetaInfo()).
+   */
+  static const char* META_INFO_KEY;
+
+  /**
+   * Scoped timer of a frame phase, does nothing if profiler is null or inactive.
+   */
+  class Scope {
+
+  public:
+
+    Scope(FrameProfiler* profiler, Phase phase)
+        : profiler_((profiler && profiler->isActive()) ? profiler : nullptr) {
+      if (profiler_) {
+        profiler_->beginPhase(phase);
+      }
+    }
+
+    ~Scope() {
+      if (profiler_) {
+        profiler_->endScope();
+      }
+    }
+
+  private:
+
+    FrameProfiler* profiler_;
+
+  };
+
+  /**
+   * Constructor.
+   */
+  FrameProfiler();
+
+  /**
+   * Destructor, deletes query objects.
+   */
+  virtual ~FrameProfiler();
+
+  /**
+   * Check if profiling is enabled.
+   */
+  bool isEnabled() const;
+
+  /**
+   * Enable or disable profiling (default: false), effective from next frame on.
+   * \return this pointer for method chaining
+   */
+  FrameProfiler* setEnabled(bool isEnabled);
+
+  /**
+   * Enable or disable GPU timing (default: true), effective from next frame on.
+   * \return this pointer for method chaining
+   */
+  FrameProfiler* setGPUTiming(bool isGPUTiming);
+
+  /**
+   * Set number of frames for rolling statistics (default: 120).
+   * \return this pointer for method chaining
+   */
+  FrameProfiler* setWindowSize(int nFrames);
+
+  /**
+   * Set number of frames after which GPU timer queries are read back (default: 3).
+   * \return this pointer for method chaining
+   */
+  FrameProfiler* setLatency(int nFrames);
+
+  /**
+   * Check if current frame is being profiled.
+   */
+  bool isActive() const {
+    return isActive_;
+  }
+
+  /**
+   * Begin frame, read back GPU timer queries of previous frames (called by Viewer).
+   */
+  void beginFrame();
+
+  /**
+   * End frame, add CPU times of current frame to statistics (called by Viewer).
+   */
+  void endFrame();
+
+  /**
+   * Begin timer of frame phase, to be ended by endScope().
+   */
+  void beginPhase(Phase phase);
+
+  /**
+   * Begin timer of tagged node, to be ended by endScope() (called by Composite::traverse()
+   * and Leaf::traverse()).
+   */
+  void beginNode(const Node* node);
+
+  /**
+   * End innermost timer.
+   */
+  void endScope();
+
+  /**
+   * Get CPU time statistics of phase.
+   */
+  FrameTimeStats getCPUStats(Phase phase) const;
+
+  /**
+   * Get GPU time statistics of phase.
+   */
+  FrameTimeStats getGPUStats(Phase phase) const;
+
+  /**
+   * Get tags of all nodes profiled so far.
+   */
+  std::vector<std::string> getNodeTags() const;
+
+  /**
+   * Get CPU time statistics of nodes with given tag.
+   */
+  FrameTimeStats getNodeCPUStats(const std::string& tag) const;
+
+  /**
+   * Get GPU time statistics of nodes with given tag.
+   */
+  FrameTimeStats getNodeGPUStats(const std::string& tag) const;
+
+  /**
+   * Get number of frames whose GPU timer queries were not available in time.
+   */
+  long getNMissedGPUFrames() const;
+
+  /**
+   * Get report of all statistics (one line per phase or tag).
+   */
+  std::string getReport() const;
+
+  /**
+   * Compute statistics of given frame times (milliseconds), percentiles by nearest rank.
+   */
+  static FrameTimeStats computeStats(std::vector<double> samples);
+
+protected:
+
+  /**
+   * Samples of the last frames (ring buffer).
+   */
+  struct Series {
+    Series() : next(0) {}
+    void add(double sample, size_t windowSize);
+    std::vector<double> samples;
+    size_t next;
+  };
+
+  /**
+   * Timer of a phase or tag.
+   */
+  struct Timer {
+    Timer() : cpuTime(0.), isUsed(false) {}
+    std::string name;
+    Series cpuSeries;
+    Series gpuSeries;
+    double cpuTime;               // CPU time of current frame (milliseconds)
+    bool isUsed;                  // used in current frame
+  };
+
+  /**
+   * Open scope of current frame.
+   */
+  struct OpenScope {
+    int timer;
+    std::chrono::steady_clock::time_point startTime;
+    int queryPair;                // index of query pair, -1 without GPU timing
+  };
+
+  /**
+   * Timestamp query pairs of a frame in flight.
+   */
+  struct FrameQueries {
+    FrameQueries() : nUsed(0), lastQuery(-1), isPending(false) {}
+    std::vector<GLuint> queries;  // begin and end query per pair
+    std::vector<int> timers;      // timer per pair
+    int nUsed;
+    int lastQuery;                // index of query issued last (end query of frame scope)
+    bool isPending;
+  };
+
+  /**
+   * Begin timer with given index.
+   */
+  void beginTimer_(int timer);
+
+  /**
+   * Read back timestamp queries of frame, if available.
+   */
+  void retrieve_(FrameQueries& frameQueries);
+
+  /**
+   * Delete query objects of all frames.
+   */
+  void deleteQueries_();
+
+protected:
+
+  bool isEnabled_;
+  bool isGPUTiming_;
+  bool isActive_;
+  bool isGPUActive_;
+  size_t windowSize_;
+  int latency_;
+  long frameIndex_;
+  long nMissedGPUFrames_;
+  std::vector<Timer> timers_;
+  std::unordered_map<std::string, int> tagTimers_;
+  std::vector<OpenScope> openScopes_;
+  std::vector<FrameQueries> frameQueries_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(FrameProfiler);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* FRAMEPROFILER_H_ */
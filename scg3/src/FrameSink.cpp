@@ -0,0 +1,430 @@
+/**
+ * \file FrameSink.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "FrameSink.h"
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace scg {
+
+
+namespace {
+
+// CRC-32 table of PNG chunks (ISO 3309)
+struct CRCTable {
+  CRCTable() {
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+      }
+      values[n] = c;
+    }
+  }
+  uint32_t values[256];
+};
+
+// CRC-32 update, table is initialized thread-safe on first call (worker threads of
+// several sinks)
+uint32_t updateCRC(uint32_t crc, const unsigned char* data, size_t size) {
+  static const CRCTable table;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table.values[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+void appendBigEndian(std::vector<unsigned char>& buffer, uint32_t value) {
+  buffer.push_back(static_cast<unsigned char>(value >> 24));
+  buffer.push_back(static_cast<unsigned char>(value >> 16));
+  buffer.push_back(static_cast<unsigned char>(value >> 8));
+  buffer.push_back(static_cast<unsigned char>(value));
+}
+
+void writeChunk(std::ofstream& stream, const char* type, const std::vector<unsigned char>& data) {
+  std::vector<unsigned char> header;
+  appendBigEndian(header, static_cast<uint32_t>(data.size()));
+  header.insert(header.end(), type, type + 4);
+  uint32_t crc = updateCRC(0xffffffffu, header.data() + 4, 4);
+  crc = updateCRC(crc, data.data(), data.size()) ^ 0xffffffffu;
+  std::vector<unsigned char> trailer;
+  appendBigEndian(trailer, crc);
+  stream.write(reinterpret_cast<const char*>(header.data()), header.size());
+  stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+  stream.write(reinterpret_cast<const char*>(trailer.data()), trailer.size());
+}
+
+// PNG filters of one row with 4 bytes per pixel, the filter with the minimum sum of absolute
+// (signed) differences is chosen
+int paethPredictor(int a, int b, int c) {
+  int p = a + b - c;
+  int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+  return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+void filterRow(const unsigned char* row, const unsigned char* prevRow, size_t rowSize,
+    std::vector<unsigned char>& filtered, std::vector<unsigned char>& result) {
+  const size_t bpp = 4;
+  long minSum = -1;
+  for (int filter = 0; filter < 5; ++filter) {
+    long sum = 0;
+    for (size_t i = 0; i < rowSize; ++i) {
+      int a = (i >= bpp) ? row[i - bpp] : 0;
+      int b = prevRow ? prevRow[i] : 0;
+      int c = (prevRow && i >= bpp) ? prevRow[i - bpp] : 0;
+      int predicted = 0;
+      switch (filter) {
+        case 1: predicted = a; break;
+        case 2: predicted = b; break;
+        case 3: predicted = (a + b) / 2; break;
+        case 4: predicted = paethPredictor(a, b, c); break;
+      }
+      filtered[i] = static_cast<unsigned char>(row[i] - predicted);
+      sum += std::abs(static_cast<int>(static_cast<signed char>(filtered[i])));
+    }
+    if (minSum < 0 || sum < minSum) {
+      minSum = sum;
+      result[0] = static_cast<unsigned char>(filter);
+      std::copy(filtered.begin(), filtered.begin() + rowSize, result.begin() + 1);
+    }
+  }
+}
+
+// deflate bit stream, least significant bit first
+struct BitWriter {
+  explicit BitWriter(std::vector<unsigned char>& out0) : out(out0), bits(0), nBits(0) {}
+  void write(uint32_t value, int n) {
+    bits |= value << nBits;
+    nBits += n;
+    while (nBits >= 8) {
+      out.push_back(static_cast<unsigned char>(bits));
+      bits >>= 8;
+      nBits -= 8;
+    }
+  }
+  // Huffman codes are written most significant bit first
+  void writeCode(uint32_t code, int n) {
+    uint32_t reversed = 0;
+    for (int i = 0; i < n; ++i) {
+      reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    write(reversed, n);
+  }
+  void flush() {
+    if (nBits > 0) {
+      write(0, 8 - nBits);
+    }
+  }
+  std::vector<unsigned char>& out;
+  uint32_t bits;
+  int nBits;
+};
+
+const int LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const int LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const int DIST_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const int DIST_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+void writeLiteral(BitWriter& writer, int value) {
+  if (value < 144) {
+    writer.writeCode(0x30 + value, 8);
+  }
+  else if (value < 256) {
+    writer.writeCode(0x190 + value - 144, 9);
+  }
+  else if (value < 280) {
+    writer.writeCode(value - 256, 7);
+  }
+  else {
+    writer.writeCode(0xc0 + value - 280, 8);
+  }
+}
+
+// zlib stream of one deflate block with fixed Huffman codes, LZ77 matches are found by
+// hash chains of 3-byte sequences
+void compressZlib(const std::vector<unsigned char>& data, std::vector<unsigned char>& out) {
+  const int WINDOW_SIZE = 32768;
+  const int HASH_SIZE = 1 << 15;
+  const int MAX_CHAIN = 32;
+  const int MIN_MATCH = 3;
+  const int MAX_MATCH = 258;
+  out.push_back(0x78);
+  out.push_back(0x01);
+  BitWriter writer(out);
+  writer.write(1, 1);    // final block
+  writer.write(1, 2);    // fixed Huffman codes
+  std::vector<int> head(HASH_SIZE, -1);
+  std::vector<int> prev(WINDOW_SIZE, -1);
+  const int size = static_cast<int>(data.size());
+  auto hash = [&](int i) {
+    return ((data[i] << 10) ^ (data[i + 1] << 5) ^ data[i + 2]) & (HASH_SIZE - 1);
+  };
+  auto insert = [&](int i) {
+    if (i + MIN_MATCH <= size) {
+      int h = hash(i);
+      prev[i & (WINDOW_SIZE - 1)] = head[h];
+      head[h] = i;
+    }
+  };
+  int i = 0;
+  while (i < size) {
+    int bestLength = 0, bestDist = 0;
+    if (i + MIN_MATCH <= size) {
+      int maxLength = std::min(MAX_MATCH, size - i);
+      int candidate = head[hash(i)];
+      for (int chain = 0; chain < MAX_CHAIN && candidate >= 0 && i - candidate <= WINDOW_SIZE;
+          ++chain) {
+        int length = 0;
+        while (length < maxLength && data[candidate + length] == data[i + length]) {
+          ++length;
+        }
+        if (length > bestLength) {
+          bestLength = length;
+          bestDist = i - candidate;
+          if (length == maxLength) {
+            break;
+          }
+        }
+        int next = prev[candidate & (WINDOW_SIZE - 1)];
+        if (next >= candidate) {
+          break;
+        }
+        candidate = next;
+      }
+    }
+    if (bestLength >= MIN_MATCH) {
+      int code = 0;
+      while (code < 28 && LENGTH_BASE[code + 1] <= bestLength) {
+        ++code;
+      }
+      writeLiteral(writer, 257 + code);
+      writer.write(bestLength - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+      code = 0;
+      while (code < 29 && DIST_BASE[code + 1] <= bestDist) {
+        ++code;
+      }
+      writer.writeCode(code, 5);
+      writer.write(bestDist - DIST_BASE[code], DIST_EXTRA[code]);
+      for (int j = 0; j < bestLength; ++j) {
+        insert(i + j);
+      }
+      i += bestLength;
+    }
+    else {
+      writeLiteral(writer, data[i]);
+      insert(i);
+      ++i;
+    }
+  }
+  writeLiteral(writer, 256);
+  writer.flush();
+
+  // Adler-32 checksum
+  uint32_t a = 1, b = 0;
+  for (auto value : data) {
+    a = (a + value) % 65521;
+    b = (b + a) % 65521;
+  }
+  appendBigEndian(out, (b << 16) | a);
+}
+
+}
+
+
+FrameSink::FrameSink() {
+}
+
+
+FrameSink::~FrameSink() {
+}
+
+
+void FrameSink::flush() {
+}
+
+
+void FrameSink::flipRows_(const CapturedFrame& frame, std::vector<unsigned char>& pixels) {
+  const size_t rowSize = 4 * static_cast<size_t>(frame.width);
+  pixels.resize(rowSize * frame.height);
+  for (int y = 0; y < frame.height; ++y) {
+    memcpy(&pixels[rowSize * y], &frame.pixels[rowSize * (frame.height - 1 - y)], rowSize);
+  }
+}
+
+
+PipeSink::PipeSink(const std::string& command)
+    : stream_(nullptr), isPipe_(true) {
+  if (command.empty()) {
+    throw std::runtime_error("Empty pipe command [PipeSink::PipeSink()]");
+  }
+  stream_ = popen(command.c_str(), "w");
+  if (!stream_) {
+    throw std::runtime_error("Cannot open pipe to " + command + " [PipeSink::PipeSink()]");
+  }
+}
+
+
+PipeSink::PipeSink(FILE* stream)
+    : stream_(stream), isPipe_(false) {
+}
+
+
+PipeSink::~PipeSink() {
+  if (isPipe_) {
+    pclose(stream_);
+  }
+  else if (stream_) {
+    fflush(stream_);
+  }
+}
+
+
+PipeSinkSP PipeSink::create(const std::string& command) {
+  return std::make_shared<PipeSink>(command);
+}
+
+
+void PipeSink::write(const CapturedFrame& frame) {
+  flipRows_(frame, buffer_);
+  fwrite(buffer_.data(), 1, buffer_.size(), stream_);
+}
+
+
+void PipeSink::flush() {
+  fflush(stream_);
+}
+
+
+RawFileSink::RawFileSink(const std::string& fileName)
+    : PipeSink(fopen(fileName.c_str(), "wb")) {
+  if (!stream_) {
+    throw std::runtime_error("Cannot open file " + fileName + " [RawFileSink::RawFileSink()]");
+  }
+}
+
+
+RawFileSink::~RawFileSink() {
+  fclose(stream_);
+  stream_ = nullptr;
+}
+
+
+RawFileSinkSP RawFileSink::create(const std::string& fileName) {
+  return std::make_shared<RawFileSink>(fileName);
+}
+
+
+PNGFileSink::PNGFileSink(const std::string& fileNamePattern)
+    : fileNamePattern_(fileNamePattern) {
+  // pattern is used as printf() format, allow exactly one conversion %[flags][width]d
+  int nConversions = 0;
+  for (size_t i = 0; i < fileNamePattern_.size(); ++i) {
+    if (fileNamePattern_[i] != '%') {
+      continue;
+    }
+    if (i + 1 < fileNamePattern_.size() && fileNamePattern_[i + 1] == '%') {
+      ++i;
+      continue;
+    }
+    size_t j = fileNamePattern_.find_first_not_of("-+ #0123456789", i + 1);
+    if (j == std::string::npos || fileNamePattern_[j] != 'd') {
+      nConversions = -1;
+      break;
+    }
+    ++nConversions;
+    i = j;
+  }
+  if (nConversions != 1) {
+    throw std::runtime_error("File name pattern " + fileNamePattern_
+        + " requires exactly one conversion %d [PNGFileSink::PNGFileSink()]");
+  }
+}
+
+
+PNGFileSink::~PNGFileSink() {
+}
+
+
+PNGFileSinkSP PNGFileSink::create(const std::string& fileNamePattern) {
+  return std::make_shared<PNGFileSink>(fileNamePattern);
+}
+
+
+void PNGFileSink::write(const CapturedFrame& frame) {
+  std::vector<char> fileName(fileNamePattern_.size() + 32);
+  snprintf(fileName.data(), fileName.size(), fileNamePattern_.c_str(),
+      static_cast<int>(frame.index));
+  flipRows_(frame, buffer_);
+  writePNG(fileName.data(), frame.width, frame.height, buffer_.data());
+}
+
+
+void PNGFileSink::writePNG(const std::string& fileName, int width, int height,
+    const unsigned char* rgbaData) {
+  assert(width > 0 && height > 0);
+  std::ofstream stream(fileName, std::ios::binary);
+  if (!stream) {
+    throw std::runtime_error("Cannot open file " + fileName + " [PNGFileSink::writePNG()]");
+  }
+  const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  stream.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+  // header: size, 8 bits per channel, RGBA, no interlace
+  std::vector<unsigned char> data;
+  appendBigEndian(data, static_cast<uint32_t>(width));
+  appendBigEndian(data, static_cast<uint32_t>(height));
+  const unsigned char params[5] = { 8, 6, 0, 0, 0 };
+  data.insert(data.end(), params, params + 5);
+  writeChunk(stream, "IHDR", data);
+
+  // image data: filtered rows, compressed zlib stream
+  const size_t rowSize = 4 * static_cast<size_t>(width);
+  std::vector<unsigned char> raw((rowSize + 1) * height);
+  std::vector<unsigned char> filtered(rowSize), filteredRow(rowSize + 1);
+  for (int y = 0; y < height; ++y) {
+    filterRow(rgbaData + rowSize * y, (y > 0) ? rgbaData + rowSize * (y - 1) : nullptr,
+        rowSize, filtered, filteredRow);
+    std::copy(filteredRow.begin(), filteredRow.end(), raw.begin() + (rowSize + 1) * y);
+  }
+  data.clear();
+  compressZlib(raw, data);
+  writeChunk(stream, "IDAT", data);
+  writeChunk(stream, "IEND", std::vector<unsigned char>());
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,220 @@
+/**
+ * \file FrameSink.h
+ * \brief Destinations of frames read back by FrameCapture, e.g., raw files, PNG files, or pipes.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMESINK_H_
+#define FRAMESINK_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A frame read back by FrameCapture, RGBA with 8 bits per channel,
+ *    rows ordered bottom-up as returned by glReadPixels().
+ */
+struct CapturedFrame {
+
+  CapturedFrame()
+      : index(0), width(0), height(0), captureTime(0.) {
+  }
+
+  long index;                         // frame number since start of capture
+  int width, height;
+  std::vector<unsigned char> pixels;
+  double captureTime;                 // time of readback request (seconds, cf. getTime())
+
+};
+
+
+/**
+ * \brief Abstract base class of frame sinks, called by the worker thread of FrameCapture.
+ */
+class FrameSink {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  FrameSink();
+
+  /**
+   * Destructor.
+   */
+  virtual ~FrameSink() = 0;
+
+  /**
+   * Write frame, called by worker thread.
+   */
+  virtual void write(const CapturedFrame& frame) = 0;
+
+  /**
+   * Flush pending output, called by FrameCapture::finish().
+   */
+  virtual void flush();
+
+protected:
+
+  /**
+   * Copy pixels of frame with rows ordered top-down (e.g., for images and video encoders).
+   */
+  static void flipRows_(const CapturedFrame& frame, std::vector<unsigned char>& pixels);
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(FrameSink);
+
+};
+
+
+/**
+ * \brief A frame sink writing raw RGBA frames (rows top-down) to the standard input
+ *    of a shell command, e.g., a video encoder (ffmpeg -f rawvideo -pix_fmt rgba -s WxH -i -).
+ *
+ * Frames are not written to stdout of the application, since Viewer writes information
+ * to stdout as well.
+ */
+class PipeSink: public FrameSink {
+
+public:
+
+  /**
+   * Constructor, writes to the standard input of the given shell command (not empty).
+   */
+  explicit PipeSink(const std::string& command);
+
+  /**
+   * Destructor, closes pipe.
+   */
+  virtual ~PipeSink();
+
+  /**
+   * Create shared pointer.
+   */
+  static PipeSinkSP create(const std::string& command);
+
+  /**
+   * Write frame, called by worker thread.
+   */
+  virtual void write(const CapturedFrame& frame);
+
+  /**
+   * Flush stream.
+   */
+  virtual void flush();
+
+protected:
+
+  /**
+   * Constructor for derived classes, which open the stream themselves.
+   */
+  PipeSink(FILE* stream);
+
+protected:
+
+  FILE* stream_;
+  bool isPipe_;
+  std::vector<unsigned char> buffer_;
+
+};
+
+
+/**
+ * \brief A frame sink appending raw RGBA frames (rows top-down) to a single file.
+ */
+class RawFileSink: public PipeSink {
+
+public:
+
+  /**
+   * Constructor, creates file.
+   */
+  explicit RawFileSink(const std::string& fileName);
+
+  /**
+   * Destructor, closes file.
+   */
+  virtual ~RawFileSink();
+
+  /**
+   * Create shared pointer.
+   */
+  static RawFileSinkSP create(const std::string& fileName);
+
+};
+
+
+/**
+ * \brief A frame sink writing each frame to a compressed PNG file.
+ */
+class PNGFileSink: public FrameSink {
+
+public:
+
+  /**
+   * Constructor with file name pattern containing the frame index as printf()
+   * conversion, e.g., "frame_%05d.png". Throws an exception if the pattern does not contain
+   * exactly one conversion %d (with optional flags and width, '%%' for a literal '%').
+   */
+  explicit PNGFileSink(const std::string& fileNamePattern);
+
+  /**
+   * Destructor.
+   */
+  virtual ~PNGFileSink();
+
+  /**
+   * Create shared pointer.
+   */
+  static PNGFileSinkSP create(const std::string& fileNamePattern);
+
+  /**
+   * Write frame, called by worker thread.
+   */
+  virtual void write(const CapturedFrame& frame);
+
+  /**
+   * Write RGBA image (rows top-down) to PNG file.
+   */
+  static void writePNG(const std::string& fileName, int width, int height,
+      const unsigned char* rgbaData);
+
+protected:
+
+  std::string fileNamePattern_;
+  std::vector<unsigned char> buffer_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* FRAMESINK_H_ */
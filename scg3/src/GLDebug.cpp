@@ -0,0 +1,230 @@
+/**
+ * \file GLDebug.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include "GLDebug.h"
+
+namespace scg {
+
+
+namespace {
+
+std::atomic<int> nErrors(0);
+std::atomic<int> nUncheckedErrors(0);
+std::atomic<int> nPerformanceWarnings(0);
+GLenum printSeverity = GL_DEBUG_SEVERITY_MEDIUM;
+GLint maxLabelLength = 256;
+
+// rank of severity, higher is more severe
+int getSeverityRank(GLenum severity) {
+  switch (severity) {
+    case GL_DEBUG_SEVERITY_HIGH:
+      return 3;
+    case GL_DEBUG_SEVERITY_MEDIUM:
+      return 2;
+    case GL_DEBUG_SEVERITY_LOW:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+const char* getSeverityName(GLenum severity) {
+  switch (severity) {
+    case GL_DEBUG_SEVERITY_HIGH:
+      return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM:
+      return "medium";
+    case GL_DEBUG_SEVERITY_LOW:
+      return "low";
+    default:
+      return "notification";
+  }
+}
+
+const char* getTypeName(GLenum type) {
+  switch (type) {
+    case GL_DEBUG_TYPE_ERROR:
+      return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+      return "deprecated behavior";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+      return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:
+      return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:
+      return "performance";
+    case GL_DEBUG_TYPE_MARKER:
+      return "marker";
+    default:
+      return "other";
+  }
+}
+
+const char* getSourceName(GLenum source) {
+  switch (source) {
+    case GL_DEBUG_SOURCE_API:
+      return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+      return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER:
+      return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:
+      return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION:
+      return "application";
+    default:
+      return "other";
+  }
+}
+
+// may be called by a driver thread if debug output is asynchronous
+void APIENTRY messageCB(GLenum source, GLenum type, GLuint id, GLenum severity,
+    GLsizei length, const GLchar* message, const void* userParam) {
+  if (type == GL_DEBUG_TYPE_ERROR) {
+    ++nErrors;
+    ++nUncheckedErrors;
+  }
+  else if (type == GL_DEBUG_TYPE_PERFORMANCE) {
+    ++nPerformanceWarnings;
+  }
+  if (type != GL_DEBUG_TYPE_ERROR && getSeverityRank(severity) < getSeverityRank(printSeverity)) {
+    return;
+  }
+  std::cerr << "GL debug [" << getSeverityName(severity) << "] " << getTypeName(type)
+      << " (" << getSourceName(source) << ", id " << id << "): "
+      << std::string(message, (length >= 0) ? length : strlen(message)) << std::endl;
+}
+
+} /* namespace */
+
+
+const char* GLDebug::META_INFO_KEY = "label";
+
+bool GLDebug::isActive_ = false;
+
+
+bool GLDebug::init(GLenum minSeverity, bool isSynchronous) {
+  isActive_ = false;
+  if (!SCG_GL_EXTENSION_SUPPORTED(KHR_debug)) {
+    return false;
+  }
+  glDebugMessageCallback(messageCB, nullptr);
+  glEnable(GL_DEBUG_OUTPUT);
+  if (isSynchronous) {
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  }
+  else {
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  }
+  glGetIntegerv(GL_MAX_LABEL_LENGTH, &maxLabelLength);
+  isActive_ = true;
+  setMinSeverity(minSeverity);
+  resetCounters();
+
+  // errors before initialization have not been reported by the callback
+  while (glGetError() != GL_NO_ERROR) {
+  }
+  return true;
+}
+
+
+void GLDebug::setMinSeverity(GLenum minSeverity) {
+  printSeverity = minSeverity;
+  if (!isActive_) {
+    return;
+  }
+
+  // filter by driver: severities below minimum are disabled, except for errors
+  // and performance warnings, which are counted
+  const GLenum severities[] = { GL_DEBUG_SEVERITY_HIGH, GL_DEBUG_SEVERITY_MEDIUM,
+      GL_DEBUG_SEVERITY_LOW, GL_DEBUG_SEVERITY_NOTIFICATION };
+  for (GLenum severity : severities) {
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, severity, 0, nullptr,
+        getSeverityRank(severity) >= getSeverityRank(minSeverity) ? GL_TRUE : GL_FALSE);
+  }
+  glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_ERROR, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+  glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PERFORMANCE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+
+  // debug groups are for GL debuggers, not for the message log
+  glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PUSH_GROUP, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+  glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_POP_GROUP, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+}
+
+
+GLenum GLDebug::getMinSeverity() {
+  return printSeverity;
+}
+
+
+int GLDebug::checkError() {
+  return (nUncheckedErrors.exchange(0) > 0) ? 1 : 0;
+}
+
+
+int GLDebug::getNErrors() {
+  return nErrors.load();
+}
+
+
+int GLDebug::getNPerformanceWarnings() {
+  return nPerformanceWarnings.load();
+}
+
+
+void GLDebug::resetCounters() {
+  nErrors = 0;
+  nUncheckedErrors = 0;
+  nPerformanceWarnings = 0;
+}
+
+
+void GLDebug::setObjectLabel(GLenum identifier, GLuint name, const std::string& label) {
+  if (!isActive_ || name == 0 || label.empty()) {
+    return;
+  }
+  GLsizei length = static_cast<GLsizei>(label.size());
+  if (maxLabelLength > 0 && length >= maxLabelLength) {
+    length = maxLabelLength - 1;
+  }
+  glObjectLabel(identifier, name, length, label.c_str());
+}
+
+
+void GLDebug::pushGroup(const char* name) {
+  if (isActive_) {
+    glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+  }
+}
+
+
+void GLDebug::popGroup() {
+  if (isActive_) {
+    glPopDebugGroup();
+  }
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,193 @@
+/**
+ * \file GLDebug.h
+ * \brief OpenGL debug output (KHR_debug): message callback, object labels, and debug groups.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GLDEBUG_H_
+#define GLDEBUG_H_
+
+#include <string>
+#include "scg_glew_glad.h"
+
+namespace scg {
+
+
+/**
+ * \brief OpenGL debug output (KHR_debug): message callback, object labels, and debug groups.
+ *
+ * init() is called by Viewer::createWindow() if OGLConfig::debug is set (default in debug
+ * builds, i.e., if NDEBUG is not defined). It installs a message callback that
+ * - prints messages with a severity of at least getMinSeverity() to std::cerr,
+ * - counts GL errors, reported by checkGLError() instead of polling glGetError(),
+ * - counts performance warnings of the driver (of any severity).
+ *
+ * Messages below the minimum severity are discarded by the driver, except for
+ * errors and performance warnings. Output is synchronous by default, i.e., the
+ * callback is called before the erroneous GL function returns, such that
+ * assert(!checkGLError()) points to the right code location.
+ *
+ * Object labels and debug groups are shown by GL debuggers like RenderDoc:
+ * - cores label their GL objects via Core::setDebugLabel(), factories use file names,
+ *   shader programs are labeled by their shader names,
+ * - a non-empty value for node meta-information key META_INFO_KEY labels the cores of
+ *   the node and encloses its traversal in a debug group,
+ * - render passes are enclosed in debug groups via SCG_GL_DEBUG_GROUP(name).
+ *
+ * If debug output is not active (release builds or KHR_debug not supported), all
+ * functions return immediately, costing a single flag check.
+ */
+class GLDebug {
+
+public:
+
+  /**
+   * Meta-information key of labeled nodes (cf. Node::setMetaInfo()).
+   */
+  static const char* META_INFO_KEY;
+
+  /**
+   * Enable debug output and install message callback, requires an active OpenGL context.
+   *
+   * \param minSeverity minimum severity of printed messages (cf. setMinSeverity())
+   * \param isSynchronous true: call message callback synchronously (slower, but exact location)
+   * \return true if KHR_debug is supported and debug output is active
+   */
+  static bool init(GLenum minSeverity = GL_DEBUG_SEVERITY_MEDIUM, bool isSynchronous = true);
+
+  /**
+   * Check if debug output is active.
+   */
+  static bool isActive() {
+    return isActive_;
+  }
+
+  /**
+   * Set minimum severity of printed messages: GL_DEBUG_SEVERITY_HIGH, GL_DEBUG_SEVERITY_MEDIUM
+   * (default), GL_DEBUG_SEVERITY_LOW, or GL_DEBUG_SEVERITY_NOTIFICATION.
+   */
+  static void setMinSeverity(GLenum minSeverity);
+
+  /**
+   * Get minimum severity of printed messages.
+   */
+  static GLenum getMinSeverity();
+
+  /**
+   * Check if GL errors have been reported since last call, called by checkGLError().
+   *
+   * \return 0 for no error, 1 for error
+   */
+  static int checkError();
+
+  /**
+   * Get number of GL errors reported since last call of resetCounters().
+   */
+  static int getNErrors();
+
+  /**
+   * Get number of performance warnings reported since last call of resetCounters().
+   */
+  static int getNPerformanceWarnings();
+
+  /**
+   * Reset error and performance warning counters.
+   */
+  static void resetCounters();
+
+  /**
+   * Label GL object, e.g., setObjectLabel(GL_TEXTURE, tex, "brick.png").
+   *
+   * \param identifier object type (GL_BUFFER, GL_PROGRAM, GL_TEXTURE, GL_VERTEX_ARRAY, etc.)
+   * \param name object name, ignored if 0
+   * \param label label, truncated to the maximum label length
+   */
+  static void setObjectLabel(GLenum identifier, GLuint name, const std::string& label);
+
+  /**
+   * Push debug group with given name.
+   */
+  static void pushGroup(const char* name);
+
+  /**
+   * Pop debug group pushed by pushGroup().
+   */
+  static void popGroup();
+
+private:
+
+  GLDebug();
+
+  static bool isActive_;
+
+};
+
+
+/**
+ * \brief Debug group from construction to destruction, to be used by the macro
+ *    SCG_GL_DEBUG_GROUP().
+ */
+class GLDebugGroup {
+
+public:
+
+  /**
+   * Constructor with group name, pushes group if debug output is active.
+   */
+  explicit GLDebugGroup(const char* name)
+      : isPushed_(GLDebug::isActive()) {
+    if (isPushed_) {
+      GLDebug::pushGroup(name);
+    }
+  }
+
+  /**
+   * Destructor, pops group pushed by constructor.
+   */
+  ~GLDebugGroup() {
+    if (isPushed_) {
+      GLDebug::popGroup();
+    }
+  }
+
+private:
+
+  bool isPushed_;
+
+  GLDebugGroup(const GLDebugGroup&);
+  GLDebugGroup& operator=(const GLDebugGroup&);
+
+};
+
+
+} /* namespace scg */
+
+
+#define SCG_GL_DEBUG_CONCAT_(a, b) a##b
+#define SCG_GL_DEBUG_CONCAT(a, b) SCG_GL_DEBUG_CONCAT_(a, b)
+
+/**
+ * Enclose current scope in debug group with given name (string).
+ */
+#define SCG_GL_DEBUG_GROUP(name) \
+  scg::GLDebugGroup SCG_GL_DEBUG_CONCAT(scgGLDebugGroup_, __LINE__)(name)
+
+#endif /* GLDEBUG_H_ */
@@ -21,8 +21,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include "GeometryCore.h"
+#include "GLDebug.h"
 #include "RenderState.h"
 #include "scg_utilities.h"
 
@@ -31,7 +33,8 @@ namespace scg {
 
 GeometryCore::GeometryCore(GLenum primitiveType, DrawMode drawMode)
     : primitiveType_(primitiveType), drawMode_(drawMode), vao_(0),
-      vboIndex_(0), nElements_(0) {
+      vboIndex_(0), indexSize_(0), nElements_(0), hasBoundingBox_(false),
+      boundingBoxMin_(0.f), boundingBoxMax_(0.f) {
   switch(drawMode_) {
   case DrawMode::ARRAYS:
     drawFunc_ = std::bind(glDrawArrays, std::placeholders::_1, 0, std::placeholders::_2);
@@ -52,8 +55,8 @@ GeometryCore::GeometryCore(GLenum primitiveType, DrawMode drawMode)
 
 GeometryCore::~GeometryCore() {
   if (isGLContextActive()) {
-    for (auto vbo : vboAttributes_) {
-      glDeleteBuffers(1, &vbo);
+    for (auto& attribute : attributes_) {
+      glDeleteBuffers(1, &attribute.vbo);
     }
     glDeleteBuffers(1, &vboIndex_);
     glDeleteVertexArrays(1, &vao_);
@@ -73,7 +76,8 @@ GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLfloat* dat
   glGenBuffers(1, &vbo);
   glBindBuffer(GL_ARRAY_BUFFER, vbo);
   assert(glIsBuffer(vbo));
-  vboAttributes_.push_back(vbo);
+  VertexAttribute attribute = { location, dim, vbo, size };
+  attributes_.push_back(attribute);
   glBufferData(GL_ARRAY_BUFFER, size, data, usage);
   if (drawMode_ == DrawMode::ARRAYS && nElements_ == 0) {
     nElements_ = size / (dim * sizeof(GLfloat));
@@ -83,6 +87,24 @@ GeometryCore* GeometryCore::addAttributeData(GLuint location, const GLfloat* dat
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
 
+  // update bounding box by vertex positions
+  if (location == OGLConstants::VERTEX.location && data) {
+    GLsizeiptr nValues = size / static_cast<GLsizeiptr>(dim * sizeof(GLfloat));
+    int nCoords = std::min(dim, 3);
+    for (GLsizeiptr i = 0; i < nValues; ++i) {
+      glm::vec3 position(0.f);
+      for (int j = 0; j < nCoords; ++j) {
+        position[j] = data[i * dim + j];
+      }
+      if (!hasBoundingBox_) {
+        boundingBoxMin_ = boundingBoxMax_ = position;
+        hasBoundingBox_ = true;
+      }
+      boundingBoxMin_ = glm::min(boundingBoxMin_, position);
+      boundingBoxMax_ = glm::max(boundingBoxMax_, position);
+    }
+  }
+
   assert(!checkGLError());
   return this;
 }
@@ -95,6 +117,7 @@ GeometryCore* GeometryCore::setElementIndexData(const GLuint* data, GLsizeiptr s
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vboIndex_);
   assert(glIsBuffer(vboIndex_));
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, usage);
+  indexSize_ = size;
   if (drawMode_ == DrawMode::ELEMENTS) {
     nElements_ = size / sizeof(GLuint);
   }
@@ -124,6 +147,73 @@ int GeometryCore::getNTriangles() const {
 }
 
 
+GLenum GeometryCore::getPrimitiveType() const {
+  return primitiveType_;
+}
+
+
+DrawMode GeometryCore::getDrawMode() const {
+  return drawMode_;
+}
+
+
+GLsizei GeometryCore::getNElements() const {
+  return nElements_;
+}
+
+
+const std::vector<VertexAttribute>& GeometryCore::getVertexAttributes() const {
+  return attributes_;
+}
+
+
+bool GeometryCore::hasBoundingBox() const {
+  return hasBoundingBox_;
+}
+
+
+const glm::vec3& GeometryCore::getBoundingBoxMin() const {
+  return boundingBoxMin_;
+}
+
+
+const glm::vec3& GeometryCore::getBoundingBoxMax() const {
+  return boundingBoxMax_;
+}
+
+
+size_t GeometryCore::getBufferSize() const {
+  size_t size = static_cast<size_t>(indexSize_);
+  for (auto& attribute : attributes_) {
+    size += static_cast<size_t>(attribute.size);
+  }
+  return size;
+}
+
+
+void GeometryCore::readAttributeData(const VertexAttribute& attribute, std::vector<GLfloat>& data) const {
+  data.resize(attribute.size / sizeof(GLfloat));
+  glBindBuffer(GL_ARRAY_BUFFER, attribute.vbo);
+  glGetBufferSubData(GL_ARRAY_BUFFER, 0, data.size() * sizeof(GLfloat), data.data());
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  assert(!checkGLError());
+}
+
+
+void GeometryCore::readElementIndexData(std::vector<GLuint>& data) const {
+  data.resize(indexSize_ / sizeof(GLuint));
+  if (!data.empty()) {
+    // Note: element array binding is part of VAO state
+    glBindVertexArray(vao_);
+    glGetBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, data.size() * sizeof(GLuint), data.data());
+    glBindVertexArray(0);
+  }
+
+  assert(!checkGLError());
+}
+
+
 void GeometryCore::render(RenderState* renderState) {
   // pass matrices and other state variables to shader
   renderState->passToShader();
@@ -134,9 +224,27 @@ void GeometryCore::render(RenderState* renderState) {
   assert(drawFunc_ != nullptr);
   drawFunc_(primitiveType_, nElements_);
   glBindVertexArray(0);
+  ++renderState->stats.nDrawCalls;
+  renderState->stats.addPrimitives(primitiveType_, nElements_);
 
   assert(!checkGLError());
 }
 
 
+void GeometryCore::setDebugLabel(const std::string& label) {
+  if (!GLDebug::isActive()) {
+    return;
+  }
+  // vertex array object exists only after it has been bound
+  if (glIsVertexArray(vao_)) {
+    GLDebug::setObjectLabel(GL_VERTEX_ARRAY, vao_, label);
+  }
+  for (auto& attribute : attributes_) {
+    GLDebug::setObjectLabel(GL_BUFFER, attribute.vbo,
+        label + " [attribute " + std::to_string(attribute.location) + "]");
+  }
+  GLDebug::setObjectLabel(GL_BUFFER, vboIndex_, label + " [indices]");
+}
+
+
 } /* namespace scg */
@@ -29,6 +29,7 @@
 #include <vector>
 #include "scg_glew_glad.h"
 #include "Core.h"
+#include "scg_glm.h"
 #include "scg_internals.h"
 
 namespace scg {
@@ -43,12 +44,25 @@ enum class DrawMode {
 };
 
 
+/**
+ * \brief Vertex attribute stored in its own vertex buffer object (VBO).
+ */
+struct VertexAttribute {
+  GLuint location;
+  GLint dim;
+  GLuint vbo;
+  GLsizeiptr size;
+};
+
+
 /**
  * \brief A core that contains geometry information to be rendered.
  *
  * Vertices and indices are stored in vertex buffer objects (VBOs).
  * Each geometry core has its own vertex array object (VAO) that is used to
  * store attribute and element index bindings.
+ * The axis-aligned bounding box of the vertex positions (attribute location
+ * OGLConstants::VERTEX) is computed when the vertex data is added, e.g., for culling.
  */
 class GeometryCore: public Core {
 
@@ -99,20 +113,79 @@ public:
    */
   int getNTriangles() const;
 
+  /**
+   * Get primitive type.
+   */
+  GLenum getPrimitiveType() const;
+
+  /**
+   * Get draw mode.
+   */
+  DrawMode getDrawMode() const;
+
+  /**
+   * Get number of vertices (DrawMode::ARRAYS) or element indices (DrawMode::ELEMENTS) to be drawn.
+   */
+  GLsizei getNElements() const;
+
+  /**
+   * Get vertex attributes in the order they have been added.
+   */
+  const std::vector<VertexAttribute>& getVertexAttributes() const;
+
+  /**
+   * Check if bounding box is available, i.e., if vertex positions have been added.
+   */
+  bool hasBoundingBox() const;
+
+  /**
+   * Get minimum corner of bounding box in model coordinates.
+   */
+  const glm::vec3& getBoundingBoxMin() const;
+
+  /**
+   * Get maximum corner of bounding box in model coordinates.
+   */
+  const glm::vec3& getBoundingBoxMax() const;
+
+  /**
+   * Get total size of vertex attribute and element index buffers (bytes).
+   */
+  size_t getBufferSize() const;
+
+  /**
+   * Read back vertex attribute data from its VBO, e.g., to merge geometry into a StaticBatch.
+   */
+  void readAttributeData(const VertexAttribute& attribute, std::vector<GLfloat>& data) const;
+
+  /**
+   * Read back element index data from its VBO (empty for DrawMode::ARRAYS).
+   */
+  void readElementIndexData(std::vector<GLuint>& data) const;
+
   /**
    * Render geometry.
    */
   virtual void render(RenderState* renderState);
 
+  /**
+   * Label vertex array object and its buffers for GL debuggers (cf. GLDebug).
+   */
+  virtual void setDebugLabel(const std::string& label);
+
 protected:
 
   GLenum primitiveType_;
   DrawMode drawMode_;
   std::function<void(GLenum, GLsizei)> drawFunc_;
   GLuint vao_;
-  std::vector<GLuint> vboAttributes_;
+  std::vector<VertexAttribute> attributes_;
   GLuint vboIndex_;
+  GLsizeiptr indexSize_;
   GLsizei nElements_;
+  bool hasBoundingBox_;
+  glm::vec3 boundingBoxMin_;
+  glm::vec3 boundingBoxMax_;
 
 };
 
@@ -27,6 +27,7 @@
 
 #include <string>
 #include <vector>
+#include "MeshFactory.h"
 #include "scg_glew_glad.h"
 #include "scg_glm.h"
 #include "scg_internals.h"
@@ -36,6 +37,9 @@ namespace scg {
 
 /**
  * \brief A factory to create geometry cores.
+ *
+ * The mesh data is created by a MeshFactory (without OpenGL context) and realized as
+ * geometry core by createGeometry(), which creates the vertex buffer objects.
  */
 class GeometryCoreFactory {
 
@@ -67,6 +71,23 @@ public:
    */
   void addFilePath(const std::string& filePath);
 
+  /**
+   * Set resource cache to share geometry cores created with identical parameters
+   * (nullptr: no caching, default).
+   */
+  void setResourceCache(ResourceCacheSP resourceCache);
+
+  /**
+   * Get resource cache (nullptr if caching is disabled).
+   */
+  ResourceCacheSP getResourceCache() const;
+
+  /**
+   * Create geometry core from mesh data, i.e., upload vertex attributes and element indices
+   * into vertex buffer objects (requires OpenGL context). The result is not cached.
+   */
+  GeometryCoreSP createGeometry(const MeshData& mesh);
+
   /**
    * Load model from OBJ Wavefront file.
    *
@@ -197,55 +218,21 @@ public:
 protected:
 
   /**
-   * A vertex entry of a face definition of an OBJ file.
+   * Find geometry core in resource cache (if any).
+   * \return cached core, or nullptr
    */
-  struct FaceEntry {
-    FaceEntry()
-        : vertex(0), texCoord(0), normal(0) {
-    }
-    int vertex;
-    int texCoord;
-    int normal;
-  };
+  GeometryCoreSP findCached_(const std::string& key) const;
 
   /**
-   * A face definition of an OBJ file.
-   */
-  struct Face{
-    Face()
-        : nTriangles(0) {
-    }
-    int nTriangles;
-    std::vector<FaceEntry> entries;
-  };
-
-  /**
-   * A model stored in an OBJ file.
-   */
-  struct OBJModel {
-    OBJModel()
-        : nVertices(0), nTriangles(0) {
-    }
-    int nVertices;
-    int nTriangles;
-    std::vector<glm::vec3> vertices;
-    std::vector<glm::vec2> texCoords;
-    std::vector<glm::vec3> normals;
-    std::vector<Face> faces;
-  };
-
-  /**
-   * Load and parse an OBJ Wavefront file and create a model.
-   *
-   * Only the follwoing OBJ tags are used: v, vt, vn, f.
-   * If normals are not definied explicitly, they are created separately for each triangle
-   * (as in the case of flat shading); no smoothing of normals is applied.
+   * Insert geometry core into resource cache (if any).
    */
-  int loadOBJFile_(const std::string& fileName, OBJModel& model) const;
+  void insertCached_(const std::string& key, GeometryCoreSP core) const;
 
 protected:
 
   std::vector<std::string> filePaths_;
+  MeshFactory meshFactory_;
+  ResourceCacheSP resourceCache_;
 
 };
 
@@ -25,8 +25,11 @@
 #include "Camera.h"
 #include "Group.h"
 #include "Light.h"
+#include "LightCluster.h"
 #include "LightPosition.h"
+#include "ShadowMap.h"
 #include "Shape.h"
+#include "StaticBatch.h"
 #include "Transformation.h"
 
 namespace scg {
@@ -74,6 +77,13 @@ void InfoTraverser::visitShape(Shape* node) {
 }
 
 
+void InfoTraverser::visitStaticBatch(StaticBatch* node) {
+  nNodes_++;
+  nCores_ += node->getNCores();
+  node->traverseNodes(this);
+}
+
+
 void InfoTraverser::visitCamera(Camera* node) {
   nNodes_++;
   nCores_ += node->getNCores();
@@ -92,6 +102,18 @@ void InfoTraverser::visitLight(Light* node) {
 }
 
 
+void InfoTraverser::visitLightCluster(LightCluster* node) {
+  nNodes_++;
+  nCores_ += node->getNCores();
+}
+
+
+void InfoTraverser::visitShadowMap(ShadowMap* node) {
+  nNodes_++;
+  nCores_ += node->getNCores();
+}
+
+
 void InfoTraverser::visitTransformation(Transformation* node) {
   nNodes_++;
   nCores_ += node->getNCores();
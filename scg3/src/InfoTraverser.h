@@ -80,6 +80,12 @@ public:
    */
   virtual void visitShape(Shape* node);
 
+  /**
+   * Visit StaticBatch node, update nNodes_, nCores_, and nTriangles_
+   * (including the batched sub-trees).
+   */
+  virtual void visitStaticBatch(StaticBatch* node);
+
   // composite nodes
 
   /**
@@ -97,6 +103,16 @@ public:
    */
   virtual void visitLight(Light* node);
 
+  /**
+   * Visit LightCluster node, update nNodes_ and nCores_.
+   */
+  virtual void visitLightCluster(LightCluster* node);
+
+  /**
+   * Visit ShadowMap node, update nNodes_ and nCores_.
+   */
+  virtual void visitShadowMap(ShadowMap* node);
+
   /**
    * Visit Transformation node, update nNodes_ and nCores_.
    */
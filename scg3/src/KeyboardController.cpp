@@ -21,12 +21,15 @@
  * limitations under the License.
  */
 
+#include <exception>
 #include <iostream>
 #include "scg_glew_glad.h"
 #include <GLFW/glfw3.h>
 #include "Camera.h"
 #include "KeyboardController.h"
 #include "scg_glm.h"
+#include "scg_utilities.h"
+#include "Tracer.h"
 #include "ViewState.h"
 
 namespace scg {
@@ -52,6 +55,8 @@ KeyboardController::KeyboardController(CameraSP camera)
   std::cout << "- j: toggle center point visibility" << std::endl;
   std::cout << "- k: toggle mouse cursor visibility" << std::endl;
   std::cout << "- l: toggle polygon mode (fill/line)" << std::endl;
+  std::cout << "- p: toggle performance HUD (frame times, render statistics, memory)" << std::endl;
+  std::cout << "- t: toggle tracing, write scg3_trace.json when switched off" << std::endl;
   std::cout << std::endl;
 }
 
@@ -67,11 +72,11 @@ KeyboardControllerSP KeyboardController::create(CameraSP camera) {
 
 void KeyboardController::checkInput(ViewState* viewState) {
   // initialize controller state
-  static double lastTime(glfwGetTime());
+  static double lastTime(getTime());
   GLFWwindow* window = viewState->getWindow();
 
   // determine time difference
-  double currTime = glfwGetTime();
+  double currTime = getTime();
   GLfloat diffTime = static_cast<GLfloat>(currTime - lastTime);
   lastTime = currTime;
 
@@ -244,6 +249,41 @@ void KeyboardController::checkInput(ViewState* viewState) {
     toggleKeyL = false;
   }
 
+  // toggle performance HUD
+  static bool toggleKeyP = false;
+  if (glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS && !toggleKeyP) {
+    viewState->setHUDVisible(!viewState->isHUDVisible());
+    toggleKeyP = true;
+  }
+  if (glfwGetKey(window, GLFW_KEY_P) == GLFW_RELEASE) {
+    toggleKeyP = false;
+  }
+
+  // toggle tracing, write trace file when switched off
+  static bool toggleKeyT = false;
+  if (glfwGetKey(window, GLFW_KEY_T) == GLFW_PRESS && !toggleKeyT) {
+    if (!Tracer::isEnabled()) {
+      Tracer::clear();
+      Tracer::setEnabled(true);
+      std::cout << "Tracing enabled" << std::endl;
+    }
+    else {
+      Tracer::setEnabled(false);
+      try {
+        Tracer::writeChromeTrace("scg3_trace.json");
+        std::cout << "Tracing disabled, " << Tracer::getNEvents()
+            << " events written to scg3_trace.json" << std::endl;
+      }
+      catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+      }
+    }
+    toggleKeyT = true;
+  }
+  if (glfwGetKey(window, GLFW_KEY_T) == GLFW_RELEASE) {
+    toggleKeyT = false;
+  }
+
   // continuous flight action
   camera_->translate(glm::vec3(0.0f, 0.0f, flightVelocity_ * diffTime));
 }
@@ -21,7 +21,10 @@
  * limitations under the License.
  */
 
+#include "FrameProfiler.h"
+#include "GLDebug.h"
 #include "Leaf.h"
+#include "Traverser.h"
 
 namespace scg {
 
@@ -37,8 +40,27 @@ Leaf::~Leaf() {
 void Leaf::traverse(Traverser* traverser) {
   // check if node is visible
   if (isVisible_) {
+    // time node if tagged for profiling
+    FrameProfiler* profiler = isProfiled_ ? traverser->getFrameProfiler() : nullptr;
+    if (profiler) {
+      profiler->beginNode(this);
+    }
+
+    // enclose node in debug group if labeled
+    bool isDebugGroup = isLabeled_ && GLDebug::isActive();
+    if (isDebugGroup) {
+      GLDebug::pushGroup(getMetaInfo(GLDebug::META_INFO_KEY).c_str());
+    }
+
     // process node
     accept(traverser);
+
+    if (isDebugGroup) {
+      GLDebug::popGroup();
+    }
+    if (profiler) {
+      profiler->endScope();
+    }
   }
 
   // recursively traverse siblings (if any)
@@ -115,6 +115,26 @@ public:
    */
   Light* setSpot(const glm::vec3& direction, float cutoffDeg, float exponent);
 
+  /**
+   * Get light position in model coordinates (w = 0 for directional light).
+   */
+  const glm::vec4& getPosition() const;
+
+  /**
+   * Get spot direction in model coordinates (not normalized).
+   */
+  const glm::vec4& getSpotDirection() const;
+
+  /**
+   * Get cosine of spot cutoff angle, 0 if the light is no spotlight.
+   */
+  float getSpotCosCutoff() const;
+
+  /**
+   * Get model transformation as set by PreTraverser.
+   */
+  const glm::mat4& getModelTransform() const;
+
   /**
    * Set model transformation from scene graph location,
    * to be called by PreTraverser.
@@ -122,10 +142,18 @@ public:
   void setModelTransform(const glm::mat4 modelTransform);
 
   /**
-   * Initialize light, i.e., create UBO.
+   * Initialize light, i.e., pack constant parameters into std140 layout.
+   * Parameters set after init() take effect when init() is called again.
    */
   void init();
 
+  /**
+   * Write light parameters in std140 layout (BUFFER_SIZE bytes), with position,
+   * half vector, and spot direction transformed into eye coordinates,
+   * to be called by RenderState.
+   */
+  void writeBuffer(GLubyte* buffer, const glm::mat4& viewTransform) const;
+
   /**
    * Accept traverser.
    */
@@ -137,7 +165,7 @@ public:
   virtual void acceptPost(Traverser* traverser);
 
   /**
-   * Render light, i.e., add light to render state and bind UBO.
+   * Render light, i.e., add light to render state.
    */
   virtual void render(RenderState* renderState);
 
@@ -163,7 +191,7 @@ public:
 
 protected:
 
-  GLuint ubo_;          // uniform buffer object
+  GLubyte buffer_[BUFFER_SIZE];   // constant parameters in std140 layout
   glm::vec4 position_;
   glm::vec4 ambient_;
   glm::vec4 diffuse_;
@@ -0,0 +1,546 @@
+/**
+ * \file LightCluster.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include "Light.h"
+#include "LightCluster.h"
+#include "RenderState.h"
+#include "Tracer.h"
+#include "Traverser.h"
+#include "scg_utilities.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCG_LIGHT_CLUSTER_SSE
+#include <emmintrin.h>
+#endif
+
+namespace scg {
+
+
+namespace {
+
+// buffer texture samplers, in order of LightCluster::tbo_ and tex_
+const OGLSampler* const CLUSTER_SAMPLERS[3] = {
+    &OGLConstants::CLUSTER_LIGHTS, &OGLConstants::CLUSTER_LIGHT_INDICES,
+    &OGLConstants::CLUSTER_GRID };
+
+// buffer texture formats, in order of LightCluster::tbo_ and tex_
+const GLenum CLUSTER_FORMATS[3] = { GL_RGBA32F, GL_R32UI, GL_RG32UI };
+
+// minimum clip coordinate w of bounding box corners in front of the eye
+const float MIN_CLIP_W = 1e-4f;
+
+}
+
+
+LightCluster::LightCluster()
+    : nx_(16), ny_(9), nz_(24), nThreads_(0), isPerspective_(true), near_(0.1f), far_(100.f),
+      depthScale_(1.f), depthBias_(0.f), ubo_(0), tbo_(), tex_(), maxTexels_(0),
+      uboOld_(0), texOld_(), updateTime_(0.), nBinThreads_(1), nBusyWorkers_(0),
+      updateIndex_(0), isStopped_(false) {
+}
+
+
+LightCluster::~LightCluster() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  requestCondition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  if (isGLContextActive()) {
+    clearBuffers_();
+  }
+}
+
+
+LightClusterSP LightCluster::create() {
+  return std::make_shared<LightCluster>();
+}
+
+
+LightCluster* LightCluster::addLight(LightSP light, float range) {
+  assert(light);
+  assert(range >= 0.f);
+  lights_.push_back(light);
+  ranges_.push_back(range);
+  return this;
+}
+
+
+LightCluster* LightCluster::clearLights() {
+  lights_.clear();
+  ranges_.clear();
+  return this;
+}
+
+
+int LightCluster::getNLights() const {
+  return static_cast<int>(lights_.size());
+}
+
+
+LightCluster* LightCluster::setGridSize(int nx, int ny, int nz) {
+  assert(nx > 0 && ny > 0 && nz > 0);
+  nx_ = nx;
+  ny_ = ny;
+  nz_ = nz;
+  return this;
+}
+
+
+LightCluster* LightCluster::setNThreads(int nThreads) {
+  assert(nThreads >= 0);
+  nThreads_ = nThreads;
+  return this;
+}
+
+
+int LightCluster::getNLightIndices() const {
+  return static_cast<int>(indexData_.size());
+}
+
+
+double LightCluster::getUpdateTime() const {
+  return updateTime_;
+}
+
+
+void LightCluster::update(RenderState* renderState) {
+  double startTime = getTime();
+  if (ubo_ == 0) {
+    createBuffers_();
+  }
+
+  // light parameters and bounding spheres in eye coordinates
+  const size_t nLights = lights_.size();
+  const size_t lightFloats = 4 * LIGHT_TEXELS;
+  static_assert(4 * LIGHT_TEXELS * sizeof(float) == Light::BUFFER_SIZE,
+      "light texels do not match light buffer size");
+  lightData_.resize(std::max(nLights, static_cast<size_t>(1)) * lightFloats);
+  spheres_.resize(nLights);
+  for (size_t i = 0; i < nLights; ++i) {
+    float* data = &lightData_[i * lightFloats];
+    lights_[i]->writeBuffer(reinterpret_cast<GLubyte*>(data), renderState->getViewTransform());
+    data[lightFloats - 2] = ranges_[i];
+    // directional lights (w = 0) are applied to all clusters
+    float range = (data[3] < 0.001f) ? 0.f : ranges_[i];
+    spheres_[i] = glm::vec4(data[0], data[1], data[2], range);
+  }
+
+  // depth range and slice parameters of camera projection
+  const glm::mat4& projection = renderState->getProjection();
+  isPerspective_ = std::fabs(projection[3][3]) < 1e-6f;
+  if (isPerspective_) {
+    near_ = projection[3][2] / (projection[2][2] - 1.f);
+    far_ = projection[3][2] / (projection[2][2] + 1.f);
+    if (!(far_ > near_) || far_ > 1e6f * near_) {   // infinite far plane
+      far_ = 1e6f * near_;
+    }
+    depthScale_ = nz_ / std::log(far_ / near_);
+    depthBias_ = -std::log(near_) * depthScale_;
+  }
+  else {
+    near_ = (projection[3][2] + 1.f) / projection[2][2];
+    far_ = (projection[3][2] - 1.f) / projection[2][2];
+    depthScale_ = nz_ / (far_ - near_);
+    depthBias_ = -near_ * depthScale_;
+  }
+
+  // compute cluster ranges of all lights
+  bounds_.resize(nLights);
+  computeBounds_(projection, 0, nLights);
+
+  // bin lights into clusters, each thread processes a range of depth slices
+  gridData_.assign(2 * nx_ * ny_ * nz_, 0);
+  int nThreads = (nThreads_ > 0) ? nThreads_
+      : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  nThreads = std::min(std::min(nThreads, nz_), static_cast<int>(nLights / 64) + 1);
+  if (static_cast<int>(threadIndices_.size()) < nThreads) {
+    threadIndices_.resize(nThreads);
+  }
+  if (nThreads > 1) {
+    startWorkers_(nThreads - 1);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      nBinThreads_ = nThreads;
+      nBusyWorkers_ = nThreads - 1;
+      ++updateIndex_;
+    }
+    requestCondition_.notify_all();
+  }
+  binLights_(0, nz_ / nThreads, threadIndices_[0]);
+  if (nThreads > 1) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return nBusyWorkers_ == 0; });
+  }
+
+  // concatenate light indices, offsets become absolute
+  indexData_.clear();
+  for (int t = 0; t < nThreads; ++t) {
+    const GLuint offset = static_cast<GLuint>(indexData_.size());
+    const int c0 = nx_ * ny_ * (nz_ * t / nThreads);
+    const int c1 = nx_ * ny_ * (nz_ * (t + 1) / nThreads);
+    for (int c = c0; c < c1; ++c) {
+      gridData_[2 * c] += offset;
+    }
+    indexData_.insert(indexData_.end(), threadIndices_[t].begin(), threadIndices_[t].end());
+  }
+  if (static_cast<GLint>(nLights) * LIGHT_TEXELS > maxTexels_
+      || static_cast<GLint>(indexData_.size()) > maxTexels_) {
+    throw std::runtime_error("Number of lights or light indices exceeds maximum buffer texture size"
+        " [LightCluster::update()]");
+  }
+
+  // upload buffer textures
+  glBindBuffer(GL_TEXTURE_BUFFER, tbo_[0]);
+  glBufferData(GL_TEXTURE_BUFFER, lightData_.size() * sizeof(float), lightData_.data(),
+      GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, tbo_[1]);
+  glBufferData(GL_TEXTURE_BUFFER, std::max(indexData_.size(), static_cast<size_t>(1)) * sizeof(GLuint),
+      indexData_.empty() ? nullptr : indexData_.data(), GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, tbo_[2]);
+  glBufferData(GL_TEXTURE_BUFFER, gridData_.size() * sizeof(GLuint), gridData_.data(),
+      GL_STREAM_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+  // upload uniform block: grid size and depth mode, viewport, depth slice parameters
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  const GLint gridSize[4] = { nx_, ny_, nz_, isPerspective_ ? 1 : 0 };
+  const GLfloat params[8] = {
+      static_cast<GLfloat>(viewport[0]), static_cast<GLfloat>(viewport[1]),
+      static_cast<GLfloat>(viewport[2]), static_cast<GLfloat>(viewport[3]),
+      depthScale_, depthBias_, 0.f, 0.f };
+  GLubyte block[BLOCK_SIZE];
+  memcpy(block, gridSize, sizeof(gridSize));
+  memcpy(block + sizeof(gridSize), params, sizeof(params));
+  glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  glBufferData(GL_UNIFORM_BUFFER, BLOCK_SIZE, block, GL_STREAM_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  renderState->stats.nUploadedBytes += static_cast<long>((lightData_.size() + indexData_.size()
+      + gridData_.size()) * 4 + BLOCK_SIZE);
+
+  updateTime_ = 1000. * (getTime() - startTime);
+
+  assert(!checkGLError());
+}
+
+
+void LightCluster::accept(Traverser* traverser) {
+  traverser->visitLightCluster(this);
+}
+
+
+void LightCluster::acceptPost(Traverser* traverser) {
+  traverser->visitPostLightCluster(this);
+}
+
+
+void LightCluster::render(RenderState* renderState) {
+  update(renderState);
+
+  // bind uniform block and buffer textures, save previous bindings
+  glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, OGLConstants::LIGHT_CLUSTER.bindingPoint, &uboOld_);
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::LIGHT_CLUSTER.bindingPoint, ubo_);
+  for (int i = 0; i < 3; ++i) {
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_SAMPLERS[i]->texUnit);
+    glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld_[i]);
+    glBindTexture(GL_TEXTURE_BUFFER, tex_[i]);
+  }
+  glActiveTexture(GL_TEXTURE0);
+  ++renderState->stats.nBufferBinds;
+  renderState->stats.nTextureBinds += 3;
+
+  assert(!checkGLError());
+}
+
+
+void LightCluster::renderPost(RenderState* renderState) {
+  // restore previous bindings
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::LIGHT_CLUSTER.bindingPoint, uboOld_);
+  for (int i = 0; i < 3; ++i) {
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_SAMPLERS[i]->texUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, texOld_[i]);
+  }
+  glActiveTexture(GL_TEXTURE0);
+
+  assert(!checkGLError());
+}
+
+
+void LightCluster::computeBounds_(const glm::mat4& projection, size_t first, size_t last) {
+  size_t i = first;
+  float ndcBounds[4];
+
+#ifdef SCG_LIGHT_CLUSTER_SSE
+  // project the 8 bounding box corners of 4 lights at once
+  const __m128 px[4] = { _mm_set1_ps(projection[0][0]), _mm_set1_ps(projection[1][0]),
+      _mm_set1_ps(projection[2][0]), _mm_set1_ps(projection[3][0]) };
+  const __m128 py[4] = { _mm_set1_ps(projection[0][1]), _mm_set1_ps(projection[1][1]),
+      _mm_set1_ps(projection[2][1]), _mm_set1_ps(projection[3][1]) };
+  const __m128 pw[4] = { _mm_set1_ps(projection[0][3]), _mm_set1_ps(projection[1][3]),
+      _mm_set1_ps(projection[2][3]), _mm_set1_ps(projection[3][3]) };
+  const __m128 minClipW = _mm_set1_ps(MIN_CLIP_W);
+  for (; i + 4 <= last; i += 4) {
+    // transpose spheres into center x, y, z and radius of 4 lights
+    __m128 cx = _mm_loadu_ps(glm::value_ptr(spheres_[i]));
+    __m128 cy = _mm_loadu_ps(glm::value_ptr(spheres_[i + 1]));
+    __m128 cz = _mm_loadu_ps(glm::value_ptr(spheres_[i + 2]));
+    __m128 r = _mm_loadu_ps(glm::value_ptr(spheres_[i + 3]));
+    _MM_TRANSPOSE4_PS(cx, cy, cz, r);
+
+    __m128 minX = _mm_set1_ps(std::numeric_limits<float>::max());
+    __m128 minY = minX;
+    __m128 maxX = _mm_set1_ps(-std::numeric_limits<float>::max());
+    __m128 maxY = maxX;
+    __m128 isBehindEye = _mm_setzero_ps();
+    for (int corner = 0; corner < 8; ++corner) {
+      __m128 x = (corner & 1) ? _mm_add_ps(cx, r) : _mm_sub_ps(cx, r);
+      __m128 y = (corner & 2) ? _mm_add_ps(cy, r) : _mm_sub_ps(cy, r);
+      __m128 z = (corner & 4) ? _mm_add_ps(cz, r) : _mm_sub_ps(cz, r);
+      __m128 clipX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px[0], x), _mm_mul_ps(px[1], y)),
+          _mm_add_ps(_mm_mul_ps(px[2], z), px[3]));
+      __m128 clipY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(py[0], x), _mm_mul_ps(py[1], y)),
+          _mm_add_ps(_mm_mul_ps(py[2], z), py[3]));
+      __m128 clipW = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pw[0], x), _mm_mul_ps(pw[1], y)),
+          _mm_add_ps(_mm_mul_ps(pw[2], z), pw[3]));
+      isBehindEye = _mm_or_ps(isBehindEye, _mm_cmple_ps(clipW, minClipW));
+      __m128 invW = _mm_div_ps(_mm_set1_ps(1.f), _mm_max_ps(clipW, minClipW));
+      __m128 ndcX = _mm_mul_ps(clipX, invW);
+      __m128 ndcY = _mm_mul_ps(clipY, invW);
+      minX = _mm_min_ps(minX, ndcX);
+      maxX = _mm_max_ps(maxX, ndcX);
+      minY = _mm_min_ps(minY, ndcY);
+      maxY = _mm_max_ps(maxY, ndcY);
+    }
+
+    float bounds[4][4];
+    _mm_storeu_ps(bounds[0], minX);
+    _mm_storeu_ps(bounds[1], maxX);
+    _mm_storeu_ps(bounds[2], minY);
+    _mm_storeu_ps(bounds[3], maxY);
+    int behindMask = _mm_movemask_ps(isBehindEye);
+    for (int k = 0; k < 4; ++k) {
+      ndcBounds[0] = bounds[0][k];
+      ndcBounds[1] = bounds[1][k];
+      ndcBounds[2] = bounds[2][k];
+      ndcBounds[3] = bounds[3][k];
+      setBounds_(i + k, ndcBounds, (behindMask & (1 << k)) != 0);
+    }
+  }
+#endif
+
+  // remaining lights
+  for (; i < last; ++i) {
+    const glm::vec4& sphere = spheres_[i];
+    ndcBounds[0] = ndcBounds[2] = std::numeric_limits<float>::max();
+    ndcBounds[1] = ndcBounds[3] = -std::numeric_limits<float>::max();
+    bool isBehindEye = false;
+    for (int corner = 0; corner < 8; ++corner) {
+      glm::vec4 clip = projection * glm::vec4(
+          sphere.x + ((corner & 1) ? sphere.w : -sphere.w),
+          sphere.y + ((corner & 2) ? sphere.w : -sphere.w),
+          sphere.z + ((corner & 4) ? sphere.w : -sphere.w), 1.f);
+      isBehindEye |= (clip.w <= MIN_CLIP_W);
+      float invW = 1.f / std::max(clip.w, MIN_CLIP_W);
+      ndcBounds[0] = std::min(ndcBounds[0], clip.x * invW);
+      ndcBounds[1] = std::max(ndcBounds[1], clip.x * invW);
+      ndcBounds[2] = std::min(ndcBounds[2], clip.y * invW);
+      ndcBounds[3] = std::max(ndcBounds[3], clip.y * invW);
+    }
+    setBounds_(i, ndcBounds, isBehindEye);
+  }
+}
+
+
+void LightCluster::setBounds_(size_t index, const float* ndcBounds, bool isBehindEye) {
+  const glm::vec4& sphere = spheres_[index];
+  LightBounds& bounds = bounds_[index];
+
+  // unlimited range: all clusters
+  if (sphere.w <= 0.f) {
+    bounds = { 0, nx_ - 1, 0, ny_ - 1, 0, nz_ - 1 };
+    return;
+  }
+
+  // cull lights outside view frustum (x0 > x1)
+  float depth0 = -sphere.z - sphere.w;
+  float depth1 = -sphere.z + sphere.w;
+  bool isCulled = depth1 < near_ || depth0 > far_;
+  if (!isBehindEye) {
+    isCulled = isCulled || ndcBounds[1] < -1.f || ndcBounds[0] > 1.f
+        || ndcBounds[3] < -1.f || ndcBounds[2] > 1.f;
+  }
+  if (isCulled) {
+    bounds = { 1, 0, 1, 0, 1, 0 };
+    return;
+  }
+
+  // depth slices, screen tiles (all tiles if the bounding box intersects the eye plane)
+  bounds.z0 = getSlice_(std::max(depth0, near_));
+  bounds.z1 = getSlice_(std::min(depth1, far_));
+  if (isBehindEye) {
+    bounds.x0 = 0;
+    bounds.x1 = nx_ - 1;
+    bounds.y0 = 0;
+    bounds.y1 = ny_ - 1;
+  }
+  else {
+    bounds.x0 = std::max(0, static_cast<int>(std::floor((ndcBounds[0] * 0.5f + 0.5f) * nx_)));
+    bounds.x1 = std::min(nx_ - 1, static_cast<int>(std::floor((ndcBounds[1] * 0.5f + 0.5f) * nx_)));
+    bounds.y0 = std::max(0, static_cast<int>(std::floor((ndcBounds[2] * 0.5f + 0.5f) * ny_)));
+    bounds.y1 = std::min(ny_ - 1, static_cast<int>(std::floor((ndcBounds[3] * 0.5f + 0.5f) * ny_)));
+  }
+}
+
+
+int LightCluster::getSlice_(float depth) const {
+  float slice = (isPerspective_ ? std::log(depth) : depth) * depthScale_ + depthBias_;
+  return std::min(nz_ - 1, std::max(0, static_cast<int>(std::floor(slice))));
+}
+
+
+void LightCluster::binLights_(int z0, int z1, std::vector<GLuint>& indices) {
+  const int nClusters = nx_ * ny_ * (z1 - z0);
+  GLuint* grid = gridData_.data() + 2 * nx_ * ny_ * z0;
+
+  // count lights per cluster
+  for (const auto& bounds : bounds_) {
+    for (int z = std::max(bounds.z0, z0); z <= std::min(bounds.z1, z1 - 1); ++z) {
+      for (int y = bounds.y0; y <= bounds.y1; ++y) {
+        GLuint* cluster = grid + 2 * (((z - z0) * ny_ + y) * nx_ + bounds.x0);
+        for (int x = bounds.x0; x <= bounds.x1; ++x, cluster += 2) {
+          ++cluster[1];
+        }
+      }
+    }
+  }
+
+  // compute offsets, reset counts
+  GLuint offset = 0;
+  for (int c = 0; c < nClusters; ++c) {
+    grid[2 * c] = offset;
+    offset += grid[2 * c + 1];
+    grid[2 * c + 1] = 0;
+  }
+
+  // fill light indices
+  indices.resize(offset);
+  for (size_t i = 0; i < bounds_.size(); ++i) {
+    const LightBounds& bounds = bounds_[i];
+    for (int z = std::max(bounds.z0, z0); z <= std::min(bounds.z1, z1 - 1); ++z) {
+      for (int y = bounds.y0; y <= bounds.y1; ++y) {
+        GLuint* cluster = grid + 2 * (((z - z0) * ny_ + y) * nx_ + bounds.x0);
+        for (int x = bounds.x0; x <= bounds.x1; ++x, cluster += 2) {
+          indices[cluster[0] + cluster[1]++] = static_cast<GLuint>(i);
+        }
+      }
+    }
+  }
+}
+
+
+void LightCluster::startWorkers_(int nWorkers) {
+  for (int t = static_cast<int>(workers_.size()) + 1; t <= nWorkers; ++t) {
+    workers_.push_back(std::thread(&LightCluster::runWorker_, this, t, updateIndex_));
+  }
+}
+
+
+void LightCluster::runWorker_(int threadIndex, long updateIndex) {
+  Tracer::setThreadName("light cluster");
+  while (true) {
+    int nThreads;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      requestCondition_.wait(lock,
+          [&]() { return isStopped_ || updateIndex_ != updateIndex; });
+      if (isStopped_) {
+        return;
+      }
+      updateIndex = updateIndex_;
+      nThreads = nBinThreads_;
+    }
+    if (threadIndex >= nThreads) {
+      continue;
+    }
+
+    binLights_(nz_ * threadIndex / nThreads, nz_ * (threadIndex + 1) / nThreads,
+        threadIndices_[threadIndex]);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nBusyWorkers_;
+    }
+    doneCondition_.notify_one();
+  }
+}
+
+
+void LightCluster::createBuffers_() {
+  glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels_);
+
+  // uniform block
+  glGenBuffers(1, &ubo_);
+  glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  glBufferData(GL_UNIFORM_BUFFER, BLOCK_SIZE, nullptr, GL_STREAM_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+  // buffer textures
+  glGenBuffers(3, tbo_);
+  glGenTextures(3, tex_);
+  for (int i = 0; i < 3; ++i) {
+    glBindBuffer(GL_TEXTURE_BUFFER, tbo_[i]);
+    glBufferData(GL_TEXTURE_BUFFER, 16, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_SAMPLERS[i]->texUnit);
+    GLint texOld = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld);
+    glBindTexture(GL_TEXTURE_BUFFER, tex_[i]);
+    glTexBuffer(GL_TEXTURE_BUFFER, CLUSTER_FORMATS[i], tbo_[i]);
+    glBindTexture(GL_TEXTURE_BUFFER, texOld);
+  }
+  glActiveTexture(GL_TEXTURE0);
+
+  assert(!checkGLError());
+}
+
+
+void LightCluster::clearBuffers_() {
+  if (ubo_ != 0) {
+    glDeleteBuffers(1, &ubo_);
+    glDeleteBuffers(3, tbo_);
+    glDeleteTextures(3, tex_);
+    ubo_ = 0;
+  }
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,258 @@
+/**
+ * \file LightCluster.h
+ * \brief A set of many point and spot lights applied to all nodes of its sub-tree by clustered forward shading (composite node).
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LIGHTCLUSTER_H_
+#define LIGHTCLUSTER_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Composite.h"
+#include "scg_glew_glad.h"
+#include "scg_glm.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A set of many point and spot lights applied to all nodes of its sub-tree
+ *    by clustered forward shading (composite node).
+ *
+ * In contrast to Light nodes, whose number is limited to OGLConstants::MAX_NUMBER_OF_LIGHTS,
+ * a light cluster may hold thousands of lights. The view frustum is divided into
+ * a grid of clusters (screen tiles times depth slices, logarithmic for perspective
+ * projections). For each frame, the lights are binned into the clusters
+ * on the CPU, using SSE and multiple threads if available (persistent worker threads
+ * started on first use), and the following buffer textures are uploaded:
+ * - OGLConstants::CLUSTER_LIGHTS: light parameters in eye coordinates,
+ *   LIGHT_TEXELS RGBA texels per light in the std140 layout of Light (cf. Light::writeBuffer()),
+ *   with the light range stored in the z component of the last texel
+ * - OGLConstants::CLUSTER_LIGHT_INDICES: light indices of all clusters
+ * - OGLConstants::CLUSTER_GRID: offset and number of light indices per cluster
+ *
+ * The grid parameters are stored in the uniform block OGLConstants::LIGHT_CLUSTER.
+ * A cluster-aware fragment shader such as blinn_phong_clustered_lighting.glsl
+ * then only iterates over the lights of the fragment's cluster (in addition
+ * to the lights defined by Light nodes).
+ *
+ * The lights are not part of the scene graph, i.e., their positions are
+ * given in world coordinates or by LightPosition nodes. Each light
+ * has to be initialized by Light::init() before rendering.
+ * The contribution of a point or spot light is limited to its range, with a smooth
+ * falloff towards the range. Lights with range 0 and directional lights
+ * are applied to all clusters without falloff.
+ */
+class LightCluster: public Composite {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  LightCluster();
+
+  /**
+   * Destructor.
+   */
+  virtual ~LightCluster();
+
+  /**
+   * Create shared pointer.
+   */
+  static LightClusterSP create();
+
+  /**
+   * Add light.
+   * \param light initialized light
+   * \param range range of point or spot light, 0 for unlimited range
+   * \return this pointer for method chaining
+   */
+  LightCluster* addLight(LightSP light, float range = 0.f);
+
+  /**
+   * Remove all lights.
+   * \return this pointer for method chaining
+   */
+  LightCluster* clearLights();
+
+  /**
+   * Get number of lights.
+   */
+  int getNLights() const;
+
+  /**
+   * Set number of clusters in x (screen width), y (screen height), and z (depth) direction.
+   *
+   * Default: 16 x 9 x 24
+   *
+   * \return this pointer for method chaining
+   */
+  LightCluster* setGridSize(int nx, int ny, int nz);
+
+  /**
+   * Set maximum number of threads used to bin the lights, 0 for number of hardware threads.
+   *
+   * Default: 0
+   *
+   * \return this pointer for method chaining
+   */
+  LightCluster* setNThreads(int nThreads);
+
+  /**
+   * Get total number of light indices in all clusters, as determined by the last update.
+   */
+  int getNLightIndices() const;
+
+  /**
+   * Get CPU time of the last update in milliseconds (binning and upload).
+   */
+  double getUpdateTime() const;
+
+  /**
+   * Bin lights into clusters of the current camera projection and upload buffers,
+   * to be called with active OpenGL context. Called by render().
+   */
+  void update(RenderState* renderState);
+
+  /**
+   * Accept traverser.
+   */
+  virtual void accept(Traverser* traverser);
+
+  /**
+   * Accept traverser after traversing sub-tree.
+   */
+  virtual void acceptPost(Traverser* traverser);
+
+  /**
+   * Render light cluster, i.e., update clusters and bind buffers.
+   */
+  virtual void render(RenderState* renderState);
+
+  /**
+   * Render light cluster after traversing sub-tree, i.e., restore previous bindings.
+   */
+  virtual void renderPost(RenderState* renderState);
+
+public:
+
+  // number of RGBA texels per light in buffer texture (cf. Light::BUFFER_SIZE)
+  static const int LIGHT_TEXELS = 7;
+
+  // size of uniform block in bytes
+  static const int BLOCK_SIZE = 48;
+
+protected:
+
+  /**
+   * Cluster range covered by a light (inclusive), empty if x0 > x1.
+   */
+  struct LightBounds {
+    int x0, x1, y0, y1, z0, z1;
+  };
+
+  /**
+   * Compute cluster ranges of lights [first, last) from bounding spheres in eye coordinates.
+   */
+  void computeBounds_(const glm::mat4& projection, size_t first, size_t last);
+
+  /**
+   * Compute cluster range from normalized device coordinates
+   * (min x, max x, min y, max y) and depth range of a light.
+   */
+  void setBounds_(size_t index, const float* ndcBounds, bool isBehindEye);
+
+  /**
+   * Convert depth (distance along negative z axis) into depth slice.
+   */
+  int getSlice_(float depth) const;
+
+  /**
+   * Collect light indices of depth slices [z0, z1), grid offsets are relative to indices.
+   */
+  void binLights_(int z0, int z1, std::vector<GLuint>& indices);
+
+  /**
+   * Start worker threads for binning, such that the given number of workers is available.
+   */
+  void startWorkers_(int nWorkers);
+
+  /**
+   * Worker thread with given thread index (> 0, index 0 is the calling thread):
+   * bin lights of its depth slices for each update.
+   *
+   * \param updateIndex update index at thread start
+   */
+  void runWorker_(int threadIndex, long updateIndex);
+
+  /**
+   * Create uniform buffer object, buffer textures, and their buffers.
+   */
+  void createBuffers_();
+
+  /**
+   * Delete OpenGL objects.
+   */
+  void clearBuffers_();
+
+protected:
+
+  std::vector<LightSP> lights_;
+  std::vector<float> ranges_;
+  int nx_, ny_, nz_;
+  int nThreads_;
+  bool isPerspective_;
+  float near_, far_;
+  float depthScale_, depthBias_;
+  std::vector<glm::vec4> spheres_;      // center and range in eye coordinates
+  std::vector<LightBounds> bounds_;
+  std::vector<float> lightData_;
+  std::vector<GLuint> gridData_;        // offset and count per cluster
+  std::vector<GLuint> indexData_;
+  GLuint ubo_;
+  GLuint tbo_[3];                       // lights, light indices, grid
+  GLuint tex_[3];
+  GLint maxTexels_;
+  GLint uboOld_;
+  GLint texOld_[3];
+  double updateTime_;
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable requestCondition_;
+  std::condition_variable doneCondition_;
+  std::vector<std::vector<GLuint>> threadIndices_;   // light indices per thread
+  int nBinThreads_;                     // threads binning the current update
+  int nBusyWorkers_;
+  long updateIndex_;                    // incremented per update, wakes up workers
+  bool isStopped_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* LIGHTCLUSTER_H_ */
@@ -23,7 +23,9 @@
 
 #include <cassert>
 #include <cstring>
+#include "GLDebug.h"
 #include "MaterialCore.h"
+#include "MaterialTable.h"
 #include "RenderState.h"
 #include "scg_utilities.h"
 
@@ -31,16 +33,14 @@ namespace scg {
 
 
 MaterialCore::MaterialCore()
-    : ubo_(0), uboOld_(0),
+    : ubo_(0), uboOld_(0), materialIndexOld_(-1), isIndexed_(false),
       emission_(0.0f), ambient_(0.0f), diffuse_(0.0f), specular_(0.0f), shininess_(0.0f) {
-  glGenBuffers(1, &ubo_);
-
-  assert(!checkGLError());
+  memset(buffer_, 0, BUFFER_SIZE);
 }
 
 
 MaterialCore::~MaterialCore() {
-  if (isGLContextActive()) {
+  if (isGLContextActive() && ubo_ != 0) {
     glDeleteBuffers(1, &ubo_);
   }
 }
@@ -88,37 +88,63 @@ MaterialCore* MaterialCore::setShininess(GLfloat shininess) {
 
 
 void MaterialCore::init() {
-  GLubyte* buffer = new GLubyte[BUFFER_SIZE];
-  memcpy(buffer + EMISSION_OFFSET, glm::value_ptr(emission_), VEC4_SIZE);
-  memcpy(buffer + AMBIENT_OFFSET, glm::value_ptr(ambient_), VEC4_SIZE);
-  memcpy(buffer + DIFFUSE_OFFSET, glm::value_ptr(diffuse_), VEC4_SIZE);
-  memcpy(buffer + SPECULAR_OFFSET, glm::value_ptr(specular_), VEC4_SIZE);
-  memcpy(buffer + SHININESS_OFFSET, &shininess_, FLOAT_SIZE);
+  memcpy(buffer_ + EMISSION_OFFSET, glm::value_ptr(emission_), VEC4_SIZE);
+  memcpy(buffer_ + AMBIENT_OFFSET, glm::value_ptr(ambient_), VEC4_SIZE);
+  memcpy(buffer_ + DIFFUSE_OFFSET, glm::value_ptr(diffuse_), VEC4_SIZE);
+  memcpy(buffer_ + SPECULAR_OFFSET, glm::value_ptr(specular_), VEC4_SIZE);
+  memcpy(buffer_ + SHININESS_OFFSET, &shininess_, FLOAT_SIZE);
+  if (ubo_ == 0) {
+    glGenBuffers(1, &ubo_);
+  }
   glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
   assert(glIsBuffer(ubo_));
-  glBufferData(GL_UNIFORM_BUFFER, BUFFER_SIZE, buffer, GL_DYNAMIC_DRAW);
+  glBufferData(GL_UNIFORM_BUFFER, BUFFER_SIZE, buffer_, GL_DYNAMIC_DRAW);
   glBindBuffer(GL_UNIFORM_BUFFER, 0);
-  delete [] buffer;
-  buffer = nullptr;
 
   assert(!checkGLError());
 }
 
 
+void MaterialCore::writeBuffer(GLubyte* buffer) const {
+  memcpy(buffer, buffer_, BUFFER_SIZE);
+}
+
+
 void MaterialCore::render(RenderState* renderState) {
+  // set material index if material is part of current material table
+  MaterialTable* table = renderState->getMaterialTable();
+  materialIndexOld_ = renderState->getMaterialIndex();
+  GLint materialIndex = table ? table->getIndex(this) : -1;
+  renderState->setMaterialIndex(materialIndex);
+  isIndexed_ = (materialIndex >= 0);
+  if (isIndexed_) {
+    return;
+  }
+
+  // otherwise bind uniform buffer object
   glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, OGLConstants::MATERIAL.bindingPoint, &uboOld_);
   glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::MATERIAL.bindingPoint, ubo_);
   assert(glIsBuffer(ubo_));
+  ++renderState->stats.nBufferBinds;
 
   assert(!checkGLError());
 }
 
 
 void MaterialCore::renderPost(RenderState* renderState) {
+  renderState->setMaterialIndex(materialIndexOld_);
+  if (isIndexed_) {
+    return;
+  }
   glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::MATERIAL.bindingPoint, uboOld_);
 
   assert(!checkGLError());
 }
 
 
+void MaterialCore::setDebugLabel(const std::string& label) {
+  GLDebug::setObjectLabel(GL_BUFFER, ubo_, label);
+}
+
+
 } /* namespace scg */
@@ -40,6 +40,8 @@ namespace scg {
  *
  * The material properties are stored in a uniform buffer object (UBO),
  * which is bound in render().
+ * Within the sub-tree of a MaterialTable that contains the material,
+ * only the material index is set instead (cf. MaterialTable).
  */
 class MaterialCore: public Core {
 
@@ -102,7 +104,14 @@ public:
   void init();
 
   /**
-   * Render material, i.e., bind uniform buffer object (UBO).
+   * Write material parameters as set by init() in std140 layout (BUFFER_SIZE bytes),
+   * to be called by MaterialTable.
+   */
+  void writeBuffer(GLubyte* buffer) const;
+
+  /**
+   * Render material, i.e., bind uniform buffer object (UBO) or set material index
+   * of current material table.
    */
   virtual void render(RenderState* renderState);
 
@@ -111,6 +120,11 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+  /**
+   * Label uniform buffer object (if any) for GL debuggers (cf. GLDebug).
+   */
+  virtual void setDebugLabel(const std::string& label);
+
 public:
 
   // parameters for uniform buffer object (UBO)
@@ -127,6 +141,9 @@ protected:
 
   GLuint ubo_;          // uniform buffer object
   GLint uboOld_;
+  GLint materialIndexOld_;
+  bool isIndexed_;
+  GLubyte buffer_[BUFFER_SIZE];   // parameters in std140 layout
   glm::vec4 emission_;
   glm::vec4 ambient_;
   glm::vec4 diffuse_;
@@ -0,0 +1,141 @@
+/**
+ * \file MaterialTable.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include "MaterialCore.h"
+#include "MaterialTable.h"
+#include "RenderState.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+MaterialTable::MaterialTable()
+    : tbo_(0), tex_(0), texOld_(0), tableOld_(nullptr) {
+}
+
+
+MaterialTable::~MaterialTable() {
+  if (isGLContextActive() && tbo_ != 0) {
+    glDeleteTextures(1, &tex_);
+    glDeleteBuffers(1, &tbo_);
+  }
+}
+
+
+MaterialTableSP MaterialTable::create() {
+  return std::make_shared<MaterialTable>();
+}
+
+
+int MaterialTable::addMaterial(MaterialCoreSP material) {
+  assert(material);
+  auto it = indices_.find(material.get());
+  if (it != indices_.end()) {
+    return it->second;
+  }
+  int index = static_cast<int>(materials_.size());
+  materials_.push_back(material);
+  indices_[material.get()] = index;
+  return index;
+}
+
+
+int MaterialTable::getIndex(const MaterialCore* material) const {
+  auto it = indices_.find(material);
+  return (it != indices_.end()) ? it->second : -1;
+}
+
+
+int MaterialTable::getNMaterials() const {
+  return static_cast<int>(materials_.size());
+}
+
+
+void MaterialTable::update() {
+  static_assert(4 * MATERIAL_TEXELS * sizeof(GLfloat) == MaterialCore::BUFFER_SIZE,
+      "material texels do not match material buffer size");
+
+  // pack material parameters, upload only if changed
+  newData_.resize(std::max(materials_.size(), static_cast<size_t>(1)) * MaterialCore::BUFFER_SIZE);
+  for (size_t i = 0; i < materials_.size(); ++i) {
+    materials_[i]->writeBuffer(&newData_[i * MaterialCore::BUFFER_SIZE]);
+  }
+  if (tbo_ != 0 && newData_ == data_) {
+    return;
+  }
+  data_.swap(newData_);
+
+  // create buffer texture on first update
+  if (tbo_ == 0) {
+    glGenBuffers(1, &tbo_);
+    glBindBuffer(GL_TEXTURE_BUFFER, tbo_);
+    glBufferData(GL_TEXTURE_BUFFER, data_.size(), data_.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glGenTextures(1, &tex_);
+    glActiveTexture(GL_TEXTURE0 + OGLConstants::MATERIALS.texUnit);
+    GLint texOld = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld);
+    glBindTexture(GL_TEXTURE_BUFFER, tex_);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, tbo_);
+    glBindTexture(GL_TEXTURE_BUFFER, texOld);
+    glActiveTexture(GL_TEXTURE0);
+  }
+  else {
+    glBindBuffer(GL_TEXTURE_BUFFER, tbo_);
+    glBufferData(GL_TEXTURE_BUFFER, data_.size(), data_.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  }
+
+  assert(!checkGLError());
+}
+
+
+void MaterialTable::render(RenderState* renderState) {
+  update();
+
+  // make table current, bind buffer texture
+  tableOld_ = renderState->getMaterialTable();
+  renderState->setMaterialTable(this);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::MATERIALS.texUnit);
+  glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld_);
+  glBindTexture(GL_TEXTURE_BUFFER, tex_);
+  glActiveTexture(GL_TEXTURE0);
+  ++renderState->stats.nTextureBinds;
+
+  assert(!checkGLError());
+}
+
+
+void MaterialTable::renderPost(RenderState* renderState) {
+  renderState->setMaterialTable(tableOld_);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::MATERIALS.texUnit);
+  glBindTexture(GL_TEXTURE_BUFFER, texOld_);
+  glActiveTexture(GL_TEXTURE0);
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
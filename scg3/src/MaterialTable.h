@@ -0,0 +1,132 @@
+/**
+ * \file MaterialTable.h
+ * \brief A core that stores the parameters of many materials in a single buffer texture, addressed by index per draw.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MATERIALTABLE_H_
+#define MATERIALTABLE_H_
+
+#include <unordered_map>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "Core.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A core that stores the parameters of many materials in a single buffer texture,
+ *    addressed by index per draw.
+ *
+ * The material parameters are stored in the std140 layout of MaterialCore
+ * (MATERIAL_TEXELS RGBA texels per material) in a buffer texture that is bound to
+ * sampler OGLConstants::MATERIALS in render().
+ * Within the sub-tree of the table, a MaterialCore that has been added to the table
+ * does not bind its own uniform buffer object, but only sets the material index of
+ * RenderState, which is passed to the shader as uniform OGLConstants::MATERIAL_INDEX.
+ * Materials that have not been added fall back to their uniform buffer object (index -1).
+ * Thus, shader variants with MATERIAL_TABLE defined to 1 have to be used, e.g.,
+ * phong_variant_vert.glsl or phong_batch_vert.glsl with blinn_phong_lighting.glsl.
+ *
+ * A StaticBatch within the sub-tree of a table or with the table added as core
+ * adds the materials of its shapes to the table and stores the material indices
+ * per draw command, such that shapes of different materials are merged into
+ * the same batches.
+ *
+ * Changes of material parameters take effect after MaterialCore::init() has been
+ * called, as for materials that are not part of a table.
+ */
+class MaterialTable: public Core {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  MaterialTable();
+
+  /**
+   * Destructor.
+   */
+  virtual ~MaterialTable();
+
+  /**
+   * Create shared pointer.
+   */
+  static MaterialTableSP create();
+
+  /**
+   * Add material to table (if not yet contained).
+   * \return material index
+   */
+  int addMaterial(MaterialCoreSP material);
+
+  /**
+   * Get material index, -1 if material is not contained.
+   */
+  int getIndex(const MaterialCore* material) const;
+
+  /**
+   * Get number of materials.
+   */
+  int getNMaterials() const;
+
+  /**
+   * Upload material parameters if materials have been added or changed,
+   * to be called with active OpenGL context. Called by render().
+   */
+  void update();
+
+  /**
+   * Render material table, i.e., update and bind buffer texture, make table
+   * current table of RenderState.
+   */
+  virtual void render(RenderState* renderState);
+
+  /**
+   * Render material table after traversing sub-tree, i.e., restore previous table.
+   */
+  virtual void renderPost(RenderState* renderState);
+
+public:
+
+  // number of RGBA texels per material in buffer texture (cf. MaterialCore::BUFFER_SIZE)
+  static const int MATERIAL_TEXELS = 5;
+
+protected:
+
+  std::vector<MaterialCoreSP> materials_;
+  std::unordered_map<const MaterialCore*, int> indices_;
+  std::vector<GLubyte> data_;           // uploaded material parameters
+  std::vector<GLubyte> newData_;
+  GLuint tbo_;
+  GLuint tex_;
+  GLint texOld_;
+  MaterialTable* tableOld_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MATERIALTABLE_H_ */
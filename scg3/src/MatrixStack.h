@@ -0,0 +1,92 @@
+/**
+ * \file MatrixStack.h
+ * \brief Matrix stack for model-view, projection, texture, and color matrices, part of the library scg3_assets.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MATRIXSTACK_H_
+#define MATRIXSTACK_H_
+
+#include <cassert>
+#include <stack>
+#include "scg_glm.h"
+
+namespace scg {
+
+
+/**
+ * \brief Matrix stack to store model-view, projection, texture, and color matrices,
+ *    used by RenderState.
+ *
+ * The member functions are defined in the header file to allow inlining.
+ */
+class MatrixStack {
+
+public:
+
+  MatrixStack() {
+    stack_.push(glm::mat4(1.0f));
+  }
+
+  const glm::mat4& getMatrix() const {
+    assert(!stack_.empty());
+    return stack_.top();
+  }
+
+  void setMatrix(const glm::mat4& matrix) {
+    assert(!stack_.empty());
+    stack_.top() = matrix;
+  }
+
+  void setIdentity() {
+    assert(!stack_.empty());
+    stack_.top() = glm::mat4(1.0f);
+  }
+
+  void pushMatrix() {
+    assert(!stack_.empty());
+    stack_.push(stack_.top());
+  }
+
+  void pushMatrix(const glm::mat4& matrix) {
+    stack_.push(matrix);
+  }
+
+  void popMatrix() {
+    assert(!stack_.empty());
+    stack_.pop();
+  }
+
+  void multMatrix(const glm::mat4& matrix) {
+    assert(!stack_.empty());
+    stack_.top() *= matrix;
+  }
+
+protected:
+
+  std::stack<glm::mat4> stack_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MATRIXSTACK_H_ */
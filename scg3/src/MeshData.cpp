@@ -0,0 +1,208 @@
+/**
+ * \file MeshData.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include "MeshData.h"
+
+namespace scg {
+
+
+MeshData::MeshData(GLenum primitiveType)
+    : primitiveType_(primitiveType), hasBoundingBox_(false), boundingBoxMin_(0.f),
+      boundingBoxMax_(0.f) {
+}
+
+
+MeshData::~MeshData() {
+}
+
+
+MeshData* MeshData::addAttributeData(MeshAttribute attribute, const GLfloat* data,
+    GLsizeiptr size, GLint dim) {
+  assert(data);
+  assert(dim > 0);
+  MeshAttributeData attributeData;
+  attributeData.attribute = attribute;
+  attributeData.dim = dim;
+  attributeData.data.assign(data, data + size / static_cast<GLsizeiptr>(sizeof(GLfloat)));
+
+  // replace previous data of same attribute (if any)
+  auto it = std::find_if(attributes_.begin(), attributes_.end(),
+      [attribute](const MeshAttributeData& a) { return a.attribute == attribute; });
+  if (it != attributes_.end()) {
+    *it = std::move(attributeData);
+  }
+  else {
+    attributes_.push_back(std::move(attributeData));
+  }
+
+  if (attribute == MeshAttribute::VERTEX) {
+    updateBoundingBox_();
+  }
+  return this;
+}
+
+
+MeshData* MeshData::setElementIndexData(const GLuint* data, GLsizeiptr size) {
+  assert(data);
+  indices_.assign(data, data + size / static_cast<GLsizeiptr>(sizeof(GLuint)));
+  return this;
+}
+
+
+GLenum MeshData::getPrimitiveType() const {
+  return primitiveType_;
+}
+
+
+bool MeshData::isIndexed() const {
+  return !indices_.empty();
+}
+
+
+int MeshData::getNVertices() const {
+  const MeshAttributeData* vertices = findAttributeData(MeshAttribute::VERTEX);
+  return vertices ? static_cast<int>(vertices->data.size()) / vertices->dim : 0;
+}
+
+
+int MeshData::getNElements() const {
+  return isIndexed() ? static_cast<int>(indices_.size()) : getNVertices();
+}
+
+
+int MeshData::getNTriangles() const {
+  int result;
+  switch (primitiveType_) {
+  case GL_TRIANGLES:
+    result = getNElements() / 3;
+    break;
+  case GL_TRIANGLE_FAN:
+  case GL_TRIANGLE_STRIP:
+    result = std::max(getNElements() - 2, 0);
+    break;
+  default:
+    result = 0;
+    break;
+  }
+  return result;
+}
+
+
+const std::vector<MeshAttributeData>& MeshData::getAttributeData() const {
+  return attributes_;
+}
+
+
+const MeshAttributeData* MeshData::findAttributeData(MeshAttribute attribute) const {
+  for (auto& attributeData : attributes_) {
+    if (attributeData.attribute == attribute) {
+      return &attributeData;
+    }
+  }
+  return nullptr;
+}
+
+
+const std::vector<GLuint>& MeshData::getElementIndexData() const {
+  return indices_;
+}
+
+
+bool MeshData::hasBoundingBox() const {
+  return hasBoundingBox_;
+}
+
+
+const glm::vec3& MeshData::getBoundingBoxMin() const {
+  return boundingBoxMin_;
+}
+
+
+const glm::vec3& MeshData::getBoundingBoxMax() const {
+  return boundingBoxMax_;
+}
+
+
+MeshData* MeshData::transform(const glm::mat4& matrix) {
+  glm::mat3 directionMatrix(matrix);
+  glm::mat3 normalMatrix = glm::transpose(glm::inverse(directionMatrix));
+  for (auto& attributeData : attributes_) {
+    size_t dim = attributeData.dim;
+    int nCoords = std::min(attributeData.dim, 3);
+    for (size_t i = 0; i + dim <= attributeData.data.size(); i += dim) {
+      GLfloat* value = &attributeData.data[i];
+      glm::vec3 v(0.f);
+      for (int j = 0; j < nCoords; ++j) {
+        v[j] = value[j];
+      }
+      switch (attributeData.attribute) {
+      case MeshAttribute::VERTEX:
+        v = glm::vec3(matrix * glm::vec4(v, 1.f));
+        break;
+      case MeshAttribute::NORMAL:
+        v = glm::normalize(normalMatrix * v);
+        break;
+      case MeshAttribute::TANGENT:
+      case MeshAttribute::BINORMAL:
+        v = glm::normalize(directionMatrix * v);
+        break;
+      default:
+        continue;   // colors and texture coordinates are not transformed
+      }
+      for (int j = 0; j < nCoords; ++j) {
+        value[j] = v[j];
+      }
+    }
+  }
+  updateBoundingBox_();
+  return this;
+}
+
+
+void MeshData::updateBoundingBox_() {
+  hasBoundingBox_ = false;
+  boundingBoxMin_ = boundingBoxMax_ = glm::vec3(0.f);
+  const MeshAttributeData* vertices = findAttributeData(MeshAttribute::VERTEX);
+  if (!vertices) {
+    return;
+  }
+  size_t dim = vertices->dim;
+  int nCoords = std::min(vertices->dim, 3);
+  for (size_t i = 0; i + dim <= vertices->data.size(); i += dim) {
+    glm::vec3 position(0.f);
+    for (int j = 0; j < nCoords; ++j) {
+      position[j] = vertices->data[i + j];
+    }
+    if (!hasBoundingBox_) {
+      boundingBoxMin_ = boundingBoxMax_ = position;
+      hasBoundingBox_ = true;
+    }
+    boundingBoxMin_ = glm::min(boundingBoxMin_, position);
+    boundingBoxMax_ = glm::max(boundingBoxMax_, position);
+  }
+}
+
+
+} /* namespace scg */
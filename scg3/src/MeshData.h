@@ -0,0 +1,191 @@
+/**
+ * \file MeshData.h
+ * \brief Vertex attributes and element indices of a mesh in main memory, part of the library scg3_assets.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MESHDATA_H_
+#define MESHDATA_H_
+
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_glm.h"
+
+namespace scg {
+
+
+/**
+ * \brief Vertex attributes of MeshData, mapped to the attribute locations of OGLConstants
+ *    when the mesh is realized as geometry core.
+ */
+enum class MeshAttribute {
+  VERTEX,
+  COLOR,
+  NORMAL,
+  TEX_COORD_0,
+  TEX_COORD_1,
+  TANGENT,
+  BINORMAL
+};
+
+
+/**
+ * \brief Vertex attribute data of MeshData.
+ */
+struct MeshAttributeData {
+  MeshAttribute attribute;
+  GLint dim;
+  std::vector<GLfloat> data;
+};
+
+
+/**
+ * \brief Vertex attributes and element indices of a mesh in main memory.
+ *
+ * Mesh data is created and processed without OpenGL context, e.g., by MeshFactory on
+ * asset processing servers, and realized as geometry core by
+ * GeometryCoreFactory::createGeometry() when a context exists. The element indices are
+ * optional (DrawMode::ARRAYS if empty, DrawMode::ELEMENTS otherwise).
+ * The axis-aligned bounding box of the vertex positions (MeshAttribute::VERTEX)
+ * is computed when the vertex data is added or transformed.
+ */
+class MeshData {
+
+public:
+
+  /**
+   * Constructor.
+   *
+   * \param primitiveType GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_LINE_LOOP,
+   *    GL_TRIANGLES, GL_TRIANGLE_STRIP, or GL_TRIANGLE_FAN
+   */
+  MeshData(GLenum primitiveType = GL_TRIANGLES);
+
+  /**
+   * Destructor.
+   */
+  ~MeshData();
+
+  /**
+   * Add vertex attribute data, replacing previous data of the same attribute.
+   *
+   * \param attribute vertex attribute
+   * \param data attribute data
+   * \param size data size in bytes
+   * \param dim dimension of each attribute value, e.g., 3 for xyz vertices
+   * \return this pointer for method chaining
+   */
+  MeshData* addAttributeData(MeshAttribute attribute, const GLfloat* data, GLsizeiptr size, GLint dim);
+
+  /**
+   * Set element index data.
+   *
+   * \param data element data
+   * \param size data size in bytes
+   * \return this pointer for method chaining
+   */
+  MeshData* setElementIndexData(const GLuint* data, GLsizeiptr size);
+
+  /**
+   * Get primitive type.
+   */
+  GLenum getPrimitiveType() const;
+
+  /**
+   * Check if element indices have been set.
+   */
+  bool isIndexed() const;
+
+  /**
+   * Get number of vertices (0 if vertex positions have not been added).
+   */
+  int getNVertices() const;
+
+  /**
+   * Get number of vertices (not indexed) or element indices (indexed) to be drawn.
+   */
+  int getNElements() const;
+
+  /**
+   * Get number of triangles (0 for points and lines).
+   */
+  int getNTriangles() const;
+
+  /**
+   * Get vertex attribute data in the order they have been added.
+   */
+  const std::vector<MeshAttributeData>& getAttributeData() const;
+
+  /**
+   * Find vertex attribute data.
+   * \return attribute data, or nullptr if attribute has not been added
+   */
+  const MeshAttributeData* findAttributeData(MeshAttribute attribute) const;
+
+  /**
+   * Get element index data (empty if not indexed).
+   */
+  const std::vector<GLuint>& getElementIndexData() const;
+
+  /**
+   * Check if bounding box is available, i.e., if vertex positions have been added.
+   */
+  bool hasBoundingBox() const;
+
+  /**
+   * Get minimum corner of bounding box in model coordinates.
+   */
+  const glm::vec3& getBoundingBoxMin() const;
+
+  /**
+   * Get maximum corner of bounding box in model coordinates.
+   */
+  const glm::vec3& getBoundingBoxMax() const;
+
+  /**
+   * Transform vertex positions by matrix, normals by its inverse transpose, and tangents
+   * and binormals by its upper left 3x3 matrix (normalized), and update bounding box.
+   * \return this pointer for method chaining
+   */
+  MeshData* transform(const glm::mat4& matrix);
+
+protected:
+
+  /**
+   * Update bounding box from vertex positions.
+   */
+  void updateBoundingBox_();
+
+protected:
+
+  GLenum primitiveType_;
+  std::vector<MeshAttributeData> attributes_;
+  std::vector<GLuint> indices_;
+  bool hasBoundingBox_;
+  glm::vec3 boundingBoxMin_;
+  glm::vec3 boundingBoxMax_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MESHDATA_H_ */
@@ -0,0 +1,258 @@
+/**
+ * \file MeshFactory.h
+ * \brief A factory to create mesh data without OpenGL context, part of the library scg3_assets.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MESHFACTORY_H_
+#define MESHFACTORY_H_
+
+#include <string>
+#include <vector>
+#include "MeshData.h"
+#include "scg_glew_glad.h"
+#include "scg_glm.h"
+
+namespace scg {
+
+
+/**
+ * \brief A factory to create mesh data without OpenGL context, e.g., on asset processing
+ *    servers, used by GeometryCoreFactory.
+ *
+ * The geometries are defined as for the corresponding methods of GeometryCoreFactory.
+ */
+class MeshFactory {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  MeshFactory();
+
+  /**
+   * Constructor with one or more file paths to be searched for model files.
+   * More than one file paths can be defined using ';' or ',' as delimiter.
+   *
+   * Example: addFilePath("../models1;../models2")
+   */
+  MeshFactory(const std::string& filePath);
+
+  /**
+   * Destructor.
+   */
+  virtual ~MeshFactory();
+
+  /**
+   * Add one or more file paths to be searched for model files.
+   * More than one file paths can be defined using ';' or ',' as delimiter.
+   *
+   * Example: addFilePath("../models1;../models2")
+   */
+  void addFilePath(const std::string& filePath);
+
+  /**
+   * Load model from OBJ Wavefront file (throws an exception if the file cannot be read).
+   *
+   * Only the follwoing OBJ tags are used: v, vt, vn, f.
+   * If normals are not definied explicitly, they are created separately for each triangle
+   * (as in the case of flat shading); no smoothing of normals is applied.
+   *
+   * \param fileName file name to be searched for in known file paths
+   */
+  MeshData loadOBJFile(const std::string& fileName) const;
+
+  /**
+   * Create rectangle in xy plane with normals, tangents, binormals, and
+   * texture coordinates (2 triangles).
+   *
+   * \param sizeXY edge length in xy directions
+   */
+  MeshData createRectangle(glm::vec2 sizeXY) const;
+
+  /**
+   * Create cube with normals, tangents, binormals, and texture coordinates
+   * (12 triangles).
+   *
+   * \param size edge length
+   */
+  MeshData createCube(GLfloat size) const;
+
+  /**
+   * Create cuboid with normals, tangents, binormals, and texture coordinates
+   * (12 triangles).
+   *
+   * \param sizeXYZ edge length in xyz directions
+   */
+  MeshData createCuboid(glm::vec3 sizeXYZ) const;
+
+  /**
+   * Create sphere centered at origin with normals, tangents,
+   * binormals, and texture coordinates
+   * (2 * nSlices * nStacks triangles).
+   *
+   * \param radius sphere radius
+   * \param nSlices number of slices, i.e., rectangular faces in longitudinal direction
+   * \param nStacks number of stacks, i.e., rectangular faces in latitudinal direction
+   */
+  MeshData createSphere(GLfloat radius, int nSlices, int nStacks) const;
+
+  /**
+   * Create cone along z axis and centered at origin with normals, tangents,
+   * binormals, and texture coordinates
+   * (2 * nSlices * nStacks triangles for lateral surface plus nSlices triangles for cap).
+   *
+   * \param radius base radius in xy plane
+   * \param height height in z direction
+   * \param nSlices number of slices, i.e., rectangular faces in circumference direction
+   * \param nStacks number of stacks, i.e., rectangular faces in height direction
+   * \param hasCap true if base cap shall be modeled (default: true)
+   */
+  MeshData createCone(GLfloat radius, GLfloat height,
+      int nSlices, int nStacks, bool hasCap = true) const;
+
+  /**
+   * Create cylinder along z axis and centered at origin with normals, tangents,
+   * binormals, and texture coordinates
+   * (2 * nSlices * nStacks triangles for lateral surface plus nSlices triangles per cap).
+   *
+   * \param radius radius in xy plane
+   * \param height height in z direction
+   * \param nSlices number of slices, i.e., rectangular faces in circumference direction
+   * \param nStacks number of stacks, i.e., rectangular faces in height direction
+   * \param hasCaps true if base and top caps shall be modeled (default: true)
+   */
+  MeshData createCylinder(GLfloat radius, GLfloat height,
+      int nSlices, int nStacks, bool hasCaps = true) const;
+
+  /**
+   * Create conical frustum (or cylinder for baseRadius = topRadius) along z axis and
+   * centered at origin with normals, tangents, binormals, and texture coordinates
+   * (2 * nSlices * nStacks triangles for lateral surface plus nSlices triangles per cap).
+   * Called by createCone() and createCylinder().
+   *
+   * \param baseRadius base radius in x and y direction
+   * \param topRadius top radius in x and y direction (must be <= baseRadius)
+   * \param height height in z direction
+   * \param nSlices number of slices, i.e., rectangular faces in circumference direction
+   * \param nStacks number of stacks, i.e., rectangular faces in height direction
+   * \param hasCaps true if base and top caps shall be modeled (default: true)
+   */
+  MeshData createConicalFrustum(GLfloat baseRadius, GLfloat topRadius,
+      GLfloat height, int nSlices, int nStacks, bool hasCaps = true) const;
+
+  /**
+   * Create Utah teapot along z axis and centered at origin with normals, tangents,
+   * binormals, and texture coordinates
+   * (1024 triangles).
+   *
+   * Data source: https://cvs.khronos.org/svn/repos/registry/trunk/public/webgl/sdk/demos/google/shiny-teapot/index.html
+   *
+   * \param size approximate diameter
+   */
+  MeshData createTeapot(GLfloat size) const;
+
+  /**
+   * Create Utah teapot along z axis and centered at origin with normals and texture coordinates
+   * (1024 triangles), using a fixed normal per triangle optimal for flat shading.
+   *
+   * Data source: https://cvs.khronos.org/svn/repos/registry/trunk/public/webgl/sdk/demos/google/shiny-teapot/index.html
+   *
+   * \param size approximate diameter
+   */
+  MeshData createTeapotFlat(GLfloat size) const;
+
+  /**
+   * Create xyz coordinate axes with vertex colors
+   * (3 lines).
+   *
+   * \param size line length
+   */
+  MeshData createXYZAxes(GLfloat size) const;
+
+  /**
+   * Create RGB cube with vertex colors
+   * (12 triangles).
+   *
+   * \param size edge length
+   */
+  MeshData createRGBCube(GLfloat size) const;
+
+protected:
+
+  /**
+   * A vertex entry of a face definition of an OBJ file.
+   */
+  struct FaceEntry {
+    FaceEntry()
+        : vertex(0), texCoord(0), normal(0) {
+    }
+    int vertex;
+    int texCoord;
+    int normal;
+  };
+
+  /**
+   * A face definition of an OBJ file.
+   */
+  struct Face{
+    Face()
+        : nTriangles(0) {
+    }
+    int nTriangles;
+    std::vector<FaceEntry> entries;
+  };
+
+  /**
+   * A model stored in an OBJ file.
+   */
+  struct OBJModel {
+    OBJModel()
+        : nVertices(0), nTriangles(0) {
+    }
+    int nVertices;
+    int nTriangles;
+    std::vector<glm::vec3> vertices;
+    std::vector<glm::vec2> texCoords;
+    std::vector<glm::vec3> normals;
+    std::vector<Face> faces;
+  };
+
+  /**
+   * Load and parse an OBJ Wavefront file and create a model.
+   *
+   * Only the follwoing OBJ tags are used: v, vt, vn, f.
+   * If normals are not definied explicitly, they are created separately for each triangle
+   * (as in the case of flat shading); no smoothing of normals is applied.
+   */
+  int loadOBJFile_(const std::string& fileName, OBJModel& model) const;
+
+protected:
+
+  std::vector<std::string> filePaths_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* MESHFACTORY_H_ */
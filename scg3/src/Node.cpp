@@ -24,13 +24,15 @@
 #include <cassert>
 #include "Composite.h"
 #include "Core.h"
+#include "FrameProfiler.h"
+#include "GLDebug.h"
 #include "Node.h"
 
 namespace scg {
 
 
 Node::Node()
-  : parent_(nullptr), isVisible_(true) {
+  : parent_(nullptr), isVisible_(true), isProfiled_(false), isLabeled_(false) {
 }
 
 
@@ -65,6 +67,11 @@ int Node::getNCores() const {
 }
 
 
+const std::vector<CoreSP>& Node::getCores() const {
+  return cores_;
+}
+
+
 const std::string& Node::getMetaInfo(const std::string& key) const {
   return metaInfo_[key];
 }
@@ -72,6 +79,17 @@ const std::string& Node::getMetaInfo(const std::string& key) const {
 
 void Node::setMetaInfo(const std::string& key, const std::string& value) {
   metaInfo_[key] = value;
+  if (key == FrameProfiler::META_INFO_KEY) {
+    isProfiled_ = !value.empty();
+  }
+  else if (key == GLDebug::META_INFO_KEY) {
+    isLabeled_ = !value.empty();
+    if (isLabeled_) {
+      for (auto& core : cores_) {
+        core->setDebugLabel(value);
+      }
+    }
+  }
 }
 
 
@@ -75,6 +75,11 @@ public:
    */
   int getNCores() const;
 
+  /**
+   * Get cores associated with this node, e.g., to be inspected by a traverser.
+   */
+  const std::vector<CoreSP>& getCores() const;
+
   /**
    * Get meta-information value for a given key.
    * \param key key to search for
@@ -86,6 +91,13 @@ public:
    * Set meta-information as key-value pair.
    * \param key key; if there is already a key with that name, the value is overwritten
    * \param value value for the key
+   *
+   * A non-empty value for key FrameProfiler::META_INFO_KEY tags the node and its
+   * sub-tree for profiling.
+   *
+   * A non-empty value for key GLDebug::META_INFO_KEY labels the OpenGL objects of the
+   * cores added so far and encloses the traversal of the node and its sub-tree in a
+   * debug group of that name, if debug output is active (cf. GLDebug).
    */
   void setMetaInfo(const std::string& key, const std::string& value);
 
@@ -148,6 +160,8 @@ protected:
   Composite* parent_;
   std::vector<CoreSP> cores_;
   bool isVisible_;
+  bool isProfiled_;
+  bool isLabeled_;
   mutable std::unordered_map<std::string, std::string> metaInfo_;
 
 };
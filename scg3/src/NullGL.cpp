@@ -0,0 +1,1587 @@
+/**
+ * \file NullGL.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "scg_glew_glad.h"
+#include "NullGL.h"
+
+namespace scg {
+
+
+namespace {
+
+const char* EXTENSIONS[] = { "GL_ARB_base_instance", "GL_ARB_multi_draw_indirect",
+    "GL_ARB_texture_storage", "GL_EXT_texture_filter_anisotropic" };
+const GLuint N_EXTENSIONS = sizeof(EXTENSIONS) / sizeof(EXTENSIONS[0]);
+
+// call counter of one entry point, registered on first call
+struct CallCounter {
+  explicit CallCounter(const char* name0);
+  const char* name;
+  long nCalls;
+  long nRedundantCalls;
+};
+
+std::vector<CallCounter*>& getCounters() {
+  static std::vector<CallCounter*> counters;
+  return counters;
+}
+
+CallCounter::CallCounter(const char* name0)
+    : name(name0), nCalls(0), nRedundantCalls(0) {
+  getCounters().push_back(this);
+}
+
+// state tracked for queries and redundant call detection
+struct State {
+  State()
+      : nextName(0), program(0), vertexArray(0), drawFramebuffer(0), readFramebuffer(0),
+        activeTexture(0), viewport{0, 0, 0, 0}, depthMask(GL_TRUE),
+        blendFunc{GL_ONE, GL_ZERO, GL_ONE, GL_ZERO}, polygonMode(GL_FILL), polygonOffset{0.f, 0.f},
+        capabilities{{GL_DITHER, true}, {GL_MULTISAMPLE, true}} {
+  }
+  GLuint nextName;
+  GLuint program;
+  GLuint vertexArray;
+  GLuint drawFramebuffer;
+  GLuint readFramebuffer;
+  GLuint activeTexture;     // texture unit index
+  GLint viewport[4];
+  GLboolean depthMask;
+  GLenum blendFunc[4];      // source RGB, destination RGB, source alpha, destination alpha
+  GLenum polygonMode;       // front and back
+  GLfloat polygonOffset[2];
+  std::vector<std::pair<GLuint, GLuint>> bindings;   // binding key, object name
+  std::vector<std::pair<GLenum, bool>> capabilities;
+  std::unordered_map<std::string, GLint> uniformLocations;
+  std::unordered_map<GLuint, GLenum> shaderTypes;
+  std::vector<unsigned char> mapBuffer;
+};
+
+State state;
+bool isBackendLoaded = false;
+bool isRecordingCalls = false;
+std::vector<std::string> callStream;
+
+
+// --- call stream recording ---
+
+// argument types written differently from their OpenGL type
+struct EnumArg {
+  GLenum value;
+};
+
+struct BoolArg {
+  GLboolean value;
+};
+
+struct PtrArg {
+  const void* value;
+};
+
+struct StrArg {
+  const char* value;
+};
+
+struct FloatsArg {
+  const GLfloat* values;
+  GLsizei n;
+};
+
+struct IntsArg {
+  const GLint* values;
+  GLsizei n;
+};
+
+// short names used by entry points: enum/bitfield, boolean, pointer, string, values
+EnumArg E(GLenum value) {
+  return EnumArg{value};
+}
+
+BoolArg B(GLboolean value) {
+  return BoolArg{value};
+}
+
+template <typename T>
+PtrArg P(T* value) {
+  return PtrArg{reinterpret_cast<const void*>(value)};
+}
+
+StrArg S(const char* value) {
+  return StrArg{value};
+}
+
+FloatsArg F(const GLfloat* values, GLsizei n) {
+  return FloatsArg{values, n};
+}
+
+IntsArg I(const GLint* values, GLsizei n) {
+  return IntsArg{values, n};
+}
+
+template <typename T>
+void formatArg(std::ostream& stream, T arg) {
+  stream << arg;
+}
+
+void formatArg(std::ostream& stream, EnumArg arg) {
+  stream << "0x" << std::hex << arg.value << std::dec;
+}
+
+void formatArg(std::ostream& stream, BoolArg arg) {
+  stream << (arg.value ? "GL_TRUE" : "GL_FALSE");
+}
+
+void formatArg(std::ostream& stream, PtrArg arg) {
+  stream << (arg.value ? "ptr" : "null");
+}
+
+void formatArg(std::ostream& stream, StrArg arg) {
+  if (arg.value) {
+    stream << '"' << arg.value << '"';
+  }
+  else {
+    stream << "null";
+  }
+}
+
+template <typename T>
+void formatValues(std::ostream& stream, const T* values, GLsizei n) {
+  if (!values) {
+    stream << "null";
+    return;
+  }
+  stream << "[";
+  for (GLsizei i = 0; i < n; ++i) {
+    stream << (i > 0 ? ", " : "") << values[i];
+  }
+  stream << "]";
+}
+
+void formatArg(std::ostream& stream, FloatsArg arg) {
+  formatValues(stream, arg.values, arg.n);
+}
+
+void formatArg(std::ostream& stream, IntsArg arg) {
+  formatValues(stream, arg.values, arg.n);
+}
+
+void formatArgs(std::ostream& stream) {
+}
+
+template <typename T, typename... Args>
+void formatArgs(std::ostream& stream, T arg, Args... args) {
+  formatArg(stream, arg);
+  if (sizeof...(args) > 0) {
+    stream << ", ";
+  }
+  formatArgs(stream, args...);
+}
+
+template <typename... Args>
+void recordCall(const char* name, Args... args) {
+  std::ostringstream stream;
+  stream << name << "(";
+  formatArgs(stream, args...);
+  stream << ")";
+  callStream.push_back(stream.str());
+}
+
+// count call of entry point gl<name>, record call with formatted arguments
+#define NULLGL_CALL(name, ...) \
+  static CallCounter counter("gl" #name); \
+  ++counter.nCalls; \
+  if (isRecordingCalls) { \
+    recordCall("gl" #name, __VA_ARGS__); \
+  }
+
+#define NULLGL_CALL0(name) \
+  static CallCounter counter("gl" #name); \
+  ++counter.nCalls; \
+  if (isRecordingCalls) { \
+    recordCall("gl" #name); \
+  }
+
+
+// --- state tracking ---
+
+GLuint getIndexedKey(GLenum target, GLuint index) {
+  return ((index + 1) << 16) | target;
+}
+
+GLuint getTextureKey(GLenum target) {
+  return 0x80000000u | (state.activeTexture << 16) | target;
+}
+
+GLuint getBinding(GLuint key) {
+  for (auto& binding : state.bindings) {
+    if (binding.first == key) {
+      return binding.second;
+    }
+  }
+  return 0;
+}
+
+// set binding, return true if redundant
+bool bind(GLuint key, GLuint name) {
+  for (auto& binding : state.bindings) {
+    if (binding.first == key) {
+      bool isRedundant = (binding.second == name);
+      binding.second = name;
+      return isRedundant;
+    }
+  }
+  state.bindings.push_back(std::make_pair(key, name));
+  return name == 0;
+}
+
+// deleted objects are unbound (names are never reused)
+void unbind(GLuint name) {
+  if (name == 0) {
+    return;
+  }
+  for (auto& binding : state.bindings) {
+    if (binding.second == name) {
+      binding.second = 0;
+    }
+  }
+  if (state.vertexArray == name) {
+    state.vertexArray = 0;
+  }
+  if (state.drawFramebuffer == name) {
+    state.drawFramebuffer = 0;
+  }
+  if (state.readFramebuffer == name) {
+    state.readFramebuffer = 0;
+  }
+}
+
+bool getCapability(GLenum cap) {
+  for (auto& capability : state.capabilities) {
+    if (capability.first == cap) {
+      return capability.second;
+    }
+  }
+  return false;
+}
+
+// enable or disable capability, return true if redundant
+bool setCapability(GLenum cap, bool isEnabled) {
+  for (auto& capability : state.capabilities) {
+    if (capability.first == cap) {
+      bool isRedundant = (capability.second == isEnabled);
+      capability.second = isEnabled;
+      return isRedundant;
+    }
+  }
+  state.capabilities.push_back(std::make_pair(cap, isEnabled));
+  return !isEnabled;
+}
+
+// set blend function, return true if redundant
+bool setBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+  const GLenum blendFunc[4] = { srcRGB, dstRGB, srcAlpha, dstAlpha };
+  bool isRedundant = std::equal(blendFunc, blendFunc + 4, state.blendFunc);
+  std::copy(blendFunc, blendFunc + 4, state.blendFunc);
+  return isRedundant;
+}
+
+const char* getString(GLenum name) {
+  switch (name) {
+    case GL_VENDOR:
+      return "scg3";
+    case GL_RENDERER:
+      return "NullGL";
+    case GL_VERSION:
+      return "4.1 scg3 null backend";
+    case GL_SHADING_LANGUAGE_VERSION:
+      return "4.10";
+    default:
+      return "";
+  }
+}
+
+void getInteger(GLenum pname, GLint* data) {
+  switch (pname) {
+    case GL_NUM_EXTENSIONS:
+      data[0] = N_EXTENSIONS;
+      break;
+    case GL_MAJOR_VERSION:
+      data[0] = 4;
+      break;
+    case GL_MINOR_VERSION:
+      data[0] = 1;
+      break;
+    case GL_CURRENT_PROGRAM:
+      data[0] = state.program;
+      break;
+    case GL_VERTEX_ARRAY_BINDING:
+      data[0] = state.vertexArray;
+      break;
+    case GL_DRAW_FRAMEBUFFER_BINDING:
+      data[0] = state.drawFramebuffer;
+      break;
+    case GL_READ_FRAMEBUFFER_BINDING:
+      data[0] = state.readFramebuffer;
+      break;
+    case GL_ACTIVE_TEXTURE:
+      data[0] = GL_TEXTURE0 + state.activeTexture;
+      break;
+    case GL_TEXTURE_BINDING_2D:
+      data[0] = getBinding(getTextureKey(GL_TEXTURE_2D));
+      break;
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+      data[0] = getBinding(getTextureKey(GL_TEXTURE_2D_ARRAY));
+      break;
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+      data[0] = getBinding(getTextureKey(GL_TEXTURE_CUBE_MAP));
+      break;
+    case GL_TEXTURE_BINDING_BUFFER:
+      data[0] = getBinding(getTextureKey(GL_TEXTURE_BUFFER));
+      break;
+    case GL_ARRAY_BUFFER_BINDING:
+      data[0] = getBinding(GL_ARRAY_BUFFER);
+      break;
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+      data[0] = getBinding(GL_ELEMENT_ARRAY_BUFFER);
+      break;
+    case GL_UNIFORM_BUFFER_BINDING:
+      data[0] = getBinding(GL_UNIFORM_BUFFER);
+      break;
+    case GL_VIEWPORT:
+      std::copy(state.viewport, state.viewport + 4, data);
+      break;
+    case GL_BLEND_SRC_RGB:
+      data[0] = state.blendFunc[0];
+      break;
+    case GL_BLEND_DST_RGB:
+      data[0] = state.blendFunc[1];
+      break;
+    case GL_BLEND_SRC_ALPHA:
+      data[0] = state.blendFunc[2];
+      break;
+    case GL_BLEND_DST_ALPHA:
+      data[0] = state.blendFunc[3];
+      break;
+    case GL_POLYGON_MODE:
+      data[0] = data[1] = state.polygonMode;
+      break;
+    case GL_MAX_TEXTURE_SIZE:
+      data[0] = 16384;
+      break;
+    case GL_MAX_ARRAY_TEXTURE_LAYERS:
+      data[0] = 2048;
+      break;
+    case GL_MAX_TEXTURE_BUFFER_SIZE:
+      data[0] = 1 << 27;
+      break;
+    case GL_MAX_TEXTURE_IMAGE_UNITS:
+      data[0] = 32;
+      break;
+    case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+      data[0] = 192;
+      break;
+    case GL_MAX_UNIFORM_BLOCK_SIZE:
+      data[0] = 65536;
+      break;
+    case GL_MAX_UNIFORM_BUFFER_BINDINGS:
+      data[0] = 84;
+      break;
+    case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+      data[0] = 256;
+      break;
+    case GL_MAX_DRAW_BUFFERS:
+    case GL_MAX_COLOR_ATTACHMENTS:
+      data[0] = 8;
+      break;
+    case GL_MAX_LABEL_LENGTH:
+      data[0] = 256;
+      break;
+    default:
+      data[0] = 0;
+      break;
+  }
+}
+
+
+// --- entry points (alphabetical), redundant calls do not change the tracked state ---
+
+void APIENTRY nullActiveTexture(GLenum texture) {
+  NULLGL_CALL(ActiveTexture, E(texture));
+  if (texture - GL_TEXTURE0 == state.activeTexture) {
+    ++counter.nRedundantCalls;
+  }
+  state.activeTexture = texture - GL_TEXTURE0;
+}
+
+
+void APIENTRY nullAttachShader(GLuint program, GLuint shader) {
+  NULLGL_CALL(AttachShader, program, shader);
+}
+
+
+void APIENTRY nullBeginQuery(GLenum target, GLuint id) {
+  NULLGL_CALL(BeginQuery, E(target), id);
+}
+
+
+void APIENTRY nullBindAttribLocation(GLuint program, GLuint index, const GLchar* name) {
+  NULLGL_CALL(BindAttribLocation, program, index, S(name));
+}
+
+
+void APIENTRY nullBindBuffer(GLenum target, GLuint buffer) {
+  NULLGL_CALL(BindBuffer, E(target), buffer);
+  if (bind(target, buffer)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+  NULLGL_CALL(BindBufferBase, E(target), index, buffer);
+  bool isRedundant = bind(getIndexedKey(target, index), buffer);
+  if (bind(target, buffer) && isRedundant) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
+    GLsizeiptr size) {
+  NULLGL_CALL(BindBufferRange, E(target), index, buffer, offset, size);
+  // never redundant, since range may differ
+  bind(getIndexedKey(target, index), buffer);
+  bind(target, buffer);
+}
+
+
+void APIENTRY nullBindFragDataLocation(GLuint program, GLuint color, const GLchar* name) {
+  NULLGL_CALL(BindFragDataLocation, program, color, S(name));
+}
+
+
+void APIENTRY nullBindFramebuffer(GLenum target, GLuint framebuffer) {
+  NULLGL_CALL(BindFramebuffer, E(target), framebuffer);
+  bool isDraw = (target != GL_READ_FRAMEBUFFER);
+  bool isRead = (target != GL_DRAW_FRAMEBUFFER);
+  if ((!isDraw || state.drawFramebuffer == framebuffer)
+      && (!isRead || state.readFramebuffer == framebuffer)) {
+    ++counter.nRedundantCalls;
+  }
+  if (isDraw) {
+    state.drawFramebuffer = framebuffer;
+  }
+  if (isRead) {
+    state.readFramebuffer = framebuffer;
+  }
+}
+
+
+void APIENTRY nullBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+  NULLGL_CALL(BindRenderbuffer, E(target), renderbuffer);
+}
+
+
+void APIENTRY nullBindTexture(GLenum target, GLuint texture) {
+  NULLGL_CALL(BindTexture, E(target), texture);
+  if (bind(getTextureKey(target), texture)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullBindVertexArray(GLuint array) {
+  NULLGL_CALL(BindVertexArray, array);
+  if (array == state.vertexArray) {
+    ++counter.nRedundantCalls;
+  }
+  state.vertexArray = array;
+}
+
+
+void APIENTRY nullBlendFunc(GLenum sfactor, GLenum dfactor) {
+  NULLGL_CALL(BlendFunc, E(sfactor), E(dfactor));
+  if (setBlendFunc(sfactor, dfactor, sfactor, dfactor)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha,
+    GLenum dfactorAlpha) {
+  NULLGL_CALL(BlendFuncSeparate, E(sfactorRGB), E(dfactorRGB), E(sfactorAlpha), E(dfactorAlpha));
+  if (setBlendFunc(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0,
+    GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+  NULLGL_CALL(BlitFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, E(mask),
+      E(filter));
+}
+
+
+void APIENTRY nullBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+  NULLGL_CALL(BufferData, E(target), size, P(data), E(usage));
+}
+
+
+void APIENTRY nullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+  NULLGL_CALL(BufferSubData, E(target), offset, size, P(data));
+}
+
+
+GLenum APIENTRY nullCheckFramebufferStatus(GLenum target) {
+  NULLGL_CALL(CheckFramebufferStatus, E(target));
+  return GL_FRAMEBUFFER_COMPLETE;
+}
+
+
+void APIENTRY nullClear(GLbitfield mask) {
+  NULLGL_CALL(Clear, E(mask));
+}
+
+
+void APIENTRY nullClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* value) {
+  NULLGL_CALL(ClearBufferfv, E(buffer), drawbuffer, P(value));
+}
+
+
+void APIENTRY nullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+  NULLGL_CALL(ClearColor, red, green, blue, alpha);
+}
+
+
+GLenum APIENTRY nullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  NULLGL_CALL(ClientWaitSync, P(sync), E(flags), timeout);
+  return GL_ALREADY_SIGNALED;
+}
+
+
+void APIENTRY nullColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+  NULLGL_CALL(ColorMask, B(red), B(green), B(blue), B(alpha));
+}
+
+
+void APIENTRY nullCompileShader(GLuint shader) {
+  NULLGL_CALL(CompileShader, shader);
+}
+
+
+void APIENTRY nullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat,
+    GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data) {
+  NULLGL_CALL(CompressedTexImage2D, E(target), level, E(internalformat), width, height, border,
+      imageSize, P(data));
+}
+
+
+void APIENTRY nullCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+    GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data) {
+  NULLGL_CALL(CompressedTexSubImage2D, E(target), level, xoffset, yoffset, width, height,
+      E(format), imageSize, P(data));
+}
+
+
+GLuint APIENTRY nullCreateProgram() {
+  NULLGL_CALL0(CreateProgram);
+  return ++state.nextName;
+}
+
+
+GLuint APIENTRY nullCreateShader(GLenum type) {
+  NULLGL_CALL(CreateShader, E(type));
+  GLuint shader = ++state.nextName;
+  state.shaderTypes[shader] = type;
+  return shader;
+}
+
+
+void APIENTRY nullDebugMessageCallback(GLDEBUGPROC callback, const void* userParam) {
+  NULLGL_CALL(DebugMessageCallback, P(callback), P(userParam));
+}
+
+
+void APIENTRY nullDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count,
+    const GLuint* ids, GLboolean enabled) {
+  NULLGL_CALL(DebugMessageControl, E(source), E(type), E(severity), count, P(ids), B(enabled));
+}
+
+
+void APIENTRY nullDeleteBuffers(GLsizei n, const GLuint* buffers) {
+  NULLGL_CALL(DeleteBuffers, n, P(buffers));
+  for (GLsizei i = 0; i < n; ++i) {
+    unbind(buffers[i]);
+  }
+}
+
+
+void APIENTRY nullDeleteFramebuffers(GLsizei n, const GLuint* framebuffers) {
+  NULLGL_CALL(DeleteFramebuffers, n, P(framebuffers));
+  for (GLsizei i = 0; i < n; ++i) {
+    unbind(framebuffers[i]);
+  }
+}
+
+
+void APIENTRY nullDeleteProgram(GLuint program) {
+  NULLGL_CALL(DeleteProgram, program);
+}
+
+
+void APIENTRY nullDeleteQueries(GLsizei n, const GLuint* ids) {
+  NULLGL_CALL(DeleteQueries, n, P(ids));
+}
+
+
+void APIENTRY nullDeleteShader(GLuint shader) {
+  NULLGL_CALL(DeleteShader, shader);
+}
+
+
+void APIENTRY nullDeleteSync(GLsync sync) {
+  NULLGL_CALL(DeleteSync, P(sync));
+}
+
+
+void APIENTRY nullDeleteTextures(GLsizei n, const GLuint* textures) {
+  NULLGL_CALL(DeleteTextures, n, P(textures));
+  for (GLsizei i = 0; i < n; ++i) {
+    unbind(textures[i]);
+  }
+}
+
+
+void APIENTRY nullDeleteVertexArrays(GLsizei n, const GLuint* arrays) {
+  NULLGL_CALL(DeleteVertexArrays, n, P(arrays));
+  for (GLsizei i = 0; i < n; ++i) {
+    unbind(arrays[i]);
+  }
+}
+
+
+void APIENTRY nullDepthMask(GLboolean flag) {
+  NULLGL_CALL(DepthMask, B(flag));
+  if (flag == state.depthMask) {
+    ++counter.nRedundantCalls;
+  }
+  state.depthMask = flag;
+}
+
+
+void APIENTRY nullDisable(GLenum cap) {
+  NULLGL_CALL(Disable, E(cap));
+  if (setCapability(cap, false)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullDrawArrays(GLenum mode, GLint first, GLsizei count) {
+  NULLGL_CALL(DrawArrays, E(mode), first, count);
+}
+
+
+void APIENTRY nullDrawArraysInstanced(GLenum mode, GLint first, GLsizei count,
+    GLsizei instancecount) {
+  NULLGL_CALL(DrawArraysInstanced, E(mode), first, count, instancecount);
+}
+
+
+void APIENTRY nullDrawBuffer(GLenum buf) {
+  NULLGL_CALL(DrawBuffer, E(buf));
+}
+
+
+void APIENTRY nullDrawBuffers(GLsizei n, const GLenum* bufs) {
+  NULLGL_CALL(DrawBuffers, n, P(bufs));
+}
+
+
+void APIENTRY nullDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+  NULLGL_CALL(DrawElements, E(mode), count, E(type), P(indices));
+}
+
+
+void APIENTRY nullDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type,
+    const void* indices, GLint basevertex) {
+  NULLGL_CALL(DrawElementsBaseVertex, E(mode), count, E(type), P(indices), basevertex);
+}
+
+
+void APIENTRY nullEnable(GLenum cap) {
+  NULLGL_CALL(Enable, E(cap));
+  if (setCapability(cap, true)) {
+    ++counter.nRedundantCalls;
+  }
+}
+
+
+void APIENTRY nullEnableVertexAttribArray(GLuint index) {
+  NULLGL_CALL(EnableVertexAttribArray, index);
+}
+
+
+void APIENTRY nullEndQuery(GLenum target) {
+  NULLGL_CALL(EndQuery, E(target));
+}
+
+
+GLsync APIENTRY nullFenceSync(GLenum condition, GLbitfield flags) {
+  NULLGL_CALL(FenceSync, E(condition), E(flags));
+  // any non-null sync object, already signaled
+  return reinterpret_cast<GLsync>(&state);
+}
+
+
+void APIENTRY nullFlush() {
+  NULLGL_CALL0(Flush);
+}
+
+
+void APIENTRY nullFramebufferRenderbuffer(GLenum target, GLenum attachment,
+    GLenum renderbuffertarget, GLuint renderbuffer) {
+  NULLGL_CALL(FramebufferRenderbuffer, E(target), E(attachment), E(renderbuffertarget),
+      renderbuffer);
+}
+
+
+void APIENTRY nullFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
+    GLuint texture, GLint level) {
+  NULLGL_CALL(FramebufferTexture2D, E(target), E(attachment), E(textarget), texture, level);
+}
+
+
+void APIENTRY nullFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture,
+    GLint level, GLint layer) {
+  NULLGL_CALL(FramebufferTextureLayer, E(target), E(attachment), texture, level, layer);
+}
+
+
+void APIENTRY nullGenBuffers(GLsizei n, GLuint* buffers) {
+  NULLGL_CALL(GenBuffers, n, P(buffers));
+  for (GLsizei i = 0; i < n; ++i) {
+    buffers[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenFramebuffers(GLsizei n, GLuint* framebuffers) {
+  NULLGL_CALL(GenFramebuffers, n, P(framebuffers));
+  for (GLsizei i = 0; i < n; ++i) {
+    framebuffers[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenQueries(GLsizei n, GLuint* ids) {
+  NULLGL_CALL(GenQueries, n, P(ids));
+  for (GLsizei i = 0; i < n; ++i) {
+    ids[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenRenderbuffers(GLsizei n, GLuint* renderbuffers) {
+  NULLGL_CALL(GenRenderbuffers, n, P(renderbuffers));
+  for (GLsizei i = 0; i < n; ++i) {
+    renderbuffers[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenTextures(GLsizei n, GLuint* textures) {
+  NULLGL_CALL(GenTextures, n, P(textures));
+  for (GLsizei i = 0; i < n; ++i) {
+    textures[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenVertexArrays(GLsizei n, GLuint* arrays) {
+  NULLGL_CALL(GenVertexArrays, n, P(arrays));
+  for (GLsizei i = 0; i < n; ++i) {
+    arrays[i] = ++state.nextName;
+  }
+}
+
+
+void APIENTRY nullGenerateMipmap(GLenum target) {
+  NULLGL_CALL(GenerateMipmap, E(target));
+}
+
+
+void APIENTRY nullGetActiveUniformsiv(GLuint program, GLsizei uniformCount,
+    const GLuint* uniformIndices, GLenum pname, GLint* params) {
+  NULLGL_CALL(GetActiveUniformsiv, program, uniformCount, P(uniformIndices), E(pname), P(params));
+  for (GLsizei i = 0; i < uniformCount; ++i) {
+    params[i] = 0;
+  }
+}
+
+
+void APIENTRY nullGetBooleanv(GLenum pname, GLboolean* data) {
+  NULLGL_CALL(GetBooleanv, E(pname), P(data));
+  data[0] = (pname == GL_DEPTH_WRITEMASK) ? state.depthMask : GL_FALSE;
+}
+
+
+void APIENTRY nullGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void* data) {
+  NULLGL_CALL(GetBufferSubData, E(target), offset, size, P(data));
+  memset(data, 0, size);
+}
+
+
+GLenum APIENTRY nullGetError() {
+  NULLGL_CALL0(GetError);
+  return GL_NO_ERROR;
+}
+
+
+void APIENTRY nullGetFloatv(GLenum pname, GLfloat* data) {
+  NULLGL_CALL(GetFloatv, E(pname), P(data));
+  switch (pname) {
+    case GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT:
+      data[0] = 16.f;
+      break;
+    case GL_POLYGON_OFFSET_FACTOR:
+      data[0] = state.polygonOffset[0];
+      break;
+    case GL_POLYGON_OFFSET_UNITS:
+      data[0] = state.polygonOffset[1];
+      break;
+    default:
+      data[0] = 0.f;
+      break;
+  }
+}
+
+
+void APIENTRY nullGetIntegeri_v(GLenum target, GLuint index, GLint* data) {
+  NULLGL_CALL(GetIntegeri_v, E(target), index, P(data));
+  data[0] = (target == GL_UNIFORM_BUFFER_BINDING) ?
+      getBinding(getIndexedKey(GL_UNIFORM_BUFFER, index)) : 0;
+}
+
+
+void APIENTRY nullGetIntegerv(GLenum pname, GLint* data) {
+  NULLGL_CALL(GetIntegerv, E(pname), P(data));
+  getInteger(pname, data);
+}
+
+
+void APIENTRY nullGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length,
+    GLenum* binaryFormat, void* binary) {
+  NULLGL_CALL(GetProgramBinary, program, bufSize, P(length), P(binaryFormat), P(binary));
+  if (length) {
+    *length = 0;
+  }
+}
+
+
+void APIENTRY nullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length,
+    GLchar* infoLog) {
+  NULLGL_CALL(GetProgramInfoLog, program, bufSize, P(length), P(infoLog));
+  if (length) {
+    *length = 0;
+  }
+  if (bufSize > 0) {
+    infoLog[0] = '\0';
+  }
+}
+
+
+void APIENTRY nullGetProgramiv(GLuint program, GLenum pname, GLint* params) {
+  NULLGL_CALL(GetProgramiv, program, E(pname), P(params));
+  switch (pname) {
+    case GL_LINK_STATUS:
+    case GL_VALIDATE_STATUS:
+    case GL_COMPLETION_STATUS_KHR:
+      *params = GL_TRUE;
+      break;
+    default:
+      *params = 0;
+      break;
+  }
+}
+
+
+void APIENTRY nullGetQueryObjectiv(GLuint id, GLenum pname, GLint* params) {
+  NULLGL_CALL(GetQueryObjectiv, id, E(pname), P(params));
+  *params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+}
+
+
+void APIENTRY nullGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params) {
+  NULLGL_CALL(GetQueryObjectui64v, id, E(pname), P(params));
+  *params = 0;
+}
+
+
+void APIENTRY nullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length,
+    GLchar* infoLog) {
+  NULLGL_CALL(GetShaderInfoLog, shader, bufSize, P(length), P(infoLog));
+  if (length) {
+    *length = 0;
+  }
+  if (bufSize > 0) {
+    infoLog[0] = '\0';
+  }
+}
+
+
+void APIENTRY nullGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source) {
+  NULLGL_CALL(GetShaderSource, shader, bufSize, P(length), P(source));
+  if (length) {
+    *length = 0;
+  }
+  if (bufSize > 0) {
+    source[0] = '\0';
+  }
+}
+
+
+void APIENTRY nullGetShaderiv(GLuint shader, GLenum pname, GLint* params) {
+  NULLGL_CALL(GetShaderiv, shader, E(pname), P(params));
+  switch (pname) {
+    case GL_COMPILE_STATUS:
+    case GL_COMPLETION_STATUS_KHR:
+      *params = GL_TRUE;
+      break;
+    case GL_SHADER_TYPE:
+      *params = static_cast<GLint>(state.shaderTypes[shader]);
+      break;
+    default:
+      *params = 0;
+      break;
+  }
+}
+
+
+const GLubyte* APIENTRY nullGetString(GLenum name) {
+  NULLGL_CALL(GetString, E(name));
+  return reinterpret_cast<const GLubyte*>(getString(name));
+}
+
+
+const GLubyte* APIENTRY nullGetStringi(GLenum name, GLuint index) {
+  NULLGL_CALL(GetStringi, E(name), index);
+  return reinterpret_cast<const GLubyte*>(
+      (name == GL_EXTENSIONS && index < N_EXTENSIONS) ? EXTENSIONS[index] : "");
+}
+
+
+GLuint APIENTRY nullGetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName) {
+  NULLGL_CALL(GetUniformBlockIndex, program, S(uniformBlockName));
+  return 0;
+}
+
+
+void APIENTRY nullGetUniformIndices(GLuint program, GLsizei uniformCount,
+    const GLchar*const* uniformNames, GLuint* uniformIndices) {
+  NULLGL_CALL(GetUniformIndices, program, uniformCount, P(uniformNames), P(uniformIndices));
+  for (GLsizei i = 0; i < uniformCount; ++i) {
+    uniformIndices[i] = i;
+  }
+}
+
+
+GLint APIENTRY nullGetUniformLocation(GLuint program, const GLchar* name) {
+  NULLGL_CALL(GetUniformLocation, program, S(name));
+  // same location for same name, independent of program
+  auto result = state.uniformLocations.insert(
+      std::make_pair(std::string(name), static_cast<GLint>(state.uniformLocations.size())));
+  return result.first->second;
+}
+
+
+GLboolean APIENTRY nullIsBuffer(GLuint buffer) {
+  NULLGL_CALL(IsBuffer, buffer);
+  return GL_TRUE;
+}
+
+
+GLboolean APIENTRY nullIsEnabled(GLenum cap) {
+  NULLGL_CALL(IsEnabled, E(cap));
+  return getCapability(cap) ? GL_TRUE : GL_FALSE;
+}
+
+
+GLboolean APIENTRY nullIsProgram(GLuint program) {
+  NULLGL_CALL(IsProgram, program);
+  return GL_TRUE;
+}
+
+
+GLboolean APIENTRY nullIsShader(GLuint shader) {
+  NULLGL_CALL(IsShader, shader);
+  return GL_TRUE;
+}
+
+
+GLboolean APIENTRY nullIsTexture(GLuint texture) {
+  NULLGL_CALL(IsTexture, texture);
+  return GL_TRUE;
+}
+
+
+GLboolean APIENTRY nullIsVertexArray(GLuint array) {
+  NULLGL_CALL(IsVertexArray, array);
+  return GL_TRUE;
+}
+
+
+void APIENTRY nullLinkProgram(GLuint program) {
+  NULLGL_CALL(LinkProgram, program);
+}
+
+
+void* APIENTRY nullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length,
+    GLbitfield access) {
+  NULLGL_CALL(MapBufferRange, E(target), offset, length, E(access));
+  if (state.mapBuffer.size() < static_cast<size_t>(length)) {
+    state.mapBuffer.resize(length);
+  }
+  return state.mapBuffer.data();
+}
+
+
+void APIENTRY nullMaxShaderCompilerThreadsKHR(GLuint count) {
+  NULLGL_CALL(MaxShaderCompilerThreadsKHR, count);
+}
+
+
+void APIENTRY nullMultiDrawElementsIndirect(GLenum mode, GLenum type, const void* indirect,
+    GLsizei drawcount, GLsizei stride) {
+  NULLGL_CALL(MultiDrawElementsIndirect, E(mode), E(type), P(indirect), drawcount, stride);
+}
+
+
+void APIENTRY nullObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar* label) {
+  NULLGL_CALL(ObjectLabel, E(identifier), name, length, S(label));
+}
+
+
+void APIENTRY nullPolygonMode(GLenum face, GLenum mode) {
+  NULLGL_CALL(PolygonMode, E(face), E(mode));
+  state.polygonMode = mode;
+}
+
+
+void APIENTRY nullPolygonOffset(GLfloat factor, GLfloat units) {
+  NULLGL_CALL(PolygonOffset, factor, units);
+  state.polygonOffset[0] = factor;
+  state.polygonOffset[1] = units;
+}
+
+
+void APIENTRY nullPopDebugGroup() {
+  NULLGL_CALL0(PopDebugGroup);
+}
+
+
+void APIENTRY nullProgramBinary(GLuint program, GLenum binaryFormat, const void* binary,
+    GLsizei length) {
+  NULLGL_CALL(ProgramBinary, program, E(binaryFormat), P(binary), length);
+}
+
+
+void APIENTRY nullProgramParameteri(GLuint program, GLenum pname, GLint value) {
+  NULLGL_CALL(ProgramParameteri, program, E(pname), value);
+}
+
+
+void APIENTRY nullPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar* message) {
+  NULLGL_CALL(PushDebugGroup, E(source), id, length, S(message));
+}
+
+
+void APIENTRY nullQueryCounter(GLuint id, GLenum target) {
+  NULLGL_CALL(QueryCounter, id, E(target));
+}
+
+
+void APIENTRY nullReadBuffer(GLenum src) {
+  NULLGL_CALL(ReadBuffer, E(src));
+}
+
+
+void APIENTRY nullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format,
+    GLenum type, void* pixels) {
+  NULLGL_CALL(ReadPixels, x, y, width, height, E(format), E(type), P(pixels));
+}
+
+
+void APIENTRY nullRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width,
+    GLsizei height) {
+  NULLGL_CALL(RenderbufferStorage, E(target), E(internalformat), width, height);
+}
+
+
+void APIENTRY nullShaderSource(GLuint shader, GLsizei count, const GLchar*const* string,
+    const GLint* length) {
+  NULLGL_CALL(ShaderSource, shader, count, P(string), P(length));
+}
+
+
+void APIENTRY nullTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+  NULLGL_CALL(TexBuffer, E(target), E(internalformat), buffer);
+}
+
+
+void APIENTRY nullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width,
+    GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) {
+  NULLGL_CALL(TexImage2D, E(target), level, internalformat, width, height, border, E(format),
+      E(type), P(pixels));
+}
+
+
+void APIENTRY nullTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width,
+    GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels) {
+  NULLGL_CALL(TexImage3D, E(target), level, internalformat, width, height, depth, border,
+      E(format), E(type), P(pixels));
+}
+
+
+void APIENTRY nullTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+  NULLGL_CALL(TexParameterf, E(target), E(pname), param);
+}
+
+
+void APIENTRY nullTexParameteri(GLenum target, GLenum pname, GLint param) {
+  NULLGL_CALL(TexParameteri, E(target), E(pname), param);
+}
+
+
+void APIENTRY nullTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width,
+    GLsizei height) {
+  NULLGL_CALL(TexStorage2D, E(target), levels, E(internalformat), width, height);
+}
+
+
+void APIENTRY nullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+    GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels) {
+  NULLGL_CALL(TexSubImage2D, E(target), level, xoffset, yoffset, width, height, E(format), E(type),
+      P(pixels));
+}
+
+
+void APIENTRY nullTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+    GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type,
+    const void* pixels) {
+  NULLGL_CALL(TexSubImage3D, E(target), level, xoffset, yoffset, zoffset, width, height, depth,
+      E(format), E(type), P(pixels));
+}
+
+
+void APIENTRY nullUniform1f(GLint location, GLfloat v0) {
+  NULLGL_CALL(Uniform1f, location, v0);
+}
+
+
+void APIENTRY nullUniform1fv(GLint location, GLsizei count, const GLfloat* value) {
+  NULLGL_CALL(Uniform1fv, location, count, F(value, count));
+}
+
+
+void APIENTRY nullUniform1i(GLint location, GLint v0) {
+  NULLGL_CALL(Uniform1i, location, v0);
+}
+
+
+void APIENTRY nullUniform1iv(GLint location, GLsizei count, const GLint* value) {
+  NULLGL_CALL(Uniform1iv, location, count, I(value, count));
+}
+
+
+void APIENTRY nullUniform2fv(GLint location, GLsizei count, const GLfloat* value) {
+  NULLGL_CALL(Uniform2fv, location, count, F(value, 2 * count));
+}
+
+
+void APIENTRY nullUniform3fv(GLint location, GLsizei count, const GLfloat* value) {
+  NULLGL_CALL(Uniform3fv, location, count, F(value, 3 * count));
+}
+
+
+void APIENTRY nullUniform4fv(GLint location, GLsizei count, const GLfloat* value) {
+  NULLGL_CALL(Uniform4fv, location, count, F(value, 4 * count));
+}
+
+
+void APIENTRY nullUniformBlockBinding(GLuint program, GLuint uniformBlockIndex,
+    GLuint uniformBlockBinding) {
+  NULLGL_CALL(UniformBlockBinding, program, uniformBlockIndex, uniformBlockBinding);
+}
+
+
+void APIENTRY nullUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose,
+    const GLfloat* value) {
+  NULLGL_CALL(UniformMatrix2fv, location, count, B(transpose), F(value, 4 * count));
+}
+
+
+void APIENTRY nullUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose,
+    const GLfloat* value) {
+  NULLGL_CALL(UniformMatrix3fv, location, count, B(transpose), F(value, 9 * count));
+}
+
+
+void APIENTRY nullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose,
+    const GLfloat* value) {
+  NULLGL_CALL(UniformMatrix4fv, location, count, B(transpose), F(value, 16 * count));
+}
+
+
+GLboolean APIENTRY nullUnmapBuffer(GLenum target) {
+  NULLGL_CALL(UnmapBuffer, E(target));
+  return GL_TRUE;
+}
+
+
+void APIENTRY nullUseProgram(GLuint program) {
+  NULLGL_CALL(UseProgram, program);
+  if (program == state.program) {
+    ++counter.nRedundantCalls;
+  }
+  state.program = program;
+}
+
+
+void APIENTRY nullVertexAttrib4fv(GLuint index, const GLfloat* v) {
+  NULLGL_CALL(VertexAttrib4fv, index, F(v, 4));
+}
+
+
+void APIENTRY nullVertexAttribDivisor(GLuint index, GLuint divisor) {
+  NULLGL_CALL(VertexAttribDivisor, index, divisor);
+}
+
+
+void APIENTRY nullVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride,
+    const void* pointer) {
+  NULLGL_CALL(VertexAttribIPointer, index, size, E(type), stride, P(pointer));
+}
+
+
+void APIENTRY nullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+    GLsizei stride, const void* pointer) {
+  NULLGL_CALL(VertexAttribPointer, index, size, E(type), B(normalized), stride, P(pointer));
+}
+
+
+void APIENTRY nullViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  NULLGL_CALL(Viewport, x, y, width, height);
+  if (x == state.viewport[0] && y == state.viewport[1] && width == state.viewport[2]
+      && height == state.viewport[3]) {
+    ++counter.nRedundantCalls;
+  }
+  state.viewport[0] = x;
+  state.viewport[1] = y;
+  state.viewport[2] = width;
+  state.viewport[3] = height;
+}
+
+
+// shared by all entry points not used by scg3, called through pointers of any signature
+void APIENTRY nullUnlisted() {
+  static CallCounter counter("(unlisted)");
+  ++counter.nCalls;
+}
+
+#define NULLGL_ENTRY(name) { "gl" #name, reinterpret_cast<void*>(null##name) }
+
+void* loadProc(const char* name) {
+  static const std::unordered_map<std::string, void*> entries = {
+      NULLGL_ENTRY(ActiveTexture),
+      NULLGL_ENTRY(AttachShader),
+      NULLGL_ENTRY(BeginQuery),
+      NULLGL_ENTRY(BindAttribLocation),
+      NULLGL_ENTRY(BindBuffer),
+      NULLGL_ENTRY(BindBufferBase),
+      NULLGL_ENTRY(BindBufferRange),
+      NULLGL_ENTRY(BindFragDataLocation),
+      NULLGL_ENTRY(BindFramebuffer),
+      NULLGL_ENTRY(BindRenderbuffer),
+      NULLGL_ENTRY(BindTexture),
+      NULLGL_ENTRY(BindVertexArray),
+      NULLGL_ENTRY(BlendFunc),
+      NULLGL_ENTRY(BlendFuncSeparate),
+      NULLGL_ENTRY(BlitFramebuffer),
+      NULLGL_ENTRY(BufferData),
+      NULLGL_ENTRY(BufferSubData),
+      NULLGL_ENTRY(CheckFramebufferStatus),
+      NULLGL_ENTRY(Clear),
+      NULLGL_ENTRY(ClearBufferfv),
+      NULLGL_ENTRY(ClearColor),
+      NULLGL_ENTRY(ClientWaitSync),
+      NULLGL_ENTRY(ColorMask),
+      NULLGL_ENTRY(CompileShader),
+      NULLGL_ENTRY(CompressedTexImage2D),
+      NULLGL_ENTRY(CompressedTexSubImage2D),
+      NULLGL_ENTRY(CreateProgram),
+      NULLGL_ENTRY(CreateShader),
+      NULLGL_ENTRY(DebugMessageCallback),
+      NULLGL_ENTRY(DebugMessageControl),
+      NULLGL_ENTRY(DeleteBuffers),
+      NULLGL_ENTRY(DeleteFramebuffers),
+      NULLGL_ENTRY(DeleteProgram),
+      NULLGL_ENTRY(DeleteQueries),
+      NULLGL_ENTRY(DeleteShader),
+      NULLGL_ENTRY(DeleteSync),
+      NULLGL_ENTRY(DeleteTextures),
+      NULLGL_ENTRY(DeleteVertexArrays),
+      NULLGL_ENTRY(DepthMask),
+      NULLGL_ENTRY(Disable),
+      NULLGL_ENTRY(DrawArrays),
+      NULLGL_ENTRY(DrawArraysInstanced),
+      NULLGL_ENTRY(DrawBuffer),
+      NULLGL_ENTRY(DrawBuffers),
+      NULLGL_ENTRY(DrawElements),
+      NULLGL_ENTRY(DrawElementsBaseVertex),
+      NULLGL_ENTRY(Enable),
+      NULLGL_ENTRY(EnableVertexAttribArray),
+      NULLGL_ENTRY(EndQuery),
+      NULLGL_ENTRY(FenceSync),
+      NULLGL_ENTRY(Flush),
+      NULLGL_ENTRY(FramebufferRenderbuffer),
+      NULLGL_ENTRY(FramebufferTexture2D),
+      NULLGL_ENTRY(FramebufferTextureLayer),
+      NULLGL_ENTRY(GenBuffers),
+      NULLGL_ENTRY(GenFramebuffers),
+      NULLGL_ENTRY(GenQueries),
+      NULLGL_ENTRY(GenRenderbuffers),
+      NULLGL_ENTRY(GenTextures),
+      NULLGL_ENTRY(GenVertexArrays),
+      NULLGL_ENTRY(GenerateMipmap),
+      NULLGL_ENTRY(GetActiveUniformsiv),
+      NULLGL_ENTRY(GetBooleanv),
+      NULLGL_ENTRY(GetBufferSubData),
+      NULLGL_ENTRY(GetError),
+      NULLGL_ENTRY(GetFloatv),
+      NULLGL_ENTRY(GetIntegeri_v),
+      NULLGL_ENTRY(GetIntegerv),
+      NULLGL_ENTRY(GetProgramBinary),
+      NULLGL_ENTRY(GetProgramInfoLog),
+      NULLGL_ENTRY(GetProgramiv),
+      NULLGL_ENTRY(GetQueryObjectiv),
+      NULLGL_ENTRY(GetQueryObjectui64v),
+      NULLGL_ENTRY(GetShaderInfoLog),
+      NULLGL_ENTRY(GetShaderSource),
+      NULLGL_ENTRY(GetShaderiv),
+      NULLGL_ENTRY(GetString),
+      NULLGL_ENTRY(GetStringi),
+      NULLGL_ENTRY(GetUniformBlockIndex),
+      NULLGL_ENTRY(GetUniformIndices),
+      NULLGL_ENTRY(GetUniformLocation),
+      NULLGL_ENTRY(IsBuffer),
+      NULLGL_ENTRY(IsEnabled),
+      NULLGL_ENTRY(IsProgram),
+      NULLGL_ENTRY(IsShader),
+      NULLGL_ENTRY(IsTexture),
+      NULLGL_ENTRY(IsVertexArray),
+      NULLGL_ENTRY(LinkProgram),
+      NULLGL_ENTRY(MapBufferRange),
+      NULLGL_ENTRY(MaxShaderCompilerThreadsKHR),
+      NULLGL_ENTRY(MultiDrawElementsIndirect),
+      NULLGL_ENTRY(ObjectLabel),
+      NULLGL_ENTRY(PolygonMode),
+      NULLGL_ENTRY(PolygonOffset),
+      NULLGL_ENTRY(PopDebugGroup),
+      NULLGL_ENTRY(ProgramBinary),
+      NULLGL_ENTRY(ProgramParameteri),
+      NULLGL_ENTRY(PushDebugGroup),
+      NULLGL_ENTRY(QueryCounter),
+      NULLGL_ENTRY(ReadBuffer),
+      NULLGL_ENTRY(ReadPixels),
+      NULLGL_ENTRY(RenderbufferStorage),
+      NULLGL_ENTRY(ShaderSource),
+      NULLGL_ENTRY(TexBuffer),
+      NULLGL_ENTRY(TexImage2D),
+      NULLGL_ENTRY(TexImage3D),
+      NULLGL_ENTRY(TexParameterf),
+      NULLGL_ENTRY(TexParameteri),
+      NULLGL_ENTRY(TexStorage2D),
+      NULLGL_ENTRY(TexSubImage2D),
+      NULLGL_ENTRY(TexSubImage3D),
+      NULLGL_ENTRY(Uniform1f),
+      NULLGL_ENTRY(Uniform1fv),
+      NULLGL_ENTRY(Uniform1i),
+      NULLGL_ENTRY(Uniform1iv),
+      NULLGL_ENTRY(Uniform2fv),
+      NULLGL_ENTRY(Uniform3fv),
+      NULLGL_ENTRY(Uniform4fv),
+      NULLGL_ENTRY(UniformBlockBinding),
+      NULLGL_ENTRY(UniformMatrix2fv),
+      NULLGL_ENTRY(UniformMatrix3fv),
+      NULLGL_ENTRY(UniformMatrix4fv),
+      NULLGL_ENTRY(UnmapBuffer),
+      NULLGL_ENTRY(UseProgram),
+      NULLGL_ENTRY(VertexAttrib4fv),
+      NULLGL_ENTRY(VertexAttribDivisor),
+      NULLGL_ENTRY(VertexAttribIPointer),
+      NULLGL_ENTRY(VertexAttribPointer),
+      NULLGL_ENTRY(Viewport)
+  };
+  auto it = entries.find(name);
+  return (it != entries.end()) ? it->second : reinterpret_cast<void*>(nullUnlisted);
+}
+
+} /* namespace */
+
+
+void NullGL::load() {
+#ifdef SCG_GLAD_VERSION
+  if (!gladLoadGLLoader(loadProc)) {
+    throw std::runtime_error("gladLoadGLLoader() failed [NullGL::load()]");
+  }
+  isBackendLoaded = true;
+  reset();
+#else
+  throw std::runtime_error("Null OpenGL backend requires Glad [NullGL::load()]");
+#endif
+}
+
+
+bool NullGL::isLoaded() {
+  return isBackendLoaded;
+}
+
+
+void NullGL::reset() {
+  state = State();
+  resetCounters();
+  clearCallStream();
+}
+
+
+void NullGL::setRecording(bool isRecording) {
+  isRecordingCalls = isRecording;
+}
+
+
+bool NullGL::isRecording() {
+  return isRecordingCalls;
+}
+
+
+const std::vector<std::string>& NullGL::getCallStream() {
+  return callStream;
+}
+
+
+void NullGL::clearCallStream() {
+  callStream.clear();
+}
+
+
+void NullGL::writeCallStream(const std::string& fileName) {
+  std::ofstream stream(fileName);
+  if (!stream) {
+    throw std::runtime_error("Cannot open file " + fileName + " [NullGL::writeCallStream()]");
+  }
+  for (auto& call : callStream) {
+    stream << call << "\n";
+  }
+  if (!stream) {
+    throw std::runtime_error("Cannot write file " + fileName + " [NullGL::writeCallStream()]");
+  }
+}
+
+
+long NullGL::getNCalls() {
+  long nCalls = 0;
+  for (auto counter : getCounters()) {
+    nCalls += counter->nCalls;
+  }
+  return nCalls;
+}
+
+
+long NullGL::getNCalls(const std::string& functionName) {
+  for (auto counter : getCounters()) {
+    if (functionName == counter->name) {
+      return counter->nCalls;
+    }
+  }
+  return 0;
+}
+
+
+long NullGL::getNRedundantCalls() {
+  long nRedundantCalls = 0;
+  for (auto counter : getCounters()) {
+    nRedundantCalls += counter->nRedundantCalls;
+  }
+  return nRedundantCalls;
+}
+
+
+long NullGL::getNRedundantCalls(const std::string& functionName) {
+  for (auto counter : getCounters()) {
+    if (functionName == counter->name) {
+      return counter->nRedundantCalls;
+    }
+  }
+  return 0;
+}
+
+
+void NullGL::resetCounters() {
+  for (auto counter : getCounters()) {
+    counter->nCalls = 0;
+    counter->nRedundantCalls = 0;
+  }
+}
+
+
+std::string NullGL::getReport() {
+  std::vector<CallCounter*> counters = getCounters();
+  std::stable_sort(counters.begin(), counters.end(), [](CallCounter* a, CallCounter* b) {
+    return a->nCalls > b->nCalls;
+  });
+  std::stringstream stream;
+  stream << std::left << std::setw(36) << "GL function" << std::right << std::setw(12) << "calls"
+      << std::setw(12) << "redundant" << std::endl;
+  for (auto counter : counters) {
+    if (counter->nCalls > 0) {
+      stream << std::left << std::setw(36) << counter->name << std::right << std::setw(12)
+          << counter->nCalls << std::setw(12) << counter->nRedundantCalls << std::endl;
+    }
+  }
+  stream << std::left << std::setw(36) << "total" << std::right << std::setw(12) << getNCalls()
+      << std::setw(12) << getNRedundantCalls() << std::endl;
+  return stream.str();
+}
+
+
+} /* namespace scg */
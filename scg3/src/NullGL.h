@@ -0,0 +1,149 @@
+/**
+ * \file NullGL.h
+ * \brief Null OpenGL backend with no-op entry points, call counting, and call stream recording.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULLGL_H_
+#define NULLGL_H_
+
+#include <string>
+#include <vector>
+
+namespace scg {
+
+
+/**
+ * \brief Null OpenGL backend with no-op entry points, call counting, and call stream recording.
+ *
+ * load() replaces the Glad function pointers by no-op implementations, such that scg3 runs
+ * without any OpenGL context or driver, e.g., for CPU-side benchmarks of traversal, matrix
+ * math, and state management, and for tests on machines without OpenGL.
+ * It is used by the Viewer if OGLConfig::nullGL is set, and by scg3_microbench.
+ *
+ * The backend behaves like a minimal OpenGL 4.1 implementation: object names are generated
+ * in ascending order, shaders compile and link without errors, framebuffers are complete,
+ * uniform locations are assigned per uniform name, and state queries (bindings, viewport,
+ * enabled capabilities, etc.) return the state set before.
+ *
+ * For each entry point, calls and redundant calls are counted. A call is redundant if it
+ * does not change the state tracked by the backend, e.g., glUseProgram() with the current
+ * program, glBindTexture() with the texture bound to the active unit, glEnable() of an
+ * enabled capability.
+ *
+ * If recording is enabled, each call is appended to the call stream with its arguments,
+ * e.g., "glBindBuffer(0x8892, 3)", where enums and bitfields are written in hexadecimal,
+ * uniform values in brackets, and other pointers as "ptr" or "null". The call stream can
+ * be written to a text file and compared with a golden file. Values depending on the
+ * wall clock (e.g., the uniform OGLConstants::TIME) differ between runs.
+ *
+ * Only the entry points used by scg3 are implemented individually. All other entry points
+ * share a generic no-op function, counted as "(unlisted)", which requires a calling
+ * convention where the caller cleans up the stack (e.g., x86-64, ARM64).
+ * The backend requires Glad (cf. scg_glew_glad.h) and an OpenGL context must not be
+ * made current while it is loaded.
+ */
+class NullGL {
+
+public:
+
+  /**
+   * Replace OpenGL entry points by null backend, reset state, counters, and call stream.
+   * Throws an exception if scg3 is built with GLEW instead of Glad.
+   */
+  static void load();
+
+  /**
+   * Check if null backend has been loaded.
+   */
+  static bool isLoaded();
+
+  /**
+   * Reset object names, tracked state, counters, and call stream.
+   */
+  static void reset();
+
+  /**
+   * Enable or disable call stream recording (default: false).
+   */
+  static void setRecording(bool isRecording);
+
+  /**
+   * Check if call stream recording is enabled.
+   */
+  static bool isRecording();
+
+  /**
+   * Get recorded call stream, one call per element.
+   */
+  static const std::vector<std::string>& getCallStream();
+
+  /**
+   * Clear recorded call stream.
+   */
+  static void clearCallStream();
+
+  /**
+   * Write recorded call stream to text file, one call per line.
+   * Throws an exception if the file cannot be written.
+   */
+  static void writeCallStream(const std::string& fileName);
+
+  /**
+   * Get total number of calls since last reset.
+   */
+  static long getNCalls();
+
+  /**
+   * Get number of calls of given entry point since last reset, e.g., getNCalls("glUseProgram").
+   */
+  static long getNCalls(const std::string& functionName);
+
+  /**
+   * Get total number of redundant calls since last reset.
+   */
+  static long getNRedundantCalls();
+
+  /**
+   * Get number of redundant calls of given entry point since last reset.
+   */
+  static long getNRedundantCalls(const std::string& functionName);
+
+  /**
+   * Reset call counters, keeping state and call stream.
+   */
+  static void resetCounters();
+
+  /**
+   * Get table of calls and redundant calls per entry point, sorted by number of calls.
+   */
+  static std::string getReport();
+
+private:
+
+  NullGL();
+
+};
+
+
+} /* namespace scg */
+
+#endif /* NULLGL_H_ */
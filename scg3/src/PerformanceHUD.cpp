@@ -0,0 +1,571 @@
+/**
+ * \file PerformanceHUD.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include "FrameProfiler.h"
+#include "PerformanceHUD.h"
+#include "Renderer.h"
+#include "RenderState.h"
+#include "ResourceCache.h"
+#include "ShaderCore.h"
+#include "ShaderCoreFactory.h"
+#include "scg_utilities.h"
+#include "ViewState.h"
+
+namespace scg {
+
+
+// font: characters 32 to 126, cells of 6 x 8 texels, each containing a 5 x 8 glyph and
+// one texel spacing
+static const int FIRST_CHAR = 32;
+static const int LAST_CHAR = 126;
+static const int CELL_WIDTH = 6;
+static const int CELL_HEIGHT = 8;
+
+// layout (texels): panel offset from top left corner, padding, line spacing
+static const int PANEL_OFFSET = 4;
+static const int PANEL_PADDING = 3;
+static const int LINE_HEIGHT = CELL_HEIGHT + 1;
+
+// text: number of lines, maximum number of characters per line
+static const int N_LINES = 8;
+static const int LINE_LENGTH = 40;
+
+// number of textures, i.e., frames in flight
+static const size_t N_TEXTURES = 3;
+
+// frame time graph: number of frames, height (texels), time of full height (ms)
+static const size_t GRAPH_FRAMES = 120;
+static const int GRAPH_HEIGHT = 20;
+static const GLfloat GRAPH_MAX_TIME = 100.f / 3.f;
+static const GLfloat FRAME_BUDGET = 100.f / 6.f;   // 60 Hz
+
+// colors (RGBA)
+static const GLubyte PANEL_COLOR[4] = {0, 0, 0, 160};
+static const GLubyte TEXT_COLOR[4] = {255, 255, 255, 255};
+static const GLubyte BUDGET_COLOR[4] = {255, 255, 255, 128};
+static const GLubyte GOOD_COLOR[4] = {64, 208, 64, 255};       // within frame budget
+static const GLubyte WARN_COLOR[4] = {240, 192, 32, 255};      // up to two frames
+static const GLubyte BAD_COLOR[4] = {240, 64, 48, 255};
+
+// 5 x 7 font with additional row for descenders, characters 32 to 126, one byte per row
+// from top to bottom, bit 4 is the leftmost column
+static const GLubyte FONT_5X8[95][8] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // space
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00},  // !
+    {0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00},  // "
+    {0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a, 0x00},  // #
+    {0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04, 0x00},  // $
+    {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03, 0x00},  // %
+    {0x0c, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0d, 0x00},  // &
+    {0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},  // '
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00},  // (
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00},  // )
+    {0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00, 0x00},  // *
+    {0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00},  // +
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08, 0x00},  // ,
+    {0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00},  // -
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00},  // .
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00},  // /
+    {0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e, 0x00},  // 0
+    {0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00},  // 1
+    {0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f, 0x00},  // 2
+    {0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e, 0x00},  // 3
+    {0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02, 0x00},  // 4
+    {0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e, 0x00},  // 5
+    {0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e, 0x00},  // 6
+    {0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, 0x00},  // 7
+    {0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00},  // 8
+    {0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c, 0x00},  // 9
+    {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00},  // :
+    {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x04, 0x08, 0x00},  // ;
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00},  // <
+    {0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00},  // =
+    {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x00},  // >
+    {0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04, 0x00},  // ?
+    {0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e, 0x00},  // @
+    {0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00},  // A
+    {0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e, 0x00},  // B
+    {0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00},  // C
+    {0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c, 0x00},  // D
+    {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00},  // E
+    {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10, 0x00},  // F
+    {0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f, 0x00},  // G
+    {0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00},  // H
+    {0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00},  // I
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c, 0x00},  // J
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11, 0x00},  // K
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00},  // L
+    {0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, 0x00},  // M
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00},  // N
+    {0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00},  // O
+    {0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10, 0x00},  // P
+    {0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d, 0x00},  // Q
+    {0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11, 0x00},  // R
+    {0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e, 0x00},  // S
+    {0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00},  // T
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00},  // U
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00},  // V
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, 0x00},  // W
+    {0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00},  // X
+    {0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00},  // Y
+    {0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f, 0x00},  // Z
+    {0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00},  // [
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00},  // backslash
+    {0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00},  // ]
+    {0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00},  // ^
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00},  // _
+    {0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00},  // `
+    {0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x0f, 0x00},  // a
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e, 0x00},  // b
+    {0x00, 0x00, 0x0e, 0x10, 0x10, 0x11, 0x0e, 0x00},  // c
+    {0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f, 0x00},  // d
+    {0x00, 0x00, 0x0e, 0x11, 0x1f, 0x10, 0x0e, 0x00},  // e
+    {0x06, 0x09, 0x08, 0x1c, 0x08, 0x08, 0x08, 0x00},  // f
+    {0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x0e},  // g
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00},  // h
+    {0x04, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x0e, 0x00},  // i
+    {0x02, 0x00, 0x06, 0x02, 0x02, 0x02, 0x12, 0x0c},  // j
+    {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12, 0x00},  // k
+    {0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00},  // l
+    {0x00, 0x00, 0x1a, 0x15, 0x15, 0x11, 0x11, 0x00},  // m
+    {0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00},  // n
+    {0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00},  // o
+    {0x00, 0x00, 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10},  // p
+    {0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01},  // q
+    {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10, 0x00},  // r
+    {0x00, 0x00, 0x0e, 0x10, 0x0e, 0x01, 0x1e, 0x00},  // s
+    {0x08, 0x08, 0x1c, 0x08, 0x08, 0x09, 0x06, 0x00},  // t
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d, 0x00},  // u
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00},  // v
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00},  // w
+    {0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00},  // x
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x0e},  // y
+    {0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x1f, 0x00},  // z
+    {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x00},  // {
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00},  // |
+    {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x00},  // }
+    {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00}   // ~
+};
+
+
+PerformanceHUD::PerformanceHUD()
+    : textures_(N_TEXTURES, 0), nextTexture_(0), vao_(0), vbo_(0), scale_(2),
+      updateInterval_(0.25), isTextValid_(false), isTextureValid_(false), nextLine_(N_LINES),
+      lineRows_(N_LINES, -1), invalidRows_(N_TEXTURES, std::make_pair(0, 0)), width_(0),
+      height_(0), graphRow_(0),
+      frameTimes_(GRAPH_FRAMES, 0.f), nextFrameTime_(0), nUploadedBytes_(0), cpuTime_(0.) {
+  ShaderCoreFactory shaderFactory;
+  shaderFactory.setResourceCache(ResourceCache::getDefault());
+  shaderCore_ = shaderFactory.createOverlayShader();
+  createBuffers_();
+
+  assert(!checkGLError());
+}
+
+
+PerformanceHUD::~PerformanceHUD() {
+  if (vbo_ != 0) {
+    glDeleteBuffers(1, &vbo_);
+  }
+  if (vao_ != 0) {
+    glDeleteVertexArrays(1, &vao_);
+  }
+  if (textures_[0] != 0) {
+    glDeleteTextures(static_cast<GLsizei>(textures_.size()), textures_.data());
+  }
+}
+
+
+PerformanceHUD* PerformanceHUD::setScale(int scale) {
+  assert(scale > 0);
+  scale_ = scale;
+  isTextureValid_ = false;
+  return this;
+}
+
+
+PerformanceHUD* PerformanceHUD::setUpdateInterval(double intervalSec) {
+  updateInterval_ = intervalSec;
+  return this;
+}
+
+
+double PerformanceHUD::getCPUTime() const {
+  return cpuTime_;
+}
+
+
+int PerformanceHUD::getNUploadedBytes() const {
+  return nUploadedBytes_;
+}
+
+
+void PerformanceHUD::render(const ViewState* viewState, const Renderer* renderer) {
+  assert(viewState && renderer);
+  auto startTime = std::chrono::steady_clock::now();
+
+  // add last frame time to graph
+  frameTimes_[nextFrameTime_] = static_cast<GLfloat>(viewState->getLastFrameTime());
+  nextFrameTime_ = (nextFrameTime_ + 1) % GRAPH_FRAMES;
+
+  // update text at fixed interval, one line per frame (all lines if invalid)
+  if (!isTextValid_) {
+    updateText_(viewState, renderer);
+    lastUpdateTime_ = startTime;
+    nextLine_ = N_LINES;
+  }
+  else {
+    if (nextLine_ >= N_LINES &&
+        std::chrono::duration<double>(startTime - lastUpdateTime_).count() >= updateInterval_) {
+      lastUpdateTime_ = startTime;
+      nextLine_ = 0;
+    }
+    if (nextLine_ < N_LINES) {
+      updateLine_(nextLine_++, viewState, renderer);
+    }
+  }
+
+  drawGraph_();
+  draw_();
+
+  // own CPU time (exponential moving average)
+  double cpuTime = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - startTime).count();
+  cpuTime_ = (cpuTime_ > 0.) ? 0.95 * cpuTime_ + 0.05 * cpuTime : cpuTime;
+}
+
+
+void PerformanceHUD::createBuffers_() {
+  GLint vaoOld = 0;
+  GLint bufferOld = 0;
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vaoOld);
+  glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &bufferOld);
+  glGenVertexArrays(1, &vao_);
+  glBindVertexArray(vao_);
+  glGenBuffers(1, &vbo_);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+  glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
+  glEnableVertexAttribArray(OGLConstants::VERTEX.location);
+  glVertexAttribPointer(OGLConstants::VERTEX.location, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+      reinterpret_cast<const GLvoid*>(offsetof(Vertex, pos)));
+  glEnableVertexAttribArray(OGLConstants::TEX_COORD_0.location);
+  glVertexAttribPointer(OGLConstants::TEX_COORD_0.location, 2, GL_FLOAT, GL_FALSE,
+      sizeof(Vertex), reinterpret_cast<const GLvoid*>(offsetof(Vertex, texCoord)));
+  glBindVertexArray(vaoOld);
+  glBindBuffer(GL_ARRAY_BUFFER, bufferOld);
+
+  // texture storage is (re-)allocated by draw_() when the image size is known
+  glGenTextures(static_cast<GLsizei>(textures_.size()), textures_.data());
+}
+
+
+void PerformanceHUD::formatLine_(int line, const ViewState* viewState,
+    const Renderer* renderer, char* text, size_t size) const {
+  const RenderStats& stats = renderer->getRenderStats();
+  FrameProfiler* profiler = viewState->getFrameProfiler();
+  text[0] = '\0';
+  switch (line) {
+    case 0: {
+      FrameTimeStats frameStats = viewState->getFrameTimeStats();
+      std::snprintf(text, size, "%5.1f fps %6.2f ms  p99 %6.2f ms",
+          (frameStats.avg > 0.) ? 1000. / frameStats.avg : 0., frameStats.avg, frameStats.p99);
+      break;
+    }
+    case 1:
+      std::snprintf(text, size, "draws %d  triangles %ld", stats.nDrawCalls, stats.nTriangles);
+      break;
+    case 2:
+      std::snprintf(text, size, "shapes %d  culled %d", stats.nShapesVisited,
+          stats.nShapesCulled);
+      break;
+    case 3:
+      std::snprintf(text, size, "programs %d  textures %d  buffers %d",
+          stats.nProgramSwitches, stats.nTextureBinds, stats.nBufferBinds);
+      break;
+    case 4:
+      std::snprintf(text, size, "uniforms %ld  uploaded %ld kB",
+          stats.nUniformUploads, stats.nUploadedBytes / 1024);
+      break;
+    case 5: {
+      ResourceCacheSP resourceCache = ResourceCache::getDefault();
+      std::snprintf(text, size, "cache %d resources %.1f MB",
+          resourceCache->getNEntries(), resourceCache->getBytesInUse() / (1024. * 1024.));
+      break;
+    }
+    case 6:
+      if (profiler->isEnabled()) {
+        std::snprintf(text, size, "render pass CPU %.2f ms  GPU %.2f ms",
+            profiler->getCPUStats(FrameProfiler::RENDER_PASS).avg,
+            profiler->getGPUStats(FrameProfiler::RENDER_PASS).avg);
+      }
+      break;
+    default:
+      std::snprintf(text, size, "hud %.3f ms  uploaded %d kB", cpuTime_,
+          nUploadedBytes_ / 1024);
+      break;
+  }
+}
+
+
+void PerformanceHUD::updateText_(const ViewState* viewState, const Renderer* renderer) {
+  // format lines (fixed buffer, no allocations)
+  char lines[N_LINES][LINE_LENGTH + 1];
+  for (int i = 0; i < N_LINES; ++i) {
+    formatLine_(i, viewState, renderer, lines[i], sizeof(lines[i]));
+  }
+
+  // layout: text lines (hidden if empty), frame time graph with one texel spacing
+  int row = PANEL_PADDING;
+  for (int i = 0; i < N_LINES; ++i) {
+    lineRows_[i] = (lines[i][0] != '\0') ? row : -1;
+    row += (lineRows_[i] >= 0) ? LINE_HEIGHT : 0;
+  }
+  graphRow_ = row + 1;
+  int width = 2 * PANEL_PADDING
+      + std::max(LINE_LENGTH * CELL_WIDTH, static_cast<int>(GRAPH_FRAMES));
+  int height = graphRow_ + GRAPH_HEIGHT + PANEL_PADDING;
+  if (width != width_ || height != height_) {
+    width_ = width;
+    height_ = height;
+    texels_.resize(4 * width_ * height_);
+    isTextureValid_ = false;
+  }
+
+  // rasterize all lines, clear bottom padding
+  clearRows_(0, graphRow_);
+  clearRows_(graphRow_ + GRAPH_HEIGHT, height_);
+  for (int i = 0; i < N_LINES; ++i) {
+    if (lineRows_[i] >= 0) {
+      drawText_(lineRows_[i], lines[i]);
+    }
+  }
+  invalidateRows_(0, graphRow_);
+  isTextValid_ = true;
+}
+
+
+void PerformanceHUD::updateLine_(int line, const ViewState* viewState,
+    const Renderer* renderer) {
+  assert(line >= 0 && line < N_LINES);
+  char text[LINE_LENGTH + 1];
+  formatLine_(line, viewState, renderer, text, sizeof(text));
+
+  // line shown or hidden: update layout
+  if ((text[0] != '\0') != (lineRows_[line] >= 0)) {
+    updateText_(viewState, renderer);
+    return;
+  }
+  if (lineRows_[line] >= 0) {
+    drawText_(lineRows_[line], text);
+    invalidateRows_(lineRows_[line], lineRows_[line] + LINE_HEIGHT);
+  }
+}
+
+
+void PerformanceHUD::drawText_(int row, const char* text) {
+  clearRows_(row, row + LINE_HEIGHT);
+  int x0 = PANEL_PADDING;
+  for (const char* c = text; *c != '\0'; ++c, x0 += CELL_WIDTH) {
+    int code = static_cast<unsigned char>(*c);
+    if (code <= FIRST_CHAR || code > LAST_CHAR) {
+      continue;   // space or not printable
+    }
+    const GLubyte* glyph = FONT_5X8[code - FIRST_CHAR];
+    for (int y = 0; y < CELL_HEIGHT; ++y) {
+      for (int x = 0; x < 5; ++x) {
+        if ((glyph[y] & (0x10 >> x)) != 0) {
+          std::memcpy(&texels_[4 * ((row + y) * width_ + x0 + x)], TEXT_COLOR, 4);
+        }
+      }
+    }
+  }
+}
+
+
+void PerformanceHUD::drawGraph_() {
+  clearRows_(graphRow_, graphRow_ + GRAPH_HEIGHT);
+  const int bottomRow = graphRow_ + GRAPH_HEIGHT;
+  for (size_t i = 0; i < GRAPH_FRAMES; ++i) {
+    GLfloat frameTime = frameTimes_[(nextFrameTime_ + i) % GRAPH_FRAMES];
+    if (frameTime <= 0.f) {
+      continue;
+    }
+    int height = std::max(1, static_cast<int>(
+        std::min(frameTime / GRAPH_MAX_TIME, 1.f) * GRAPH_HEIGHT + 0.5f));
+    const GLubyte* color = (frameTime <= FRAME_BUDGET) ? GOOD_COLOR
+        : ((frameTime <= 2.f * FRAME_BUDGET) ? WARN_COLOR : BAD_COLOR);
+    for (int row = bottomRow - height; row < bottomRow; ++row) {
+      std::memcpy(&texels_[4 * (row * width_ + PANEL_PADDING + i)], color, 4);
+    }
+  }
+
+  // frame budget line, blended over bars and panel (straight alpha)
+  const int budgetRow = bottomRow - static_cast<int>(FRAME_BUDGET / GRAPH_MAX_TIME * GRAPH_HEIGHT);
+  const int alpha = BUDGET_COLOR[3];
+  for (size_t i = 0; i < GRAPH_FRAMES; ++i) {
+    GLubyte* texel = &texels_[4 * (budgetRow * width_ + PANEL_PADDING + i)];
+    int dstAlpha = texel[3] * (255 - alpha) / 255;
+    int outAlpha = alpha + dstAlpha;
+    for (int j = 0; j < 3; ++j) {
+      texel[j] = static_cast<GLubyte>((BUDGET_COLOR[j] * alpha + texel[j] * dstAlpha) / outAlpha);
+    }
+    texel[3] = static_cast<GLubyte>(outAlpha);
+  }
+}
+
+
+void PerformanceHUD::clearRows_(int beginRow, int endRow) {
+  for (int i = beginRow * width_; i < endRow * width_; ++i) {
+    std::memcpy(&texels_[4 * i], PANEL_COLOR, 4);
+  }
+}
+
+
+void PerformanceHUD::uploadRows_(int beginRow, int endRow) {
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, beginRow, width_, endRow - beginRow, GL_RGBA,
+      GL_UNSIGNED_BYTE, &texels_[4 * beginRow * width_]);
+  nUploadedBytes_ += 4 * (endRow - beginRow) * width_;
+}
+
+
+void PerformanceHUD::invalidateRows_(int beginRow, int endRow) {
+  for (auto& rows : invalidRows_) {
+    if (rows.first >= rows.second) {
+      rows = std::make_pair(beginRow, endRow);
+    }
+    else {
+      rows = std::make_pair(std::min(rows.first, beginRow), std::max(rows.second, endRow));
+    }
+  }
+}
+
+
+void PerformanceHUD::draw_() {
+  // save OpenGL state
+  GLint viewport[4];
+  GLint programOld = 0;
+  GLint vaoOld = 0;
+  GLint bufferOld = 0;
+  GLint texOld = 0;
+  GLint polygonModeOld[2] = {GL_FILL, GL_FILL};
+  GLint blendFuncOld[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  glGetIntegerv(GL_CURRENT_PROGRAM, &programOld);
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vaoOld);
+  glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &bufferOld);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texOld);
+  glGetIntegerv(GL_POLYGON_MODE, polygonModeOld);
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blendFuncOld[0]);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blendFuncOld[1]);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendFuncOld[2]);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blendFuncOld[3]);
+  GLboolean isDepthTestOld = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean isCullFaceOld = glIsEnabled(GL_CULL_FACE);
+  GLboolean isBlendOld = glIsEnabled(GL_BLEND);
+
+  // alpha blending on top of the scene, only changed capabilities are set and restored
+  if (isDepthTestOld) {
+    glDisable(GL_DEPTH_TEST);
+  }
+  if (isCullFaceOld) {
+    glDisable(GL_CULL_FACE);
+  }
+  if (!isBlendOld) {
+    glEnable(GL_BLEND);
+  }
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  if (polygonModeOld[0] != GL_FILL) {
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+  }
+  glUseProgram(shaderCore_->getProgram());
+  const GLfloat viewportSize[2] = {
+      static_cast<GLfloat>(viewport[2]), static_cast<GLfloat>(viewport[3]) };
+  shaderCore_->setUniform2fv("viewportSize", 1, viewportSize);
+  glBindVertexArray(vao_);
+
+  // (re-)allocate textures with complete image and update quad after size or scale changes
+  nUploadedBytes_ = 0;
+  if (!isTextureValid_) {
+    for (size_t i = 0; i < textures_.size(); ++i) {
+      glBindTexture(GL_TEXTURE_2D, textures_[i]);
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+          texels_.data());
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+      invalidRows_[i] = std::make_pair(0, 0);
+    }
+    nUploadedBytes_ += static_cast<int>(textures_.size() * texels_.size());
+    const GLfloat x0 = static_cast<GLfloat>(PANEL_OFFSET * scale_);
+    const GLfloat x1 = x0 + width_ * scale_;
+    const GLfloat y1 = x0 + height_ * scale_;
+    const Vertex vertices[4] = {
+        {{x0, x0}, {0.f, 0.f}}, {{x1, x0}, {1.f, 0.f}}, {{x0, y1}, {0.f, 1.f}},
+        {{x1, y1}, {1.f, 1.f}} };
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+    isTextureValid_ = true;
+  }
+
+  // upload changed text rows and graph into next texture of the ring, which is not used
+  // by frames in flight
+  glBindTexture(GL_TEXTURE_2D, textures_[nextTexture_]);
+  auto& rows = invalidRows_[nextTexture_];
+  if (rows.first < rows.second) {
+    uploadRows_(rows.first, rows.second);
+    rows = std::make_pair(0, 0);
+  }
+  uploadRows_(graphRow_, graphRow_ + GRAPH_HEIGHT);
+  nextTexture_ = (nextTexture_ + 1) % textures_.size();
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+  // restore OpenGL state
+  glBindVertexArray(vaoOld);
+  glBindBuffer(GL_ARRAY_BUFFER, bufferOld);
+  glBindTexture(GL_TEXTURE_2D, texOld);
+  glUseProgram(programOld);
+  if (polygonModeOld[0] != GL_FILL) {
+    glPolygonMode(GL_FRONT_AND_BACK, polygonModeOld[0]);
+  }
+  glBlendFuncSeparate(blendFuncOld[0], blendFuncOld[1], blendFuncOld[2], blendFuncOld[3]);
+  if (!isBlendOld) {
+    glDisable(GL_BLEND);
+  }
+  if (isCullFaceOld) {
+    glEnable(GL_CULL_FACE);
+  }
+  if (isDepthTestOld) {
+    glEnable(GL_DEPTH_TEST);
+  }
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
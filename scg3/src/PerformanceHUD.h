@@ -0,0 +1,195 @@
+/**
+ * \file PerformanceHUD.h
+ * \brief On-screen performance overlay (heads-up display), rasterized into a texture.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PERFORMANCEHUD_H_
+#define PERFORMANCEHUD_H_
+
+#include <chrono>
+#include <utility>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief On-screen performance overlay (heads-up display) showing frame rate, frame times,
+ *    render statistics, and memory of cached resources, drawn by Viewer after the scene.
+ *
+ * The HUD is shown by ViewState::setHUDVisible() (key p of KeyboardController) and created
+ * by Viewer when it is shown for the first time. Text (5x7 pixel font) and the frame time
+ * graph are rasterized on the CPU into an RGBA image of one texel per font pixel, which
+ * is drawn as a single textured quad, magnified by the scale. Only changed texel rows are
+ * rasterized and uploaded: the text is updated at a fixed interval (default: 0.25 s), one
+ * line per frame in order to avoid spikes, and the graph is updated in every frame. Rows are
+ * uploaded into a ring of textures, such that no texture is modified while it may still be
+ * used by a previous frame, which would stall the pipeline. Drawing glyphs as individual quads
+ * would be expensive on software rasterizers (e.g., llvmpipe), whose costs scale with the
+ * number of primitives.
+ *
+ * The HUD shows its own CPU time in the last line. In addition, it is timed by the frame
+ * profiler as phase FrameProfiler::HUD (CPU and GPU time), cf. scg3_bench --hud=1.
+ */
+class PerformanceHUD {
+
+public:
+
+  /**
+   * Constructor, creates shader and buffers (requires OpenGL context).
+   */
+  PerformanceHUD();
+
+  /**
+   * Destructor, deletes OpenGL objects.
+   */
+  virtual ~PerformanceHUD();
+
+  /**
+   * Set size of a font pixel in pixels (default: 2).
+   * \return this pointer for method chaining
+   */
+  PerformanceHUD* setScale(int scale);
+
+  /**
+   * Set interval for text updates (default: 0.25 s).
+   * \return this pointer for method chaining
+   */
+  PerformanceHUD* setUpdateInterval(double intervalSec);
+
+  /**
+   * Get CPU time of render() (milliseconds, exponential moving average).
+   */
+  double getCPUTime() const;
+
+  /**
+   * Get number of texture bytes uploaded in last frame.
+   */
+  int getNUploadedBytes() const;
+
+  /**
+   * Render HUD into current viewport, called by Viewer after the scene has been rendered.
+   * The OpenGL state modified by the HUD is restored afterwards.
+   */
+  void render(const ViewState* viewState, const Renderer* renderer);
+
+protected:
+
+  /**
+   * Vertex of the textured quad.
+   */
+  struct Vertex {
+    GLfloat pos[2];             // x, y (pixels from top left corner)
+    GLfloat texCoord[2];
+  };
+
+  /**
+   * Create vertex array object, vertex buffer, and ring of textures.
+   */
+  void createBuffers_();
+
+  /**
+   * Format given text line from current statistics, empty if not available
+   * (e.g., profiler statistics if disabled).
+   */
+  void formatLine_(int line, const ViewState* viewState, const Renderer* renderer,
+      char* text, size_t size) const;
+
+  /**
+   * Format all text lines, determine layout, and rasterize text.
+   */
+  void updateText_(const ViewState* viewState, const Renderer* renderer);
+
+  /**
+   * Format and rasterize given text line, update layout if the line has been
+   * shown or hidden.
+   */
+  void updateLine_(int line, const ViewState* viewState, const Renderer* renderer);
+
+  /**
+   * Rasterize text into texel rows starting at given row.
+   */
+  void drawText_(int row, const char* text);
+
+  /**
+   * Rasterize frame time graph (oldest frame left) and frame budget line.
+   */
+  void drawGraph_();
+
+  /**
+   * Fill texel rows with panel color.
+   */
+  void clearRows_(int beginRow, int endRow);
+
+  /**
+   * Mark text rows as changed for all textures of the ring.
+   */
+  void invalidateRows_(int beginRow, int endRow);
+
+  /**
+   * Upload texel rows into bound texture.
+   */
+  void uploadRows_(int beginRow, int endRow);
+
+  /**
+   * Upload changed rows into next texture of the ring and draw textured quad.
+   */
+  void draw_();
+
+protected:
+
+  ShaderCoreSP shaderCore_;
+  std::vector<GLuint> textures_;  // ring
+  size_t nextTexture_;
+  GLuint vao_;
+  GLuint vbo_;
+  int scale_;
+  double updateInterval_;
+  std::chrono::steady_clock::time_point lastUpdateTime_;
+  bool isTextValid_;
+  bool isTextureValid_;         // texture size and quad
+  int nextLine_;                // next text line to be updated
+  std::vector<int> lineRows_;   // first texel row of each text line, -1 if hidden
+  std::vector<std::pair<int, int>> invalidRows_;  // changed text rows per texture
+  std::vector<GLubyte> texels_; // RGBA, top row first
+  int width_, height_;          // texels
+  int graphRow_;                // top row of frame time graph
+  std::vector<GLfloat> frameTimes_;  // ring buffer of frame graph
+  size_t nextFrameTime_;
+  int nUploadedBytes_;
+  double cpuTime_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(PerformanceHUD);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* PERFORMANCEHUD_H_ */
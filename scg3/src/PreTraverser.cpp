@@ -56,6 +56,16 @@ void PreTraverser::visitPostCamera(Camera* node) {
 }
 
 
+void PreTraverser::visitLight(Light* node) {
+  renderState_->collectLight(node);
+}
+
+
+void PreTraverser::visitPostLight(Light* node) {
+  renderState_->collectLightPost();
+}
+
+
 void PreTraverser::visitLightPosition(LightPosition* node) {
   node->getLight()->setModelTransform(renderState_->modelViewStack.getMatrix());
 }
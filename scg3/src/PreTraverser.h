@@ -1,6 +1,6 @@
 /**
  * \file PreTraverser.h
- * \brief A traverser that searches Camera and LightPosition nodes in the scene graph (visitor pattern).
+ * \brief A traverser that searches Camera, Light, and LightPosition nodes in the scene graph (visitor pattern).
  *
  * \author Volker Ahlers\n
  *         volker.ahlers@hs-hannover.de
@@ -32,7 +32,7 @@ namespace scg {
 
 
 /**
- * \brief A traverser that searches Camera and LightPosition nodes in the scene graph (visitor pattern).
+ * \brief A traverser that searches Camera, Light, and LightPosition nodes in the scene graph (visitor pattern).
  */
 class PreTraverser: public Traverser {
 
@@ -57,6 +57,16 @@ public:
 
   // composite nodes
 
+  /**
+   * Visit Light node: collect light scope to be uploaded by RenderState.
+   */
+  virtual void visitLight(Light* node);
+
+  /**
+   * Visit Light node after traversing sub-tree: leave light scope.
+   */
+  virtual void visitPostLight(Light* node);
+
   /**
    * Visit Camera node: apply camera transformation, update model-view
    * matrix of RenderState, save projection and view tranformation.
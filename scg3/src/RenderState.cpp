@@ -21,6 +21,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstring>
 #include "scg_internals.h"
 #include "scg_utilities.h"
 #include "Light.h"
@@ -31,8 +33,13 @@ namespace scg {
 
 
 RenderState::RenderState()
-    : colorCore_(nullptr), shaderCore_(nullptr), projection_(1.0f), viewTransform_(1.0f), tempMatrix_(1.0f),
-      isLightingEnabled_(true), nLights_(0), lightUBO_(0), globalAmbientLight_(0.f, 0.f, 0.f, 1.f) {
+    : colorCore_(nullptr), shaderCore_(nullptr), materialTable_(nullptr), materialIndex_(-1),
+      projection_(1.0f), viewTransform_(1.0f), tempMatrix_(1.0f),
+      isLightingEnabled_(true), nLights_(0), lightUBO_(0), lightUBOSize_(0), lightBlockStride_(0),
+      globalAmbientLight_(0.f, 0.f, 0.f, 1.f) {
+  // block 0: no lights
+  lightBlocks_.push_back(LightBlock());
+  collectedBlocks_.push_back(LightBlock());
 }
 
 
@@ -44,17 +51,21 @@ RenderState::~RenderState() {
 
 
 void RenderState::init() {
+  // light blocks are aligned to the offset alignment required by glBindBufferRange()
+  GLint alignment = 1;
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+  const GLint blockSize = OGLConstants::MAX_NUMBER_OF_LIGHTS * Light::BUFFER_SIZE;
+  lightBlockStride_ = (blockSize + alignment - 1) / alignment * alignment;
+
+  // create UBO with empty block and scratch block
   glGenBuffers(1, &lightUBO_);
-  const size_t bufferSize = OGLConstants::MAX_NUMBER_OF_LIGHTS * Light::BUFFER_SIZE;
-  GLubyte* buffer = new GLubyte[bufferSize];
-  std::memset(buffer, 0, bufferSize);
+  lightUBOSize_ = 2 * lightBlockStride_;
+  lightData_.assign(lightUBOSize_, 0);
   glBindBuffer(GL_UNIFORM_BUFFER, lightUBO_);
   assert(glIsBuffer(lightUBO_));
-  glBufferData(GL_UNIFORM_BUFFER, bufferSize, buffer, GL_DYNAMIC_DRAW);
+  glBufferData(GL_UNIFORM_BUFFER, lightUBOSize_, lightData_.data(), GL_DYNAMIC_DRAW);
   glBindBuffer(GL_UNIFORM_BUFFER, 0);
-  delete [] buffer;
-  buffer = nullptr;
-  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::LIGHT.bindingPoint, lightUBO_);
+  bindLightBlock_();
 
   assert(!checkGLError());
 }
@@ -100,14 +111,166 @@ void RenderState::setShader(ShaderCore* core) {
 }
 
 
-void RenderState::addLight() {
+MaterialTable* RenderState::getMaterialTable() {
+  return materialTable_;
+}
+
+
+void RenderState::setMaterialTable(MaterialTable* table) {
+  materialTable_ = table;
+}
+
+
+GLint RenderState::getMaterialIndex() const {
+  return materialIndex_;
+}
+
+
+void RenderState::setMaterialIndex(GLint materialIndex) {
+  materialIndex_ = materialIndex;
+}
+
+
+void RenderState::addLight(const Light* light) {
   assert(nLights_ < OGLConstants::MAX_NUMBER_OF_LIGHTS);
   ++nLights_;
+
+  // find block uploaded for this scope, or use scratch block
+  int parent = lightBlockStack_.empty() ? 0 : lightBlockStack_.back();
+  int block = -1;
+  if (parent >= 0) {
+    auto it = lightBlockMap_.find(std::make_pair(parent, light));
+    if (it != lightBlockMap_.end()) {
+      block = it->second;
+    }
+  }
+  lightBlockStack_.push_back(block);
+  lights_.push_back(light);
+  bindLightBlock_();
 }
 
+
 void RenderState::removeLight() {
   assert(nLights_ > 0);
+  assert(!lightBlockStack_.empty());
   --nLights_;
+  lightBlockStack_.pop_back();
+  lights_.pop_back();
+  bindLightBlock_();
+}
+
+
+int RenderState::getLightIndex(const Light* light) const {
+  // innermost occurrence, as the light blocks are packed in order of lights_
+  for (int i = static_cast<int>(lights_.size()) - 1; i >= 0; --i) {
+    if (lights_[i] == light) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+
+void RenderState::collectLight(const Light* light) {
+  int parent = collectedBlockStack_.empty() ? 0 : collectedBlockStack_.back();
+  auto key = std::make_pair(parent, light);
+  auto it = collectedBlockMap_.find(key);
+  int block;
+  if (it != collectedBlockMap_.end()) {
+    block = it->second;
+  }
+  else {
+    // new scope: lights of enclosing scope plus new light
+    LightBlock lightBlock = collectedBlocks_[parent];
+    lightBlock.lights.push_back(light);
+    assert(static_cast<int>(lightBlock.lights.size()) <= OGLConstants::MAX_NUMBER_OF_LIGHTS);
+    block = static_cast<int>(collectedBlocks_.size());
+    collectedBlocks_.push_back(lightBlock);
+    collectedBlockMap_[key] = block;
+  }
+  collectedBlockStack_.push_back(block);
+}
+
+
+void RenderState::collectLightPost() {
+  assert(!collectedBlockStack_.empty());
+  collectedBlockStack_.pop_back();
+}
+
+
+void RenderState::uploadLights() {
+  assert(lightBlockStack_.empty());
+  assert(collectedBlockStack_.empty());
+
+  // activate collected blocks, start new collection
+  lightBlocks_.swap(collectedBlocks_);
+  lightBlockMap_.swap(collectedBlockMap_);
+  collectedBlocks_.clear();
+  collectedBlocks_.push_back(LightBlock());
+  collectedBlockMap_.clear();
+
+  // pack light blocks (including scratch block) in std140 layout
+  const GLsizeiptr size = static_cast<GLsizeiptr>(lightBlocks_.size() + 1) * lightBlockStride_;
+  lightData_.assign(size, 0);
+  for (size_t i = 1; i < lightBlocks_.size(); ++i) {
+    GLubyte* blockData = lightData_.data() + i * lightBlockStride_;
+    for (auto light : lightBlocks_[i].lights) {
+      light->writeBuffer(blockData, viewTransform_);
+      blockData += Light::BUFFER_SIZE;
+    }
+  }
+
+  // upload all blocks at once (orphaning the previous buffer storage)
+  glBindBuffer(GL_UNIFORM_BUFFER, lightUBO_);
+  glBufferData(GL_UNIFORM_BUFFER, size, lightData_.data(), GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  lightUBOSize_ = size;
+  stats.nUploadedBytes += size;
+  bindLightBlock_();
+
+  assert(!checkGLError());
+}
+
+
+int RenderState::getNLightBlocks() const {
+  return static_cast<int>(lightBlocks_.size());
+}
+
+
+void RenderState::getUploadedLights(std::vector<const Light*>& lights) const {
+  lights.clear();
+  for (auto& lightBlock : lightBlocks_) {
+    for (auto light : lightBlock.lights) {
+      if (std::find(lights.begin(), lights.end(), light) == lights.end()) {
+        lights.push_back(light);
+      }
+    }
+  }
+}
+
+
+void RenderState::bindLightBlock_() {
+  GLintptr offset = 0;
+  int block = lightBlockStack_.empty() ? 0 : lightBlockStack_.back();
+  if (block >= 0) {
+    offset = block * lightBlockStride_;
+  }
+  else {
+    // scope not collected in pre-traversal: write lights of current scope to scratch block
+    offset = lightUBOSize_ - lightBlockStride_;
+    GLubyte* blockData = lightData_.data() + offset;
+    std::memset(blockData, 0, lightBlockStride_);
+    for (size_t i = 0; i < lights_.size(); ++i) {
+      lights_[i]->writeBuffer(blockData + i * Light::BUFFER_SIZE, viewTransform_);
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, lightUBO_);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, lightBlockStride_, blockData);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    stats.nUploadedBytes += lightBlockStride_;
+  }
+  glBindBufferRange(GL_UNIFORM_BUFFER, OGLConstants::LIGHT.bindingPoint, lightUBO_,
+      offset, OGLConstants::MAX_NUMBER_OF_LIGHTS * Light::BUFFER_SIZE);
+  ++stats.nBufferBinds;
 }
 
 
@@ -137,6 +300,12 @@ void RenderState::passToShader() {
       glm::value_ptr(textureStack.getMatrix()));
   shaderCore_->setUniformMatrix4fv(OGLConstants::COLOR_MATRIX, 1,
       glm::value_ptr(colorStack.getMatrix()));
+  stats.nUniformUploads += 6;
+  if (materialTable_) {
+    shaderCore_->setUniform1i(OGLConstants::MATERIAL_INDEX, materialIndex_);
+    ++stats.nUniformUploads;
+  }
+  stats.nUniformUploads += 2;
   if (isLightingEnabled_) {
     shaderCore_->setUniform1i(OGLConstants::N_LIGHTS, nLights_);
     shaderCore_->setUniform4fv(OGLConstants::GLOBAL_AMBIENT_LIGHT, 1, glm::value_ptr(globalAmbientLight_));
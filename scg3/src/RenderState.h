@@ -3,8 +3,8 @@
  * \brief The central render state that collects information about the current
  *    shader, transformations, matrix stacks, light and color properties.
  *
- * Defines helper classes:
- *   MatrixStack
+ * Defines helper class:
+ *   RenderStats
  *
  * \author Volker Ahlers\n
  *         volker.ahlers@hs-hannover.de
@@ -29,8 +29,10 @@
 #ifndef RENDERSTATE_H_
 #define RENDERSTATE_H_
 
-#include <cassert>
-#include <stack>
+#include <map>
+#include <utility>
+#include <vector>
+#include "MatrixStack.h"
 #include "scg_glew_glad.h"
 #include "scg_glm.h"
 #include "scg_internals.h"
@@ -39,56 +41,50 @@ namespace scg {
 
 
 /**
- * \brief Matrix stack to store model-view, projection, texture, and color matrices,
- *    used by RenderState.
+ * \brief Render statistics of one frame, gathered by RenderState (member stats) while
+ *    the cores are rendered, used by Renderer::getRenderStats().
  *
- * The member functions are defined in the header file to allow inlining.
+ * Binds and uploads are counted when cores are rendered; restoring the previous
+ * bindings after a sub-tree is not counted.
  */
-class MatrixStack {
+struct RenderStats {
 
-public:
-
-  MatrixStack() {
-    stack_.push(glm::mat4(1.0f));
-  }
-
-  const glm::mat4& getMatrix() const {
-    assert(!stack_.empty());
-    return stack_.top();
-  }
-
-  void setMatrix(const glm::mat4& matrix) {
-    assert(!stack_.empty());
-    stack_.top() = matrix;
-  }
-
-  void setIdentity() {
-    assert(!stack_.empty());
-    stack_.top() = glm::mat4(1.0f);
-  }
-
-  void pushMatrix() {
-    assert(!stack_.empty());
-    stack_.push(stack_.top());
+  RenderStats() {
+    clear();
   }
 
-  void pushMatrix(const glm::mat4& matrix) {
-    stack_.push(matrix);
+  void clear() {
+    nDrawCalls = 0;
+    nTriangles = nVertices = 0;
+    nShapesVisited = nShapesCulled = 0;
+    nProgramSwitches = nTextureBinds = nBufferBinds = 0;
+    nUniformUploads = 0;
+    nUploadedBytes = 0;
   }
 
-  void popMatrix() {
-    assert(!stack_.empty());
-    stack_.pop();
+  /**
+   * Add primitives of one draw command (without counting a draw call).
+   */
+  void addPrimitives(GLenum primitiveType, long nElements) {
+    nVertices += nElements;
+    if (primitiveType == GL_TRIANGLES) {
+      nTriangles += nElements / 3;
+    }
+    else if (primitiveType == GL_TRIANGLE_STRIP || primitiveType == GL_TRIANGLE_FAN) {
+      nTriangles += (nElements > 2) ? nElements - 2 : 0;
+    }
   }
 
-  void multMatrix(const glm::mat4& matrix) {
-    assert(!stack_.empty());
-    stack_.top() *= matrix;
-  }
-
-protected:
-
-  std::stack<glm::mat4> stack_;
+  int nDrawCalls;           ///< draw calls (multi-draw indirect: one call per batch)
+  long nTriangles;          ///< triangles submitted
+  long nVertices;           ///< vertices (or indices) submitted
+  int nShapesVisited;       ///< Shape nodes visited by render traversal
+  int nShapesCulled;        ///< draws skipped by culling (e.g., shadow map casters)
+  int nProgramSwitches;     ///< shader programs bound
+  int nTextureBinds;        ///< textures and buffer textures bound
+  int nBufferBinds;         ///< uniform buffer objects bound
+  long nUniformUploads;     ///< uniform variables set by cores and renderers
+  long nUploadedBytes;      ///< bytes uploaded into buffer objects during rendering
 
 };
 
@@ -98,6 +94,10 @@ protected:
  *    shader, transformations, matrix stacks, light and color properties.
  *
  * The light properties are stored in a uniform buffer object (UBO).
+ * The lights of all light scopes (i.e., sub-trees of Light nodes) are collected
+ * during the pre-traversal and packed into consecutive blocks of the UBO,
+ * which is uploaded once per frame by uploadLights(). During rendering,
+ * addLight() and removeLight() only bind the block of the current scope.
  * A few member functions are defined in the header file to allow inlining.
  * The matrix stacks are public member variables that are accessed as, e.g.,
  *
@@ -153,6 +153,27 @@ public:
    */
   void setShader(ShaderCore* core);
 
+  /**
+   * Get current material table (may be nullptr).
+   */
+  MaterialTable* getMaterialTable();
+
+  /**
+   * Set current material table (may be nullptr), to be called by MaterialTable.
+   */
+  void setMaterialTable(MaterialTable* table);
+
+  /**
+   * Get index of current material in current material table, -1 if none.
+   */
+  GLint getMaterialIndex() const;
+
+  /**
+   * Set index of current material in current material table, -1 if none,
+   * to be called by MaterialCore.
+   */
+  void setMaterialIndex(GLint materialIndex);
+
   /**
    * Get view transformation that is applied before rendering the scene.
    */
@@ -211,15 +232,52 @@ public:
 
 
   /**
-   * Add light, i.e., increase the number of lights.
+   * Add light, i.e., increase the number of lights and bind the light block
+   * of the new scope, to be called by Light::render().
+   * If the scope has not been collected by collectLight() before uploadLights(),
+   * the light data is uploaded immediately.
    */
-  void addLight();
+  void addLight(const Light* light);
 
   /**
-   * Remove light, i.e., decrease the number of lights.
+   * Remove light, i.e., decrease the number of lights and re-bind the light block
+   * of the enclosing scope, to be called by Light::renderPost().
    */
   void removeLight();
 
+  /**
+   * Get index of light in the light block of the current scope, -1 if the light is not active.
+   */
+  int getLightIndex(const Light* light) const;
+
+  /**
+   * Collect light scope to be uploaded by uploadLights(), to be called by PreTraverser.
+   */
+  void collectLight(const Light* light);
+
+  /**
+   * Leave light scope entered by collectLight(), to be called by PreTraverser.
+   */
+  void collectLightPost();
+
+  /**
+   * Pack the lights of all collected scopes into the light UBO by a single upload,
+   * to be called by Renderer between pre-traversal and rendering.
+   * Light positions are transformed by the current view transformation.
+   */
+  void uploadLights();
+
+  /**
+   * Get number of light blocks uploaded by the last call of uploadLights().
+   */
+  int getNLightBlocks() const;
+
+  /**
+   * Get all lights of the scopes uploaded by the last call of uploadLights(),
+   * each light once (e.g., for deferred shading).
+   */
+  void getUploadedLights(std::vector<const Light*>& lights) const;
+
   /**
    * Set global ambient light intensity to be applied independent of light sources.
    */
@@ -244,17 +302,45 @@ public:
   MatrixStack projectionStack;
   MatrixStack textureStack;
   MatrixStack colorStack;
+  RenderStats stats;
 
 protected:
 
   ColorCore* colorCore_;
   ShaderCore* shaderCore_;
+  MaterialTable* materialTable_;
+  GLint materialIndex_;
   glm::mat4 projection_;
   glm::mat4 viewTransform_;
   mutable glm::mat4 tempMatrix_;
   bool isLightingEnabled_;
+  /**
+   * Light block, i.e., lights of one light scope.
+   */
+  struct LightBlock {
+    std::vector<const Light*> lights;
+  };
+
+  typedef std::map<std::pair<int, const Light*>, int> LightBlockMap;
+
+  /**
+   * Bind light block of the current scope, write scratch block if the scope has
+   * not been uploaded by uploadLights().
+   */
+  void bindLightBlock_();
+
   GLint nLights_;
   GLuint lightUBO_;
+  GLsizeiptr lightUBOSize_;
+  GLint lightBlockStride_;
+  std::vector<GLubyte> lightData_;
+  std::vector<LightBlock> lightBlocks_;
+  LightBlockMap lightBlockMap_;
+  std::vector<int> lightBlockStack_;      // -1: scratch block
+  std::vector<const Light*> lights_;
+  std::vector<LightBlock> collectedBlocks_;
+  LightBlockMap collectedBlockMap_;
+  std::vector<int> collectedBlockStack_;
   glm::vec4 globalAmbientLight_;
 
 };
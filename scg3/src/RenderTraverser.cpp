@@ -24,9 +24,12 @@
 #include "Camera.h"
 #include "Group.h"
 #include "Light.h"
+#include "LightCluster.h"
 #include "RenderState.h"
 #include "RenderTraverser.h"
+#include "ShadowMap.h"
 #include "Shape.h"
+#include "StaticBatch.h"
 #include "Transformation.h"
 
 namespace scg {
@@ -42,6 +45,12 @@ RenderTraverser::~RenderTraverser() {
 
 
 void RenderTraverser::visitShape(Shape* node) {
+  ++renderState_->stats.nShapesVisited;
+  node->render(renderState_);
+}
+
+
+void RenderTraverser::visitStaticBatch(StaticBatch* node) {
   node->render(renderState_);
 }
 
@@ -76,6 +85,26 @@ void RenderTraverser::visitPostLight(Light* node) {
 }
 
 
+void RenderTraverser::visitLightCluster(LightCluster* node) {
+  node->render(renderState_);
+}
+
+
+void RenderTraverser::visitPostLightCluster(LightCluster* node) {
+  node->renderPost(renderState_);
+}
+
+
+void RenderTraverser::visitShadowMap(ShadowMap* node) {
+  node->render(renderState_);
+}
+
+
+void RenderTraverser::visitPostShadowMap(ShadowMap* node) {
+  node->renderPost(renderState_);
+}
+
+
 void RenderTraverser::visitTransformation(Transformation* node) {
   node->render(renderState_);
 }
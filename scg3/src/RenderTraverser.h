@@ -61,6 +61,11 @@ public:
    */
   virtual void visitShape(Shape* node);
 
+  /**
+   * Visit StaticBatch node: render batched geometry.
+   */
+  virtual void visitStaticBatch(StaticBatch* node);
+
   // composite nodes
 
   /**
@@ -95,6 +100,26 @@ public:
    */
   virtual void visitPostLight(Light* node);
 
+  /**
+   * Visit LightCluster node: update clusters and bind buffers.
+   */
+  virtual void visitLightCluster(LightCluster* node);
+
+  /**
+   * Visit LightCluster node after traversing sub-tree: restore buffer bindings.
+   */
+  virtual void visitPostLightCluster(LightCluster* node);
+
+  /**
+   * Visit ShadowMap node: update shadow map and bind it.
+   */
+  virtual void visitShadowMap(ShadowMap* node);
+
+  /**
+   * Visit ShadowMap node after traversing sub-tree: restore bindings.
+   */
+  virtual void visitPostShadowMap(ShadowMap* node);
+
   /**
    * Visit Transformation node: update model-view matrix of RenderState.
    */
@@ -21,6 +21,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include "Node.h"
 #include "Renderer.h"
@@ -31,7 +32,7 @@ namespace scg {
 
 
 Renderer::Renderer()
-    : renderState_(new RenderState) {
+    : renderState_(new RenderState), frameProfiler_(nullptr), renderStatsHistorySize_(120) {
 }
 
 
@@ -95,4 +96,46 @@ std::string Renderer::getInfo() {
 }
 
 
+void Renderer::beginFrame() {
+  renderState_->stats.clear();
+}
+
+
+void Renderer::endFrame() {
+  storeRenderStats_(renderState_->stats);
+}
+
+
+void Renderer::setFrameProfiler(FrameProfiler* frameProfiler) {
+  frameProfiler_ = frameProfiler;
+}
+
+
+const RenderStats& Renderer::getRenderStats() const {
+  return renderStats_;
+}
+
+
+const std::deque<RenderStats>& Renderer::getRenderStatsHistory() const {
+  return renderStatsHistory_;
+}
+
+
+void Renderer::setRenderStatsHistorySize(int nFrames) {
+  renderStatsHistorySize_ = static_cast<size_t>(std::max(nFrames, 1));
+  while (renderStatsHistory_.size() > renderStatsHistorySize_) {
+    renderStatsHistory_.pop_front();
+  }
+}
+
+
+void Renderer::storeRenderStats_(const RenderStats& renderStats) {
+  renderStats_ = renderStats;
+  renderStatsHistory_.push_back(renderStats_);
+  if (renderStatsHistory_.size() > renderStatsHistorySize_) {
+    renderStatsHistory_.pop_front();
+  }
+}
+
+
 } /* namespace scg */
@@ -25,10 +25,12 @@
 #ifndef RENDERER_H_
 #define RENDERER_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include "scg_glm.h"
 #include "scg_internals.h"
+#include "RenderState.h"
 
 namespace scg {
 
@@ -119,17 +121,62 @@ public:
    */
   virtual std::string getInfo();
 
+  /**
+   * Begin frame, called by Viewer::startMainLoop() before render():
+   * reset render statistics of render state.
+   */
+  virtual void beginFrame();
+
   /**
    * Render the scene, called by Viewer::startMainLoop().
+   * May be called more than once per frame, e.g., once per eye by a stereo renderer.
    */
   virtual void render() = 0;
 
+  /**
+   * End frame, called by Viewer::startMainLoop() after render():
+   * store render statistics of all render() calls of the frame.
+   */
+  virtual void endFrame();
+
+  /**
+   * Set frame profiler to time render passes, may be null (default),
+   * called by Viewer::init().
+   */
+  virtual void setFrameProfiler(FrameProfiler* frameProfiler);
+
+  /**
+   * Get render statistics of the last frame (draw calls, triangles, state changes, etc.).
+   */
+  const RenderStats& getRenderStats() const;
+
+  /**
+   * Get render statistics of the last frames, oldest first.
+   */
+  const std::deque<RenderStats>& getRenderStatsHistory() const;
+
+  /**
+   * Set number of frames kept in render statistics history (default: 120).
+   */
+  void setRenderStatsHistorySize(int nFrames);
+
+protected:
+
+  /**
+   * Store render statistics of current frame and append them to history.
+   */
+  void storeRenderStats_(const RenderStats& renderStats);
+
 protected:
 
   Viewer* viewer_;
   NodeSP scene_;
   CameraSP camera_;
   RenderStateUP renderState_;
+  FrameProfiler* frameProfiler_;
+  RenderStats renderStats_;
+  std::deque<RenderStats> renderStatsHistory_;
+  size_t renderStatsHistorySize_;
 
 };
 
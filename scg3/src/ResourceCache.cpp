@@ -0,0 +1,171 @@
+/**
+ * \file ResourceCache.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+#include "Core.h"
+#include "ResourceCache.h"
+
+namespace scg {
+
+
+ResourceCache::ResourceCache()
+    : purgeSize_(64), nHits_(0), nMisses_(0), bytesSaved_(0) {
+}
+
+
+ResourceCache::~ResourceCache() {
+}
+
+
+ResourceCacheSP ResourceCache::create() {
+  return std::make_shared<ResourceCache>();
+}
+
+
+ResourceCacheSP ResourceCache::getDefault() {
+  static ResourceCacheSP defaultCache = create();
+  return defaultCache;
+}
+
+
+CoreSP ResourceCache::find(const std::string& key) {
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    CoreSP core = it->second.core.lock();
+    if (core) {
+      ++nHits_;
+      bytesSaved_ += it->second.bytes;
+      return core;
+    }
+    entries_.erase(it);
+  }
+  ++nMisses_;
+  return nullptr;
+}
+
+
+void ResourceCache::insert(const std::string& key, CoreSP core, size_t bytes) {
+  assert(core);
+  Entry entry = { core, bytes };
+  entries_[key] = entry;
+
+  // remove entries of deleted cores when number of entries has doubled
+  if (entries_.size() >= purgeSize_) {
+    purge_();
+    purgeSize_ = std::max(static_cast<size_t>(64), 2 * entries_.size());
+  }
+}
+
+
+void ResourceCache::clear() {
+  entries_.clear();
+}
+
+
+void ResourceCache::resetStatistics() {
+  nHits_ = 0;
+  nMisses_ = 0;
+  bytesSaved_ = 0;
+}
+
+
+int ResourceCache::getNEntries() const {
+  int nEntries = 0;
+  for (auto& entry : entries_) {
+    if (!entry.second.core.expired()) {
+      ++nEntries;
+    }
+  }
+  return nEntries;
+}
+
+
+unsigned long ResourceCache::getNHits() const {
+  return nHits_;
+}
+
+
+unsigned long ResourceCache::getNMisses() const {
+  return nMisses_;
+}
+
+
+double ResourceCache::getHitRate() const {
+  unsigned long nLookups = nHits_ + nMisses_;
+  return (nLookups > 0) ? static_cast<double>(nHits_) / nLookups : 0.0;
+}
+
+
+size_t ResourceCache::getBytesSaved() const {
+  return bytesSaved_;
+}
+
+
+size_t ResourceCache::getBytesInUse() const {
+  size_t bytes = 0;
+  for (auto& entry : entries_) {
+    if (!entry.second.core.expired()) {
+      bytes += entry.second.bytes;
+    }
+  }
+  return bytes;
+}
+
+
+std::string ResourceCache::getInfo() const {
+  std::stringstream stream;
+  stream << "No. of cached resources: " << getNEntries() << std::endl
+      << "Cache hit rate: " << std::fixed << std::setprecision(1) << 100.0 * getHitRate()
+      << " % (" << nHits_ << " hits, " << nMisses_ << " misses)" << std::endl
+      << "Cache bytes saved: " << bytesSaved_ << std::endl;
+  return stream.str();
+}
+
+
+std::string ResourceCache::makeKey(const std::string& name, const std::vector<double>& params) {
+  std::stringstream stream;
+  stream << name << '(' << std::setprecision(17);
+  for (size_t i = 0; i < params.size(); ++i) {
+    stream << (i > 0 ? "," : "") << params[i];
+  }
+  stream << ')';
+  return stream.str();
+}
+
+
+void ResourceCache::purge_() {
+  for (auto it = entries_.begin(); it != entries_.end(); ) {
+    if (it->second.core.expired()) {
+      it = entries_.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+
+} /* namespace scg */
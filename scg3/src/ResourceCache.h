@@ -0,0 +1,182 @@
+/**
+ * \file ResourceCache.h
+ * \brief A cache of shared cores created by the factories, avoiding duplicate loading and uploading.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RESOURCECACHE_H_
+#define RESOURCECACHE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A cache of shared cores created by the factories, avoiding duplicate loading and uploading.
+ *
+ * Cores are stored by key, i.e., full file name plus parameters for cores loaded from files,
+ * or function name plus parameters for procedural geometry (which fully determine its content).
+ * The cache only keeps weak references, such that a core is deleted as soon as it is no longer
+ * used by the scene graph.
+ *
+ * Caching is enabled per factory by calling setResourceCache(), e.g.:
+ * \code
+ * auto cache = ResourceCache::create();
+ * GeometryCoreFactory geometryFactory;
+ * geometryFactory.setResourceCache(cache);
+ * auto cube1 = geometryFactory.createCube(1.f);
+ * auto cube2 = geometryFactory.createCube(1.f);   // same core as cube1
+ * \endcode
+ *
+ * Note that cached cores are shared, i.e., modifying a core (e.g., the texture matrix
+ * of a texture core) affects all of its users.
+ */
+class ResourceCache {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  ResourceCache();
+
+  /**
+   * Destructor.
+   */
+  virtual ~ResourceCache();
+
+  /**
+   * Create shared pointer.
+   */
+  static ResourceCacheSP create();
+
+  /**
+   * Get process-wide default cache, e.g., used for the internal cores of all cameras.
+   */
+  static ResourceCacheSP getDefault();
+
+  /**
+   * Find core by key and update statistics.
+   * \return core, or nullptr if not found or already deleted
+   */
+  CoreSP find(const std::string& key);
+
+  /**
+   * Insert core with given key.
+   * \param key key of core
+   * \param core core to be shared
+   * \param bytes size of data that is saved by a cache hit (e.g., image or buffer size)
+   */
+  void insert(const std::string& key, CoreSP core, size_t bytes);
+
+  /**
+   * Remove all entries, the cores are not affected.
+   */
+  void clear();
+
+  /**
+   * Reset hit and miss statistics.
+   */
+  void resetStatistics();
+
+  /**
+   * Get number of entries whose cores are still in use.
+   */
+  int getNEntries() const;
+
+  /**
+   * Get number of successful lookups.
+   */
+  unsigned long getNHits() const;
+
+  /**
+   * Get number of unsuccessful lookups.
+   */
+  unsigned long getNMisses() const;
+
+  /**
+   * Get ratio of successful lookups (0 if there were no lookups).
+   */
+  double getHitRate() const;
+
+  /**
+   * Get accumulated size of data that did not have to be loaded and uploaded again (bytes).
+   */
+  size_t getBytesSaved() const;
+
+  /**
+   * Get total size (bytes) of cached resources that are still in use.
+   */
+  size_t getBytesInUse() const;
+
+  /**
+   * Get information about cache statistics.
+   */
+  std::string getInfo() const;
+
+  /**
+   * Create key from name and numeric parameters, e.g.,
+   * makeKey("sphere", {radius, nSlices, nStacks}).
+   * The parameters are written with full precision.
+   */
+  static std::string makeKey(const std::string& name, const std::vector<double>& params);
+
+protected:
+
+  /**
+   * Cache entry.
+   */
+  struct Entry {
+    std::weak_ptr<Core> core;
+    size_t bytes;
+  };
+
+  /**
+   * Remove entries of deleted cores.
+   */
+  void purge_();
+
+protected:
+
+  std::unordered_map<std::string, Entry> entries_;
+  size_t purgeSize_;
+  unsigned long nHits_;
+  unsigned long nMisses_;
+  size_t bytesSaved_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(ResourceCache);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* RESOURCECACHE_H_ */
@@ -0,0 +1,343 @@
+/**
+ * \file ShaderBinaryCache.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+#include "scg_glew_glad.h"
+#include <GLFW/glfw3.h>
+#include "GLDebug.h"
+#include "scg_utilities.h"
+#include "ShaderBinaryCache.h"
+
+namespace scg {
+
+
+namespace {
+
+// file header: magic number and version
+const char BINARY_MAGIC[4] = { 'S', 'C', 'G', 'B' };
+const uint32_t BINARY_VERSION = 1;
+
+// 64-bit FNV-1a hash
+const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+void hashBytes(uint64_t& hash, const void* data, size_t size) {
+  auto bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * FNV_PRIME;
+  }
+}
+
+void hashString(uint64_t& hash, const char* str) {
+  if (str) {
+    hashBytes(hash, str, std::char_traits<char>::length(str) + 1);
+  }
+  else {
+    hashBytes(hash, "", 1);
+  }
+}
+
+// check if binary format is accepted by driver, e.g., not after a driver update
+bool isBinaryFormatSupported(GLenum format) {
+  GLint nFormats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &nFormats);
+  if (nFormats <= 0) {
+    return false;
+  }
+  std::vector<GLint> formats(nFormats);
+  glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
+  return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) != formats.end();
+}
+
+}
+
+
+ShaderBinaryCache::ShaderBinaryCache(const std::string& directory)
+    : directory_(directory), nHits_(0), nMisses_(0), nRejected_(0),
+      loadTime_(0.0), compileTime_(0.0), timeSaved_(0.0) {
+  assert(!directory_.empty());
+  // create directory if necessary, errors are detected when saving binaries
+#ifdef _WIN32
+  _mkdir(directory_.c_str());
+#else
+  mkdir(directory_.c_str(), 0755);
+#endif
+}
+
+
+ShaderBinaryCache::~ShaderBinaryCache() {
+}
+
+
+ShaderBinaryCacheSP ShaderBinaryCache::create(const std::string& directory) {
+  return std::make_shared<ShaderBinaryCache>(directory);
+}
+
+
+bool ShaderBinaryCache::isSupported() {
+  if (!SCG_GL_EXTENSION_SUPPORTED(VERSION_4_1)
+      && !SCG_GL_EXTENSION_SUPPORTED(ARB_get_program_binary)) {
+    return false;
+  }
+  GLint nFormats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &nFormats);
+  return nFormats > 0;
+}
+
+
+std::string ShaderBinaryCache::computeKey(const std::vector<ShaderID>& shaderIDs) const {
+  uint64_t hash = FNV_OFFSET;
+  hashBytes(hash, &BINARY_VERSION, sizeof(BINARY_VERSION));
+
+  // shader types and sources
+  std::vector<GLchar> source;
+  for (auto& shaderID : shaderIDs) {
+    assert(glIsShader(shaderID.shader));
+    GLint type = 0;
+    GLint length = 0;
+    glGetShaderiv(shaderID.shader, GL_SHADER_TYPE, &type);
+    glGetShaderiv(shaderID.shader, GL_SHADER_SOURCE_LENGTH, &length);
+    source.resize(length + 1);
+    glGetShaderSource(shaderID.shader, length + 1, nullptr, source.data());
+    hashBytes(hash, &type, sizeof(type));
+    hashString(hash, source.data());
+  }
+
+  // standard attribute and fragment data locations
+  const OGLAttrib* attribs[] = { &OGLConstants::VERTEX, &OGLConstants::COLOR,
+      &OGLConstants::NORMAL, &OGLConstants::TEX_COORD_0, &OGLConstants::TEX_COORD_1,
+      &OGLConstants::TANGENT, &OGLConstants::BINORMAL, &OGLConstants::DRAW_INDEX };
+  for (auto attrib : attribs) {
+    hashString(hash, attrib->name);
+    hashBytes(hash, &attrib->location, sizeof(attrib->location));
+  }
+  const OGLFragData* fragData[] = { &OGLConstants::FRAG_COLOR, &OGLConstants::G_ALBEDO,
+      &OGLConstants::G_SPECULAR, &OGLConstants::G_NORMAL };
+  for (auto data : fragData) {
+    hashString(hash, data->name);
+    hashBytes(hash, &data->location, sizeof(data->location));
+  }
+
+  // driver strings
+  hashString(hash, reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+  hashString(hash, reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+  hashString(hash, reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+
+  assert(!checkGLError());
+
+  std::stringstream stream;
+  stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return stream.str();
+}
+
+
+bool ShaderBinaryCache::load(GLuint program, const std::string& key) {
+  assert(glIsProgram(program));
+  double startTime = getTime();
+
+  // read binary file
+  std::ifstream istr(getFileName_(key), std::ios::binary);
+  char magic[4];
+  uint32_t version = 0;
+  uint32_t format = 0;
+  double storedCompileTime = 0.0;
+  uint64_t size = 0;
+  if (!isSupported() || !istr.is_open()
+      || !istr.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, BINARY_MAGIC)
+      || !istr.read(reinterpret_cast<char*>(&version), sizeof(version))
+      || version != BINARY_VERSION
+      || !istr.read(reinterpret_cast<char*>(&format), sizeof(format))
+      || !istr.read(reinterpret_cast<char*>(&storedCompileTime), sizeof(storedCompileTime))
+      || !istr.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+    ++nMisses_;
+    return false;
+  }
+
+  // check size against remaining file length before allocating (corrupt or truncated file)
+  std::streamoff headerEnd = istr.tellg();
+  istr.seekg(0, std::ios::end);
+  std::streamoff fileEnd = istr.tellg();
+  istr.seekg(headerEnd);
+  if (headerEnd < 0 || fileEnd < headerEnd || size == 0
+      || size > static_cast<uint64_t>(fileEnd - headerEnd)) {
+    ++nMisses_;
+    return false;
+  }
+  std::vector<char> binary(static_cast<size_t>(size));
+  if (!istr.read(binary.data(), binary.size())) {
+    ++nMisses_;
+    return false;
+  }
+  istr.close();
+
+  // pass binary to OpenGL, which may reject it (e.g., after a driver update);
+  // a rejected binary is a cache miss, its error is cleared like by checkGLError()
+  GLint status = GL_FALSE;
+  if (isBinaryFormatSupported(format)) {
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+  }
+  if (GLDebug::isActive()) {
+    GLDebug::checkError();
+  }
+  glGetError();
+  if (status != GL_TRUE) {
+    ++nMisses_;
+    ++nRejected_;
+    return false;
+  }
+
+  double loadTime = getTime() - startTime;
+  ++nHits_;
+  loadTime_ += loadTime;
+  timeSaved_ += storedCompileTime - loadTime;
+  return true;
+}
+
+
+void ShaderBinaryCache::prepare(GLuint program) const {
+  if (isSupported()) {
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    assert(!checkGLError());
+  }
+}
+
+
+void ShaderBinaryCache::save(GLuint program, const std::string& key, double compileTime) {
+  compileTime_ += compileTime;
+  if (!isSupported()) {
+    return;
+  }
+
+  // get program binary
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) {
+    return;
+  }
+  std::vector<char> binary(length);
+  GLenum format = 0;
+  glGetProgramBinary(program, length, &length, &format, binary.data());
+  assert(!checkGLError());
+
+  // write to temporary file and rename, such that concurrent processes
+  // never read incomplete files
+  std::string fileName = getFileName_(key);
+  std::string tmpFileName = fileName + ".tmp";
+  std::ofstream ostr(tmpFileName, std::ios::binary);
+  if (!ostr.is_open()) {
+    return;
+  }
+  uint32_t version = BINARY_VERSION;
+  uint32_t format32 = format;
+  uint64_t size = static_cast<uint64_t>(length);
+  ostr.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+  ostr.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  ostr.write(reinterpret_cast<const char*>(&format32), sizeof(format32));
+  ostr.write(reinterpret_cast<const char*>(&compileTime), sizeof(compileTime));
+  ostr.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  ostr.write(binary.data(), length);
+  ostr.close();
+  if (!ostr) {
+    std::remove(tmpFileName.c_str());
+    return;
+  }
+  std::remove(fileName.c_str());
+  std::rename(tmpFileName.c_str(), fileName.c_str());
+}
+
+
+const std::string& ShaderBinaryCache::getDirectory() const {
+  return directory_;
+}
+
+
+void ShaderBinaryCache::resetStatistics() {
+  nHits_ = 0;
+  nMisses_ = 0;
+  nRejected_ = 0;
+  loadTime_ = 0.0;
+  compileTime_ = 0.0;
+  timeSaved_ = 0.0;
+}
+
+
+unsigned long ShaderBinaryCache::getNHits() const {
+  return nHits_;
+}
+
+
+unsigned long ShaderBinaryCache::getNMisses() const {
+  return nMisses_;
+}
+
+
+unsigned long ShaderBinaryCache::getNRejected() const {
+  return nRejected_;
+}
+
+
+double ShaderBinaryCache::getLoadTime() const {
+  return loadTime_;
+}
+
+
+double ShaderBinaryCache::getCompileTime() const {
+  return compileTime_;
+}
+
+
+double ShaderBinaryCache::getTimeSaved() const {
+  return timeSaved_;
+}
+
+
+std::string ShaderBinaryCache::getInfo() const {
+  std::stringstream stream;
+  stream << "Shader binary cache: " << nHits_ << " hits, " << nMisses_ << " misses ("
+      << nRejected_ << " rejected)" << std::endl << std::fixed << std::setprecision(1)
+      << "Shader load time: " << 1000.0 * loadTime_ << " ms, compile time: "
+      << 1000.0 * compileTime_ << " ms, time saved: " << 1000.0 * timeSaved_ << " ms"
+      << std::endl;
+  return stream.str();
+}
+
+
+std::string ShaderBinaryCache::getFileName_(const std::string& key) const {
+  char lastChar = directory_[directory_.size() - 1];
+  std::string separator = (lastChar == '/' || lastChar == '\\') ? "" : "/";
+  return directory_ + separator + key + ".bin";
+}
+
+
+} /* namespace scg */
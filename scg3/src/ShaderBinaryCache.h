@@ -0,0 +1,183 @@
+/**
+ * \file ShaderBinaryCache.h
+ * \brief An on-disk cache of linked shader program binaries to reduce startup time.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHADERBINARYCACHE_H_
+#define SHADERBINARYCACHE_H_
+
+#include <string>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "ShaderCore.h"
+
+namespace scg {
+
+
+/**
+ * \brief An on-disk cache of linked shader program binaries to reduce startup time.
+ *
+ * Program binaries are retrieved by glGetProgramBinary() after linking and stored
+ * in one file per program. The file name is a hash of the shader types and sources,
+ * the standard attribute and fragment data locations (see OGLConstants), and the
+ * OpenGL vendor, renderer, and version strings, such that a driver update invalidates
+ * the cached binaries. If the driver rejects a binary, the program is compiled and
+ * linked as usual and the binary is replaced.
+ *
+ * Requires OpenGL 4.1 or ARB_get_program_binary, otherwise all lookups are misses.
+ * The cache is enabled by ShaderCoreFactory::setBinaryCache(), e.g.:
+ * \code
+ * ShaderCoreFactory shaderFactory("../scg3/shaders");
+ * shaderFactory.setBinaryCache(ShaderBinaryCache::create("shader_cache"));
+ * \endcode
+ *
+ * Note that custom attribute or fragment data locations bound by the application
+ * are not part of the hash. Programs with identical sources but different custom
+ * locations must not share a cache directory.
+ */
+class ShaderBinaryCache {
+
+public:
+
+  /**
+   * Constructor with directory for binary files, which is created if necessary.
+   */
+  ShaderBinaryCache(const std::string& directory);
+
+  /**
+   * Destructor.
+   */
+  virtual ~ShaderBinaryCache();
+
+  /**
+   * Create shared pointer with directory for binary files.
+   */
+  static ShaderBinaryCacheSP create(const std::string& directory);
+
+  /**
+   * Check if program binaries are supported by the current OpenGL context.
+   */
+  static bool isSupported();
+
+  /**
+   * Compute key of program from the sources of its shaders (to be set by glShaderSource()),
+   * the standard attribute and fragment data locations, and the OpenGL driver strings.
+   */
+  std::string computeKey(const std::vector<ShaderID>& shaderIDs) const;
+
+  /**
+   * Load program binary with given key, to be called instead of compiling and linking.
+   * \return true if program has been loaded and linked successfully
+   */
+  bool load(GLuint program, const std::string& key);
+
+  /**
+   * Prepare program for retrieving its binary, to be called before linking.
+   */
+  void prepare(GLuint program) const;
+
+  /**
+   * Save binary of linked program with given key.
+   * \param program linked program
+   * \param key key computed by computeKey()
+   * \param compileTime time for compiling and linking (seconds), used to compute
+   *    the time saved by subsequent hits
+   */
+  void save(GLuint program, const std::string& key, double compileTime);
+
+  /**
+   * Get directory of binary files.
+   */
+  const std::string& getDirectory() const;
+
+  /**
+   * Reset statistics.
+   */
+  void resetStatistics();
+
+  /**
+   * Get number of programs loaded from binaries.
+   */
+  unsigned long getNHits() const;
+
+  /**
+   * Get number of programs without binaries, including rejected binaries.
+   */
+  unsigned long getNMisses() const;
+
+  /**
+   * Get number of binaries rejected by the driver.
+   */
+  unsigned long getNRejected() const;
+
+  /**
+   * Get accumulated time for loading binaries (seconds).
+   */
+  double getLoadTime() const;
+
+  /**
+   * Get accumulated time for compiling and linking missed programs (seconds).
+   */
+  double getCompileTime() const;
+
+  /**
+   * Get accumulated startup time saved by hits, i.e., the stored compile times
+   * minus the load times (seconds).
+   */
+  double getTimeSaved() const;
+
+  /**
+   * Get information about cache statistics.
+   */
+  std::string getInfo() const;
+
+protected:
+
+  /**
+   * Get full name of binary file with given key.
+   */
+  std::string getFileName_(const std::string& key) const;
+
+protected:
+
+  std::string directory_;
+  unsigned long nHits_;
+  unsigned long nMisses_;
+  unsigned long nRejected_;
+  double loadTime_;
+  double compileTime_;
+  double timeSaved_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(ShaderBinaryCache);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* SHADERBINARYCACHE_H_ */
@@ -27,16 +27,30 @@
 #include <stdexcept>
 #include "scg_glew_glad.h"
 #include <GLFW/glfw3.h>
+#include "GLDebug.h"
 #include "RenderState.h"
 #include "scg_internals.h"
 #include "scg_utilities.h"
+#include "ShaderBinaryCache.h"
 #include "ShaderCore.h"
+#include "Tracer.h"
 
 namespace scg {
 
 
+std::shared_ptr<GLuint> ShaderID::createSharedShader(GLuint shader) {
+  return std::shared_ptr<GLuint>(new GLuint(shader), [](GLuint* sharedShader) {
+    if (isGLContextActive()) {
+      glDeleteShader(*sharedShader);
+    }
+    delete sharedShader;
+  });
+}
+
+
 ShaderCore::ShaderCore(GLuint program, const std::vector<ShaderID>& shaderIDs)
-    : program_(program), shaderIDs_(shaderIDs), shaderCoreOld_(nullptr) {
+    : program_(program), shaderIDs_(shaderIDs), shaderCoreOld_(nullptr),
+      binaryCache_(nullptr), isLoadedFromBinary_(false), initStartTime_(0.0) {
 }
 
 
@@ -48,8 +62,11 @@ ShaderCore::~ShaderCore() {
 void ShaderCore::clear() {
   if (isGLContextActive()) {
     glUseProgram(0);
-    for (auto shaderID : shaderIDs_) {
-      glDeleteShader(shaderID.shader);
+    for (auto& shaderID : shaderIDs_) {
+      // shared shaders are deleted by their last reference
+      if (!shaderID.sharedShader) {
+        glDeleteShader(shaderID.shader);
+      }
     }
     glDeleteProgram(program_);
   }
@@ -63,17 +80,83 @@ ShaderCoreSP ShaderCore::create(GLuint program, const std::vector<ShaderID>& sha
 }
 
 
-void ShaderCore::init() const {
+void ShaderCore::init(ShaderBinaryCache* binaryCache) const {
+  SCG_TRACE_SCOPE("ShaderCore::init");
+  initAsync(binaryCache);
+  finishInit();
+}
+
+
+void ShaderCore::initAsync(ShaderBinaryCache* binaryCache) const {
+  SCG_TRACE_SCOPE("compile and link shaders");
   assert(glIsProgram(program_));
-  for (auto shaderID : shaderIDs_) {
+  binaryCache_ = binaryCache;
+  isLoadedFromBinary_ = false;
+
+  // label shaders and program by shader names for GL debuggers
+  if (GLDebug::isActive()) {
+    std::string programLabel;
+    for (auto& shaderID : shaderIDs_) {
+      GLDebug::setObjectLabel(GL_SHADER, shaderID.shader, shaderID.name);
+      programLabel += (programLabel.empty() ? "" : ", ") + shaderID.name;
+    }
+    GLDebug::setObjectLabel(GL_PROGRAM, program_, programLabel);
+  }
+
+  // load linked program from binary cache (if any)
+  if (binaryCache_) {
+    binaryKey_ = binaryCache_->computeKey(shaderIDs_);
+    if (binaryCache_->load(program_, binaryKey_)) {
+      isLoadedFromBinary_ = true;
+      assert(!checkGLError());
+      return;
+    }
+    binaryCache_->prepare(program_);
+  }
+
+  // compile shaders and link program, errors are checked by finishInit()
+  initStartTime_ = getTime();
+  for (auto& shaderID : shaderIDs_) {
     assert(glIsShader(shaderID.shader));
-    glCompileShader(shaderID.shader);
-    checkCompileError_(shaderID);
+    if (!isCompiled_(shaderID.shader)) {
+      glCompileShader(shaderID.shader);
+    }
     glAttachShader(program_, shaderID.shader);
   }
   glLinkProgram(program_);
+
+  assert(!checkGLError());
+}
+
+
+bool ShaderCore::isInitComplete() const {
+  if (isLoadedFromBinary_ || !SCG_GL_EXTENSION_SUPPORTED(KHR_parallel_shader_compile)) {
+    return true;
+  }
+  GLint status = GL_TRUE;
+  glGetProgramiv(program_, GL_COMPLETION_STATUS_KHR, &status);
+  return status == GL_TRUE;
+}
+
+
+void ShaderCore::finishInit() const {
+  SCG_TRACE_SCOPE("finish shader linking");
+  if (isLoadedFromBinary_) {
+    return;
+  }
+
+  // wait for results and check for errors
+  for (auto& shaderID : shaderIDs_) {
+    checkCompileError_(shaderID);
+  }
   checkLinkError_(program_);
 
+  // save linked program to binary cache (if any)
+  if (binaryCache_) {
+    binaryCache_->save(program_, binaryKey_, getTime() - initStartTime_);
+    binaryCache_ = nullptr;
+  }
+
   assert(!checkGLError());
 }
 
@@ -83,12 +166,19 @@ GLuint ShaderCore::getProgram() const {
 }
 
 
+const std::vector<ShaderID>& ShaderCore::getShaderIDs() const {
+  return shaderIDs_;
+}
+
+
 void ShaderCore::render(RenderState* renderState) {
   shaderCoreOld_ = renderState->getShader();
   renderState->setShader(this);
   assert(glIsProgram(program_));
   glUseProgram(program_);
-  setUniform1f(OGLConstants::TIME, static_cast<GLfloat>(glfwGetTime()));
+  setUniform1f(OGLConstants::TIME, static_cast<GLfloat>(getTime()));
+  ++renderState->stats.nProgramSwitches;
+  ++renderState->stats.nUniformUploads;
 }
 
 
@@ -103,6 +193,11 @@ void ShaderCore::renderPost(RenderState* renderState) {
 }
 
 
+void ShaderCore::setDebugLabel(const std::string& label) {
+  GLDebug::setObjectLabel(GL_PROGRAM, program_, label);
+}
+
+
 void ShaderCore::checkCompileError_(const ShaderID& shaderID) const {
   GLint status = GL_TRUE;
   glGetShaderiv(shaderID.shader, GL_COMPILE_STATUS, &status);
@@ -134,4 +229,19 @@ void ShaderCore::checkLinkError_(GLuint program) const {
 }
 
 
+bool ShaderCore::isCompiled_(GLuint shader) const {
+  // shaders whose compilation is in progress count as compiled
+  if (SCG_GL_EXTENSION_SUPPORTED(KHR_parallel_shader_compile)) {
+    GLint isComplete = GL_TRUE;
+    glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &isComplete);
+    if (isComplete != GL_TRUE) {
+      return true;
+    }
+  }
+  GLint status = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+  return status == GL_TRUE;
+}
+
+
 } /* namespace scg */
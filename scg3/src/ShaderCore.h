@@ -29,6 +29,7 @@
 #define SHADERCORE_H_
 
 #include <cassert>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -42,6 +43,10 @@ namespace scg {
 /**
  * \brief A shader ID to identify shaders in error messages.
  * An arbitrary name can be added to the OpnGL shader index, e.g., a file name.
+ *
+ * A shader object may be shared by several programs (see ShaderCoreFactory).
+ * In this case, sharedShader holds a reference to the shader object, which is
+ * deleted together with its last reference.
  */
 struct ShaderID {
 
@@ -53,8 +58,19 @@ struct ShaderID {
       : shader(shader0), name(name0) {
   }
 
+  ShaderID(GLuint shader0, const std::string& name0, std::shared_ptr<GLuint> sharedShader0)
+      : shader(shader0), name(name0), sharedShader(sharedShader0) {
+  }
+
+  /**
+   * Create shared shader object reference, which deletes the shader object
+   * when the last reference is released.
+   */
+  static std::shared_ptr<GLuint> createSharedShader(GLuint shader);
+
   GLuint shader;
   std::string name;
+  std::shared_ptr<GLuint> sharedShader;
 
 };
 
@@ -81,7 +97,8 @@ public:
   virtual ~ShaderCore();
 
   /**
-   * Delete shaders and program.
+   * Delete shaders and program, shared shaders are deleted when they are
+   * no longer used by other programs.
    */
   void clear();
 
@@ -94,14 +111,42 @@ public:
    * Initialize shader core, i.e., compile shaders and link program,
    * to be called by ShaderCoreFactory or by application after binding
    * custom attribute and fragment data locations.
+   * Shaders that have already been compiled (e.g., shared shaders) are not compiled again.
+   * If a binary cache is given, the linked program is loaded from the cache if possible,
+   * or saved to the cache otherwise.
+   */
+  void init(ShaderBinaryCache* binaryCache = nullptr) const;
+
+  /**
+   * Start initialization, i.e., compile shaders and link program without waiting for
+   * the results, such that the driver may compile several programs in parallel
+   * (see KHR_parallel_shader_compile). finishInit() has to be called before the
+   * program is used.
+   */
+  void initAsync(ShaderBinaryCache* binaryCache = nullptr) const;
+
+  /**
+   * Check if compiling and linking started by initAsync() has completed, without blocking
+   * (always true if KHR_parallel_shader_compile is not supported).
    */
-  void init() const;
+  bool isInitComplete() const;
+
+  /**
+   * Finish initialization started by initAsync(), i.e., wait for compiling and linking
+   * and check for errors.
+   */
+  void finishInit() const;
 
   /**
    * Get shader program.
    */
   GLuint getProgram() const;
 
+  /**
+   * Get shaders of program.
+   */
+  const std::vector<ShaderID>& getShaderIDs() const;
+
   /**
    * Get location of uniform variable.
    */
@@ -225,6 +270,11 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+  /**
+   * Label shader program (default: names of its shaders, set by initAsync()) for GL debuggers (cf. GLDebug).
+   */
+  virtual void setDebugLabel(const std::string& label);
+
 protected:
 
   /**
@@ -237,12 +287,21 @@ protected:
    */
   void checkLinkError_(GLuint program) const;
 
+  /**
+   * Check if shader has been compiled or is being compiled in parallel.
+   */
+  bool isCompiled_(GLuint shader) const;
+
 protected:
 
   GLuint program_;
   std::vector<ShaderID> shaderIDs_;
   ShaderCore* shaderCoreOld_;
   mutable std::unordered_map<std::string, GLint> uniformLocMap_;
+  mutable ShaderBinaryCache* binaryCache_;
+  mutable std::string binaryKey_;
+  mutable bool isLoadedFromBinary_;
+  mutable double initStartTime_;
 
 };
 
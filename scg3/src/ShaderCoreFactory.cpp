@@ -21,12 +21,20 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
 #include "scg_internals.h"
+#include "ShaderBinaryCache.h"
 #include "ShaderCore.h"
 #include "ShaderCoreFactory.h"
+#include "ResourceCache.h"
 #include "scg_utilities.h"
+#include "Tracer.h"
 
 namespace scg {
 
@@ -50,7 +58,34 @@ void ShaderCoreFactory::addFilePath(const std::string& filePath) {
 }
 
 
+void ShaderCoreFactory::setResourceCache(ResourceCacheSP resourceCache) {
+  resourceCache_ = resourceCache;
+}
+
+
+ResourceCacheSP ShaderCoreFactory::getResourceCache() const {
+  return resourceCache_;
+}
+
+
+void ShaderCoreFactory::setBinaryCache(ShaderBinaryCacheSP binaryCache) {
+  binaryCache_ = binaryCache;
+}
+
+
+ShaderBinaryCacheSP ShaderCoreFactory::getBinaryCache() const {
+  return binaryCache_;
+}
+
+
 ShaderCoreSP ShaderCoreFactory::createColorShader() {
+  // return cached core (if any)
+  std::string key = ResourceCache::makeKey("colorShader", {});
+  auto cachedCore = findCached_(key);
+  if (cachedCore) {
+    return cachedCore;
+  }
+
   // create program and shader vector
   GLuint program = glCreateProgram();
   assert(glIsProgram(program));
@@ -94,15 +129,23 @@ ShaderCoreSP ShaderCoreFactory::createColorShader() {
 
   // compile shaders and link program
   auto core = ShaderCore::create(program, shaderIDs);
-  core ->init();
+  core->init(binaryCache_.get());
 
   assert(!checkGLError());
 
+  insertCached_(key, core, shaderIDs);
   return core;
 }
 
 
 ShaderCoreSP ShaderCoreFactory::createGouraudShader() {
+  // return cached core (if any)
+  std::string key = ResourceCache::makeKey("gouraudShader", {});
+  auto cachedCore = findCached_(key);
+  if (cachedCore) {
+    return cachedCore;
+  }
+
   // create program and shader vector
   GLuint program = glCreateProgram();
   assert(glIsProgram(program));
@@ -185,49 +228,96 @@ ShaderCoreSP ShaderCoreFactory::createGouraudShader() {
 
   // compile shaders and link program
   auto core = ShaderCore::create(program, shaderIDs);
-  core ->init();
+  core->init(binaryCache_.get());
 
   // bind standard uniform blocks
   OGLConstants::bindUniformBlocks(program);
 
   assert(!checkGLError());
 
+  insertCached_(key, core, shaderIDs);
   return core;
 }
 
 
-ShaderCoreSP ShaderCoreFactory::createShaderFromSourceFiles(
-    const std::vector<ShaderFile>& shaderFiles) {
+ShaderCoreSP ShaderCoreFactory::createOverlayShader() {
+  // return cached core (if any)
+  std::string key = ResourceCache::makeKey("overlayShader", {});
+  auto cachedCore = findCached_(key);
+  if (cachedCore) {
+    return cachedCore;
+  }
+
   // create program and shader vector
   GLuint program = glCreateProgram();
   assert(glIsProgram(program));
   std::vector<ShaderID> shaderIDs;
 
-  // load shaders from source files
-  for (auto shaderFile : shaderFiles) {
-    GLuint shader = glCreateShader(shaderFile.shaderType);
-    assert(glIsShader(shader));
-    shaderIDs.push_back(ShaderID(shader, shaderFile.fileName));
-    int error = loadSourceFile_(shader, shaderFile.fileName);
-    if (error != 0) {
-      throw std::runtime_error("cannot open file " + shaderFile.fileName
-          + " [ShaderCoreFactory::createShaderFromSourceFiles()]");
-    }
-  }
+  // create vertex shader, vertex positions in pixels (top left origin)
+  const char* sourceVert = "\
+      #version 150 \n\
+      in vec4 vVertex; \n\
+      in vec4 vTexCoord0; \n\
+      uniform vec2 viewportSize; \n\
+      out vec2 texCoord; \n\
+      void main() { \n\
+        gl_Position = vec4(2.0 * vVertex.x / viewportSize.x - 1.0, \n\
+            1.0 - 2.0 * vVertex.y / viewportSize.y, 0.0, 1.0); \n\
+        texCoord = vTexCoord0.xy; \n\
+      } \n\
+      ";
+
+  GLuint shaderVert = glCreateShader(GL_VERTEX_SHADER);
+  assert(glIsShader(shaderVert));
+  shaderIDs.push_back(ShaderID(shaderVert, "overlay vertex shader"));
+  glShaderSource(shaderVert, 1, &sourceVert, 0);
+
+  // create fragment shader
+  const char* sourceFrag = "\
+      #version 150 \n\
+      in vec2 texCoord; \n\
+      uniform sampler2D texture0; \n\
+      out vec4 fragColor; \n\
+      void main(void) { \n\
+        fragColor = texture(texture0, texCoord); \n\
+      } \n\
+      ";
+
+  GLuint shaderFrag = glCreateShader(GL_FRAGMENT_SHADER);
+  assert(glIsShader(shaderFrag));
+  shaderIDs.push_back(ShaderID(shaderFrag, "overlay fragment shader"));
+  glShaderSource(shaderFrag, 1, &sourceFrag, 0);
 
   // bind standard attribute and fragment data locations
   OGLConstants::bindAttribFragDataLocations(program);
 
   // compile shaders and link program
   auto core = ShaderCore::create(program, shaderIDs);
-  core ->init();
+  core->init(binaryCache_.get());
 
-  // bind standard uniform blocks and sampler texture units
-  OGLConstants::bindUniformBlocks(program);
+  // bind standard sampler texture units
   OGLConstants::bindSamplers(program);
 
   assert(!checkGLError());
 
+  insertCached_(key, core, shaderIDs);
+  return core;
+}
+
+
+ShaderCoreSP ShaderCoreFactory::createShaderFromSourceFiles(
+    const std::vector<ShaderFile>& shaderFiles) {
+  // return cached core (if any), key consists of shader types and full file names
+  std::string key = "shader" + makeKey_(shaderFiles, ShaderDefines());
+  auto cachedCore = findCached_(key);
+  if (cachedCore) {
+    return cachedCore;
+  }
+
+  // create shader core without defines
+  auto core = submitShader_(shaderFiles, ShaderDefines(), nullptr);
+  finishShader_(core);
+  insertCached_(key, core, core->getShaderIDs());
   return core;
 }
 
@@ -239,43 +329,415 @@ ShaderCoreSP ShaderCoreFactory::createShaderFromSourceFiles(
 }
 
 
-int ShaderCoreFactory::loadSourceFile_(GLuint shader, const std::string& fileName) const {
-  int error = 0;
+ShaderCoreSP ShaderCoreFactory::createShaderVariant(const std::vector<ShaderFile>& shaderFiles,
+    const ShaderDefines& defines) {
+  // return existing variant (if any), key consists of shader types, full file names,
+  // and defines
+  std::string key = makeKey_(shaderFiles, defines);
+  auto it = variants_.find(key);
+  if (it != variants_.end()) {
+    return it->second;
+  }
 
-  do {
-    // try to find file
-    std::string fullFileName = getFullFileName(filePaths_, fileName);
-    if (fullFileName.empty()) {
-      error = 1;
-      break;
+  // create and keep shader core
+  auto core = submitShader_(shaderFiles, defines, nullptr);
+  finishShader_(core);
+  variants_[key] = core;
+  return core;
+}
+
+
+std::vector<ShaderCoreSP> ShaderCoreFactory::createShaders(
+    const std::vector<ShaderProgramSource>& programs, bool isWarmUp) {
+  std::vector<ShaderCoreSP> cores(programs.size());
+
+  // find existing cores, as in createShaderFromSourceFiles() and createShaderVariant()
+  std::vector<std::string> keys(programs.size());
+  std::unordered_map<std::string, size_t> newPrograms;
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < programs.size(); ++i) {
+    keys[i] = makeKey_(programs[i].shaderFiles, programs[i].defines);
+    if (programs[i].defines.empty()) {
+      keys[i] = "shader" + keys[i];
+      cores[i] = findCached_(keys[i]);
     }
-    std::ifstream istr(fullFileName);
-    if (!istr.is_open()) {
-      error = 1;
-      break;
+    else {
+      auto it = variants_.find(keys[i]);
+      if (it != variants_.end()) {
+        cores[i] = it->second;
+      }
+    }
+    if (!cores[i] && newPrograms.insert(std::make_pair(keys[i], i)).second) {
+      pending.push_back(i);
+    }
+  }
+
+  // collect new shader objects
+  std::vector<std::string> shaderKeys;
+  std::vector<std::pair<const ShaderFile*, const ShaderDefines*>> shaderJobs;
+  for (size_t i : pending) {
+    for (auto& shaderFile : programs[i].shaderFiles) {
+      std::string shaderKey = makeShaderKey_(shaderFile, programs[i].defines);
+      auto it = sharedShaders_.find(shaderKey);
+      if ((it == sharedShaders_.end() || it->second.sharedShader.expired())
+          && std::find(shaderKeys.begin(), shaderKeys.end(), shaderKey) == shaderKeys.end()) {
+        shaderKeys.push_back(shaderKey);
+        shaderJobs.push_back(std::make_pair(&shaderFile, &programs[i].defines));
+      }
+    }
+  }
+
+  // read and preprocess source files in parallel (no OpenGL calls)
+  std::vector<ShaderSource> shaderSources(shaderJobs.size());
+  std::atomic<size_t> nextJob(0);
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+  auto preprocessJobs = [&]() {
+    for (size_t j = nextJob++; j < shaderJobs.size(); j = nextJob++) {
+      try {
+        auto& shaderSource = shaderSources[j];
+        if (loadSourceFile_(shaderJobs[j].first->fileName, *shaderJobs[j].second,
+            shaderSource.source, shaderSource.includedFiles) != 0) {
+          throw std::runtime_error("cannot open file " + shaderJobs[j].first->fileName
+              + " [ShaderCoreFactory::createShaders()]");
+        }
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        exception = std::current_exception();
+      }
+    }
+  };
+  size_t nThreads = std::min(static_cast<size_t>(std::thread::hardware_concurrency()),
+      shaderJobs.size());
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < nThreads; ++t) {
+    threads.push_back(std::thread(preprocessJobs));
+  }
+  preprocessJobs();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+  std::unordered_map<std::string, const ShaderSource*> shaderSourceMap;
+  for (size_t j = 0; j < shaderKeys.size(); ++j) {
+    shaderSourceMap[shaderKeys[j]] = &shaderSources[j];
+  }
+
+  // submit all programs, allowing the driver to compile them in parallel
+  if (SCG_GL_EXTENSION_SUPPORTED(KHR_parallel_shader_compile)) {
+    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+  }
+  for (size_t i : pending) {
+    cores[i] = submitShader_(programs[i].shaderFiles, programs[i].defines, &shaderSourceMap);
+  }
+
+  // wait for results, check errors, and keep or cache new cores
+  for (size_t i : pending) {
+    finishShader_(cores[i]);
+    if (programs[i].defines.empty()) {
+      insertCached_(keys[i], cores[i], cores[i]->getShaderIDs());
+    }
+    else {
+      variants_[keys[i]] = cores[i];
+    }
+  }
+  for (size_t i = 0; i < programs.size(); ++i) {
+    if (!cores[i]) {
+      cores[i] = cores[newPrograms[keys[i]]];
+    }
+  }
+
+  // issue a draw call per new program to trigger deferred driver work
+  if (isWarmUp) {
+    std::vector<ShaderCoreSP> newCores;
+    for (size_t i : pending) {
+      newCores.push_back(cores[i]);
     }
+    warmUp_(newCores);
+  }
+
+  return cores;
+}
+
+
+int ShaderCoreFactory::getNVariants() const {
+  return static_cast<int>(variants_.size());
+}
+
+
+int ShaderCoreFactory::getNSharedShaders() const {
+  int nShaders = 0;
+  for (auto& entry : sharedShaders_) {
+    if (!entry.second.sharedShader.expired()) {
+      ++nShaders;
+    }
+  }
+  return nShaders;
+}
+
+
+void ShaderCoreFactory::clearVariants() {
+  variants_.clear();
+  sharedShaders_.clear();
+  std::lock_guard<std::mutex> lock(sourceFilesMutex_);
+  sourceFiles_.clear();
+}
+
 
-    // read shader source
-    char line[1024];
-    std::vector<std::string> sourceVec;
-    while (istr.getline(line, 1024)) {
-      sourceVec.push_back(std::string(line) + '\n');
+ShaderCoreSP ShaderCoreFactory::submitShader_(const std::vector<ShaderFile>& shaderFiles,
+    const ShaderDefines& defines,
+    const std::unordered_map<std::string, const ShaderSource*>* shaderSources) {
+  // create program and shader vector
+  GLuint program = glCreateProgram();
+  assert(glIsProgram(program));
+  std::vector<ShaderID> shaderIDs;
+
+  // load shaders from source files, shader objects are shared by all programs using
+  // the same file, stage, and defines
+  for (auto& shaderFile : shaderFiles) {
+    std::string key = makeShaderKey_(shaderFile, defines);
+    auto it = sharedShaders_.find(key);
+    if (it != sharedShaders_.end()) {
+      auto sharedShader = it->second.sharedShader.lock();
+      if (sharedShader) {
+        shaderIDs.push_back(ShaderID(*sharedShader, it->second.name, sharedShader));
+        continue;
+      }
     }
-    istr.close();
 
-    // pass shader source to OpenGL
-    const GLchar** source = new const GLchar*[sourceVec.size()];
-    for (unsigned int i = 0; i < sourceVec.size(); i++) {
-      source[i] = reinterpret_cast<const GLchar*>(sourceVec[i].c_str());
+    // use preprocessed source (if any)
+    ShaderSource shaderSource;
+    auto sourceIt = shaderSources ? shaderSources->find(key)
+        : std::unordered_map<std::string, const ShaderSource*>::const_iterator();
+    if (shaderSources && sourceIt != shaderSources->end()) {
+      shaderSource = *sourceIt->second;
     }
+    else if (loadSourceFile_(shaderFile.fileName, defines, shaderSource.source,
+        shaderSource.includedFiles) != 0) {
+      throw std::runtime_error("cannot open file " + shaderFile.fileName
+          + " [ShaderCoreFactory::submitShader_()]");
+    }
+    GLuint shader = glCreateShader(shaderFile.shaderType);
     assert(glIsShader(shader));
-    glShaderSource(shader, sourceVec.size(), source, NULL);
-    delete[] source;
-    source = 0;
-  } while (false);
+    const GLchar* source = shaderSource.source.c_str();
+    glShaderSource(shader, 1, &source, NULL);
+
+    // name includes source string numbers of included files
+    std::string name = shaderFile.fileName;
+    auto& includedFiles = shaderSource.includedFiles;
+    for (size_t i = 1; i < includedFiles.size(); ++i) {
+      name += (i == 1 ? " (includes " : ", ") + std::to_string(i) + ": " + includedFiles[i]
+          + (i + 1 == includedFiles.size() ? ")" : "");
+    }
+    auto sharedShader = ShaderID::createSharedShader(shader);
+    SharedShaderEntry entry = { sharedShader, name };
+    sharedShaders_[key] = entry;
+    shaderIDs.push_back(ShaderID(shader, name, sharedShader));
+  }
+
+  // bind standard attribute and fragment data locations
+  OGLConstants::bindAttribFragDataLocations(program);
+
+  // compile shaders and link program without waiting
+  auto core = ShaderCore::create(program, shaderIDs);
+  core->initAsync(binaryCache_.get());
+  return core;
+}
+
+
+void ShaderCoreFactory::finishShader_(ShaderCoreSP core) {
+  // wait for compiling and linking
+  core->finishInit();
+
+  // bind standard uniform blocks and sampler texture units
+  OGLConstants::bindUniformBlocks(core->getProgram());
+  OGLConstants::bindSamplers(core->getProgram());
+
+  assert(!checkGLError());
+}
+
+
+void ShaderCoreFactory::warmUp_(const std::vector<ShaderCoreSP>& cores) const {
+  // draw a degenerate triangle without attributes, which does not produce any fragments,
+  // using the current render state (drivers may compile state-dependent shader code)
+  GLint programOld = 0;
+  GLint vaoOld = 0;
+  glGetIntegerv(GL_CURRENT_PROGRAM, &programOld);
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vaoOld);
+  GLuint vao = 0;
+  glGenVertexArrays(1, &vao);
+  glBindVertexArray(vao);
+  for (auto& core : cores) {
+    glUseProgram(core->getProgram());
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  glBindVertexArray(vaoOld);
+  glDeleteVertexArrays(1, &vao);
+  glUseProgram(programOld);
 
-  return error;
+  assert(!checkGLError());
+}
+
+
+int ShaderCoreFactory::loadSourceFile_(const std::string& fileName, const ShaderDefines& defines,
+    std::string& source, std::vector<std::string>& includedFiles) {
+  SCG_TRACE_SCOPE_ARG("load shader source file", fileName);
+  // try to find file
+  std::string fullFileName = getFullFileName(filePaths_, fileName);
+  if (fullFileName.empty() || !getSourceFile_(fullFileName)) {
+    return 1;
+  }
+
+  // preprocess shader source
+  preprocess_(fullFileName, defines, includedFiles, source);
+
+  return 0;
+}
+
+
+void ShaderCoreFactory::preprocess_(const std::string& fullFileName,
+    const ShaderDefines& defines, std::vector<std::string>& includedFiles,
+    std::string& source) {
+  // include each file only once
+  if (std::find(includedFiles.begin(), includedFiles.end(), fullFileName)
+      != includedFiles.end()) {
+    return;
+  }
+  const std::string* fileSource = getSourceFile_(fullFileName);
+  if (!fileSource) {
+    throw std::runtime_error("cannot open file " + fullFileName
+        + " [ShaderCoreFactory::preprocess_()]");
+  }
+  int fileIndex = static_cast<int>(includedFiles.size());
+  includedFiles.push_back(fullFileName);
+  std::string defineLines;
+  if (fileIndex == 0) {
+    for (auto& define : defines) {
+      defineLines += "#define " + define.first + " " + define.second + '\n';
+    }
+  }
+  size_t startPos = source.size();
+  bool hasVersion = false;
+
+  std::istringstream istr(*fileSource);
+  std::string line;
+  int lineNo = 0;
+  while (std::getline(istr, line)) {
+    ++lineNo;
+    size_t pos = line.find_first_not_of(" \t");
+    if (pos != std::string::npos && line.compare(pos, 8, "#version") == 0) {
+      if (fileIndex == 0) {
+        // insert defines after version directive of main file
+        hasVersion = true;
+        source += line + '\n' + defineLines;
+        if (!defines.empty()) {
+          source += "#line " + std::to_string(lineNo + 1) + " 0\n";
+        }
+      }
+      else {
+        // remove version directive of included file
+        source += '\n';
+      }
+    }
+    else if (pos != std::string::npos && line.compare(pos, 8, "#include") == 0) {
+      // extract file name in quotes or angle brackets
+      size_t first = line.find_first_of("\"<", pos + 8);
+      size_t last = (first == std::string::npos) ? first
+          : line.find_first_of("\">", first + 1);
+      if (last == std::string::npos) {
+        throw std::runtime_error("invalid #include directive in " + fullFileName
+            + " [ShaderCoreFactory::preprocess_()]");
+      }
+      std::string includeFileName = line.substr(first + 1, last - first - 1);
+
+      // search relative to including file first, then in known file paths
+      std::string includePath = fullFileName.substr(0,
+          fullFileName.find_last_of("/\\") + 1);
+      std::string fullIncludeFileName = includePath + includeFileName;
+      if (!getSourceFile_(fullIncludeFileName)) {
+        fullIncludeFileName = getFullFileName(filePaths_, includeFileName);
+      }
+      if (fullIncludeFileName.empty()) {
+        throw std::runtime_error("cannot open file " + includeFileName + " included by "
+            + fullFileName + " [ShaderCoreFactory::preprocess_()]");
+      }
+
+      // insert included source, line numbers refer to source string numbers of files
+      source += "#line 1 " + std::to_string(includedFiles.size()) + '\n';
+      preprocess_(fullIncludeFileName, defines, includedFiles, source);
+      source += "#line " + std::to_string(lineNo + 1) + " " + std::to_string(fileIndex) + '\n';
+    }
+    else {
+      source += line + '\n';
+    }
+  }
+
+  // insert defines at top of main file without version directive
+  if (fileIndex == 0 && !hasVersion && !defines.empty()) {
+    source.insert(startPos, defineLines + "#line 1 0\n");
+  }
 }
 
 
+const std::string* ShaderCoreFactory::getSourceFile_(const std::string& fullFileName) {
+  // lock to allow preprocessing in parallel, pointers to map elements remain valid
+  std::lock_guard<std::mutex> lock(sourceFilesMutex_);
+  auto it = sourceFiles_.find(fullFileName);
+  if (it == sourceFiles_.end()) {
+    std::ifstream istr(fullFileName);
+    if (!istr.is_open()) {
+      return nullptr;
+    }
+    std::stringstream stream;
+    stream << istr.rdbuf();
+    it = sourceFiles_.insert(it, std::make_pair(fullFileName, stream.str()));
+  }
+  return &it->second;
+}
+
+
+std::string ShaderCoreFactory::makeKey_(const std::vector<ShaderFile>& shaderFiles,
+    const ShaderDefines& defines) const {
+  std::string key;
+  for (auto& shaderFile : shaderFiles) {
+    key += ResourceCache::makeKey(getFullFileName(filePaths_, shaderFile.fileName),
+        {static_cast<double>(shaderFile.shaderType)});
+  }
+  for (auto& define : defines) {
+    key += ";" + define.first + "=" + define.second;
+  }
+  return key;
+}
+
+
+std::string ShaderCoreFactory::makeShaderKey_(const ShaderFile& shaderFile,
+    const ShaderDefines& defines) const {
+  return makeKey_(std::vector<ShaderFile>(1, shaderFile), defines);
+}
+
+
+ShaderCoreSP ShaderCoreFactory::findCached_(const std::string& key) const {
+  if (!resourceCache_) {
+    return nullptr;
+  }
+  return std::static_pointer_cast<ShaderCore>(resourceCache_->find(key));
+}
+
+
+void ShaderCoreFactory::insertCached_(const std::string& key, ShaderCoreSP core,
+    const std::vector<ShaderID>& shaderIDs) const {
+  if (resourceCache_) {
+    size_t size = 0;
+    for (auto& shaderID : shaderIDs) {
+      GLint length = 0;
+      glGetShaderiv(shaderID.shader, GL_SHADER_SOURCE_LENGTH, &length);
+      size += static_cast<size_t>(length);
+    }
+    resourceCache_->insert(key, core, size);
+  }
+}
+
 } /* namespace scg */
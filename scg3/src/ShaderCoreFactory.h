@@ -28,7 +28,11 @@
 #ifndef SHADERCOREFACTORY_H_
 #define SHADERCOREFACTORY_H_
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "scg_glew_glad.h"
 #include "scg_internals.h"
@@ -50,6 +54,28 @@ struct ShaderFile {
 };
 
 
+/**
+ * \brief Preprocessor macro names and values defining a shader variant,
+ *    e.g., {{"N_LIGHTS", "2"}, {"TEXTURE", "1"}}, to be used by ShaderCoreFactory.
+ */
+typedef std::map<std::string, std::string> ShaderDefines;
+
+
+/**
+ * \brief Shader files and defines of a shader program, to be used by
+ *    ShaderCoreFactory::createShaders().
+ */
+struct ShaderProgramSource {
+  ShaderProgramSource(const std::vector<ShaderFile>& shaderFiles0,
+      const ShaderDefines& defines0 = ShaderDefines()) :
+    shaderFiles(shaderFiles0), defines(defines0) {
+  }
+
+  std::vector<ShaderFile> shaderFiles;
+  ShaderDefines defines;
+};
+
+
 /**
  * \brief A factory to create shader cores.
  */
@@ -83,6 +109,28 @@ public:
    */
   void addFilePath(const std::string& filePath);
 
+  /**
+   * Set resource cache to share shader cores created from identical sources
+   * (nullptr: no caching, default).
+   */
+  void setResourceCache(ResourceCacheSP resourceCache);
+
+  /**
+   * Get resource cache (nullptr if caching is disabled).
+   */
+  ResourceCacheSP getResourceCache() const;
+
+  /**
+   * Set on-disk cache of program binaries to skip compiling and linking
+   * (nullptr: no caching, default).
+   */
+  void setBinaryCache(ShaderBinaryCacheSP binaryCache);
+
+  /**
+   * Get on-disk cache of program binaries (nullptr if caching is disabled).
+   */
+  ShaderBinaryCacheSP getBinaryCache() const;
+
   /**
    * Create a simple shader program without lighting.
    *
@@ -101,8 +149,19 @@ public:
    */
   ShaderCoreSP createGouraudShader();
 
+  /**
+   * Create a shader program for screen-space overlays, drawing textured triangles
+   * (RGBA texture with straight alpha), e.g., PerformanceHUD.
+   *
+   * attributes: vVertex (x, y in pixels from top left corner), vTexCoord0 (u, v)\n
+   * uniforms: viewportSize, texture0
+   */
+  ShaderCoreSP createOverlayShader();
+
   /**
    * Load shaders from source files, compile, and link to create a shader program.
+   * Each shader object (file and shader type) is compiled only once and shared by all
+   * programs created by this factory, e.g., blinn_phong_lighting.glsl.
    * \param shaderFiles vector of shader files, each consisting of a file name (to be
    *    searched for in known file paths) and a shader type (GL_VERTEX_SHADER,
    *    GL_FRAGMENT_SHADER, or GL_GEOMETRY_SHADER).
@@ -119,19 +178,166 @@ public:
   ShaderCoreSP createShaderFromSourceFiles(
       std::vector<ShaderFile>&& shaderFiles);
 
+  /**
+   * Create a shader variant from source files, i.e., a shader program whose sources
+   * are preprocessed with the given macro definitions. Variants are generated on demand
+   * and kept by the factory, such that each combination of files and defines is compiled
+   * only once. Source files are read only once as well.
+   *
+   * The macros are inserted after the #version directive of each shader. Compile-time
+   * constants replace runtime branches, e.g., the shaders phong_variant_vert.glsl and
+   * phong_variant_frag.glsl support the following defines:
+   * - N_LIGHTS: number of lights as constant instead of uniform nLights
+   *   (must match the number of lights in the scene)
+   * - TEXTURE: 2D texture modulation via texture0 (0 or 1)
+   * - BUMP: bump mapping via normal map texture1, requires tangents and binormals (0 or 1)
+   *
+   * Example:
+   * \code
+   * auto shader = shaderFactory.createShaderVariant({
+   *     ShaderFile("phong_variant_vert.glsl", GL_VERTEX_SHADER),
+   *     ShaderFile("phong_variant_frag.glsl", GL_FRAGMENT_SHADER)},
+   *     {{"N_LIGHTS", "1"}, {"TEXTURE", "1"}});
+   * \endcode
+   *
+   * \param shaderFiles vector of shader files, see createShaderFromSourceFiles()
+   * \param defines macro names and values
+   */
+  ShaderCoreSP createShaderVariant(const std::vector<ShaderFile>& shaderFiles,
+      const ShaderDefines& defines);
+
+  /**
+   * Create several shader programs at once, e.g., at startup. Source files are read and
+   * preprocessed by parallel threads, then all programs are compiled and linked before
+   * any results are checked, such that the driver may compile them in parallel
+   * (see KHR_parallel_shader_compile). Programs with defines are created as by
+   * createShaderVariant(), programs without defines as by createShaderFromSourceFiles().
+   *
+   * \param programs shader files and defines of programs
+   * \param isWarmUp true if a draw call is to be issued for each new program, such that
+   *    deferred driver work does not delay the first frame
+   * \return shader cores in the order of programs
+   */
+  std::vector<ShaderCoreSP> createShaders(const std::vector<ShaderProgramSource>& programs,
+      bool isWarmUp = false);
+
+  /**
+   * Get number of shader variants kept by the factory.
+   */
+  int getNVariants() const;
+
+  /**
+   * Get number of shader objects that are currently shared by the programs
+   * created by this factory.
+   */
+  int getNSharedShaders() const;
+
+  /**
+   * Remove shader variants, shared shader objects, and source files kept by the factory,
+   * e.g., to reload modified source files. Existing shader cores are not affected.
+   */
+  void clearVariants();
+
 protected:
 
   /**
-   * Load shader from source file.
+   * Preprocessed shader source.
+   */
+  struct ShaderSource {
+    std::string source;
+    std::vector<std::string> includedFiles;
+  };
+
+  /**
+   * Create shader program from shared shader objects (loading and preprocessing the
+   * source files of new shader objects), and start compiling and linking.
+   * \param shaderFiles shader files of program
+   * \param defines macro names and values
+   * \param shaderSources preprocessed sources by shader key (optional)
+   */
+  ShaderCoreSP submitShader_(const std::vector<ShaderFile>& shaderFiles,
+      const ShaderDefines& defines,
+      const std::unordered_map<std::string, const ShaderSource*>* shaderSources);
+
+  /**
+   * Finish compiling and linking of a program created by submitShader_(),
+   * and bind standard uniform blocks and samplers.
+   */
+  void finishShader_(ShaderCoreSP core);
+
+  /**
+   * Draw a degenerate triangle with each program, which does not change the framebuffer.
+   */
+  void warmUp_(const std::vector<ShaderCoreSP>& cores) const;
+
+  /**
+   * Load shader source from file and preprocess it (thread-safe, no OpenGL calls).
    *
-   * \param shader index the shader shall be attached to
    * \param fileName file name to be searched for in known file paths
+   * \param defines macro names and values to be inserted after the #version directive
+   * \param source output: preprocessed shader source
+   * \param includedFiles output: full names of the source file and its included files,
+   *    the index of a file is used as source string number in #line directives
+   */
+  int loadSourceFile_(const std::string& fileName, const ShaderDefines& defines,
+      std::string& source, std::vector<std::string>& includedFiles);
+
+  /**
+   * Preprocess source file, i.e., insert macro definitions and resolve #include directives
+   * recursively. Included files are searched for relative to the including file first,
+   * then in known file paths. Each file is included only once, independent of
+   * conditional directives (#if etc.), and its #version directive is removed.
+   */
+  void preprocess_(const std::string& fullFileName, const ShaderDefines& defines,
+      std::vector<std::string>& includedFiles, std::string& source);
+
+  /**
+   * Get content of source file, which is read only once (thread-safe).
+   * \return pointer to source, or nullptr if file cannot be read
+   */
+  const std::string* getSourceFile_(const std::string& fullFileName);
+
+  /**
+   * Create key of program from shader types, full file names, and defines.
+   */
+  std::string makeKey_(const std::vector<ShaderFile>& shaderFiles,
+      const ShaderDefines& defines) const;
+
+  /**
+   * Create key of shared shader object from shader type, full file name, and defines.
+   */
+  std::string makeShaderKey_(const ShaderFile& shaderFile, const ShaderDefines& defines) const;
+
+  /**
+   * Find shader core in resource cache (if any).
+   * \return cached core, or nullptr
+   */
+  ShaderCoreSP findCached_(const std::string& key) const;
+
+  /**
+   * Insert shader core into resource cache (if any), using the total source length
+   * of its shaders as saved size.
+   */
+  void insertCached_(const std::string& key, ShaderCoreSP core,
+      const std::vector<ShaderID>& shaderIDs) const;
+
+  /**
+   * Shader object shared by programs, deleted when no longer used.
    */
-  int loadSourceFile_(GLuint shader, const std::string& fileName) const;
+  struct SharedShaderEntry {
+    std::weak_ptr<GLuint> sharedShader;
+    std::string name;
+  };
 
 protected:
 
   std::vector<std::string> filePaths_;
+  ResourceCacheSP resourceCache_;
+  ShaderBinaryCacheSP binaryCache_;
+  std::unordered_map<std::string, ShaderCoreSP> variants_;
+  std::unordered_map<std::string, SharedShaderEntry> sharedShaders_;
+  std::unordered_map<std::string, std::string> sourceFiles_;
+  std::mutex sourceFilesMutex_;
 
 };
 
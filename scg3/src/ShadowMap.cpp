@@ -0,0 +1,689 @@
+/**
+ * \file ShadowMap.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include "BatchTraverser.h"
+#include "FrameProfiler.h"
+#include "GeometryCore.h"
+#include "GLDebug.h"
+#include "Group.h"
+#include "Light.h"
+#include "RenderState.h"
+#include "ShaderCore.h"
+#include "ShadowMap.h"
+#include "Tracer.h"
+#include "Traverser.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+namespace {
+
+// maps clip coordinates [-1,1] to shadow map coordinates [0,1]
+const glm::mat4 CLIP_TO_TEXTURE(
+    0.5f, 0.f, 0.f, 0.f,
+    0.f, 0.5f, 0.f, 0.f,
+    0.f, 0.f, 0.5f, 0.f,
+    0.5f, 0.5f, 0.5f, 1.f);
+
+// offsets of uniform block members
+const size_t MATRICES_OFFSET = 0;
+const size_t CASCADE_ENDS_OFFSET = 256;
+const size_t PARAMS_OFFSET = 272;
+
+// relative tolerance of model matrix comparison, as the model transformation
+// of this node is subject to rounding errors when the camera moves
+const float MATRIX_TOLERANCE = 1e-5f;
+
+bool isNearlyEqual(const glm::mat4& a, const glm::mat4& b) {
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      if (std::fabs(a[i][j] - b[i][j]) > MATRIX_TOLERANCE * (1.f + std::fabs(a[i][j]))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+
+ShadowMap::ShadowMap()
+    : staticRoot_(Group::create()), dynamicRoot_(Group::create()), resolution_(1024), nCascades_(4), nActiveCascades_(0), shadowDistance_(50.f),
+      splitLambda_(0.75f), cascadeMargin_(0.25f), spotNear_(0.1f), spotFar_(100.f),
+      biasFactor_(2.f), biasUnits_(4.f), isDirectional_(true), lightDirection_(0.f),
+      cascades_(), shadowTex_(0), staticTex_(0), fbo_(), ubo_(0), texResolution_(0),
+      texLayers_(0), uboOld_(0), texOld_(0), nStaticUpdates_(0), nStaticDraws_(0),
+      nDynamicDraws_(0), nCulledDraws_(0), updateTime_(0.) {
+}
+
+
+ShadowMap::~ShadowMap() {
+  if (isGLContextActive()) {
+    clearBuffers_();
+  }
+}
+
+
+ShadowMapSP ShadowMap::create() {
+  return std::make_shared<ShadowMap>();
+}
+
+
+ShadowMap* ShadowMap::setLight(LightSP light) {
+  light_ = light;
+  return this;
+}
+
+
+LightSP ShadowMap::getLight() const {
+  return light_;
+}
+
+
+ShadowMap* ShadowMap::setDepthShader(ShaderCoreSP depthShader) {
+  depthShader_ = depthShader;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::addStaticCaster(NodeSP node) {
+  assert(node);
+  staticRoot_->addChild(node);
+  return this;
+}
+
+
+ShadowMap* ShadowMap::addDynamicCaster(NodeSP node) {
+  assert(node);
+  dynamicRoot_->addChild(node);
+  return this;
+}
+
+
+ShadowMap* ShadowMap::clearCasters() {
+  staticRoot_ = Group::create();
+  dynamicRoot_ = Group::create();
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setResolution(GLsizei resolution) {
+  assert(resolution > 0);
+  resolution_ = resolution;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setNCascades(int nCascades) {
+  assert(nCascades > 0 && nCascades <= MAX_CASCADES);
+  nCascades_ = nCascades;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setShadowDistance(float distance) {
+  assert(distance > 0.f);
+  shadowDistance_ = distance;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setSplitLambda(float lambda) {
+  assert(lambda >= 0.f && lambda <= 1.f);
+  splitLambda_ = lambda;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setCascadeMargin(float margin) {
+  assert(margin >= 0.f);
+  cascadeMargin_ = margin;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setSpotRange(float near, float far) {
+  assert(near > 0.f && far > near);
+  spotNear_ = near;
+  spotFar_ = far;
+  return this;
+}
+
+
+ShadowMap* ShadowMap::setDepthBias(float factor, float units) {
+  biasFactor_ = factor;
+  biasUnits_ = units;
+  return this;
+}
+
+
+void ShadowMap::invalidate() {
+  for (auto& cascade : cascades_) {
+    cascade.isStaticValid = false;
+  }
+}
+
+
+int ShadowMap::getNActiveCascades() const {
+  return nActiveCascades_;
+}
+
+
+int ShadowMap::getNStaticUpdates() const {
+  return nStaticUpdates_;
+}
+
+
+int ShadowMap::getNStaticDraws() const {
+  return nStaticDraws_;
+}
+
+
+int ShadowMap::getNDynamicDraws() const {
+  return nDynamicDraws_;
+}
+
+
+int ShadowMap::getNCulledDraws() const {
+  return nCulledDraws_;
+}
+
+
+double ShadowMap::getUpdateTime() const {
+  return updateTime_;
+}
+
+
+void ShadowMap::update(RenderState* renderState) {
+  SCG_TRACE_SCOPE("shadow map update");
+  SCG_GL_DEBUG_GROUP("shadow map update");
+  if (!light_ || !depthShader_) {
+    throw std::runtime_error("Light or depth shader not set [ShadowMap::update()]");
+  }
+  double startTime = getTime();
+  nStaticUpdates_ = nStaticDraws_ = nDynamicDraws_ = nCulledDraws_ = 0;
+
+  // update light matrices, (re-)create textures if size has changed
+  updateCascades_(renderState);
+  if (shadowTex_ == 0 || texResolution_ != resolution_ || texLayers_ != nActiveCascades_) {
+    clearBuffers_();
+    createBuffers_();
+  }
+
+  // collect casters relative to model transformation of this node,
+  // invalidate cached depth if static casters have moved
+  glm::mat4 baseTransform = renderState->getModelMatrix();
+  std::vector<Caster> staticCasters;
+  collectCasters_(renderState, staticRoot_, baseTransform, staticCasters);
+  bool isStaticChanged = (staticCasters.size() != staticCasters_.size());
+  for (size_t i = 0; i < staticCasters.size() && !isStaticChanged; ++i) {
+    isStaticChanged = (staticCasters[i].geometry != staticCasters_[i].geometry
+        || !isNearlyEqual(staticCasters[i].modelMatrix, staticCasters_[i].modelMatrix));
+  }
+  if (isStaticChanged) {
+    staticCasters_.swap(staticCasters);
+    invalidate();
+  }
+  collectCasters_(renderState, dynamicRoot_, baseTransform, dynamicCasters_);
+
+  // save state, prepare depth rendering
+  GLint drawFboOld, readFboOld;
+  GLint viewportOld[4];
+  GLfloat biasFactorOld, biasUnitsOld;
+  GLboolean depthMaskOld;
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFboOld);
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFboOld);
+  glGetIntegerv(GL_VIEWPORT, viewportOld);
+  glGetFloatv(GL_POLYGON_OFFSET_FACTOR, &biasFactorOld);
+  glGetFloatv(GL_POLYGON_OFFSET_UNITS, &biasUnitsOld);
+  glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMaskOld);
+  GLboolean isDepthTestOld = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean isBiasOld = glIsEnabled(GL_POLYGON_OFFSET_FILL);
+  GLboolean isDepthClampOld = glIsEnabled(GL_DEPTH_CLAMP);
+  glViewport(0, 0, resolution_, resolution_);
+  glEnable(GL_DEPTH_TEST);
+  glDepthMask(GL_TRUE);
+  glEnable(GL_POLYGON_OFFSET_FILL);
+  glPolygonOffset(biasFactor_, biasUnits_);
+  // casters between light and near plane of directional light are clamped to near plane
+  if (isDirectional_) {
+    glEnable(GL_DEPTH_CLAMP);
+  }
+  else {
+    glDisable(GL_DEPTH_CLAMP);
+  }
+  depthShader_->render(renderState);
+  renderState->projectionStack.pushMatrix();
+  renderState->modelViewStack.pushMatrix();
+
+  for (int i = 0; i < nActiveCascades_; ++i) {
+    Cascade& cascade = cascades_[i];
+
+    // re-render static casters if cached depth is invalid
+    bool isStaticUpdated = !cascade.isStaticValid;
+    if (isStaticUpdated) {
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo_[0]);
+      glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, staticTex_, 0, i);
+      glClear(GL_DEPTH_BUFFER_BIT);
+      nStaticDraws_ += renderCasters_(renderState, staticCasters_, cascade.viewProjection);
+      cascade.isStaticValid = true;
+      ++nStaticUpdates_;
+    }
+
+    // copy cached depth and render dynamic casters on top
+    if (isStaticUpdated || cascade.hasDynamic || !dynamicCasters_.empty()) {
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_[1]);
+      glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, staticTex_, 0, i);
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo_[0]);
+      glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, shadowTex_, 0, i);
+      glBlitFramebuffer(0, 0, resolution_, resolution_, 0, 0, resolution_, resolution_,
+          GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+      int nDraws = renderCasters_(renderState, dynamicCasters_, cascade.viewProjection);
+      nDynamicDraws_ += nDraws;
+      cascade.hasDynamic = (nDraws > 0);
+    }
+  }
+
+  // restore state
+  renderState->modelViewStack.popMatrix();
+  renderState->projectionStack.popMatrix();
+  depthShader_->renderPost(renderState);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFboOld);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, readFboOld);
+  glViewport(viewportOld[0], viewportOld[1], viewportOld[2], viewportOld[3]);
+  glPolygonOffset(biasFactorOld, biasUnitsOld);
+  glDepthMask(depthMaskOld);
+  if (!isDepthTestOld) {
+    glDisable(GL_DEPTH_TEST);
+  }
+  if (!isBiasOld) {
+    glDisable(GL_POLYGON_OFFSET_FILL);
+  }
+  if (isDepthClampOld) {
+    glEnable(GL_DEPTH_CLAMP);
+  }
+  else {
+    glDisable(GL_DEPTH_CLAMP);
+  }
+
+  // upload uniform block: transformations from eye coordinates into shadow map coordinates,
+  // cascade ends, number of cascades, and index of shadowed light
+  GLubyte block[BLOCK_SIZE];
+  memset(block, 0, BLOCK_SIZE);
+  glm::mat4 invViewTransform = glm::inverse(renderState->getViewTransform());
+  glm::vec4 cascadeEnds(0.f);
+  for (int i = 0; i < nActiveCascades_; ++i) {
+    glm::mat4 shadowMatrix = CLIP_TO_TEXTURE * cascades_[i].viewProjection * invViewTransform;
+    memcpy(block + MATRICES_OFFSET + i * sizeof(glm::mat4), glm::value_ptr(shadowMatrix),
+        sizeof(glm::mat4));
+    cascadeEnds[i] = cascades_[i].end;
+  }
+  memcpy(block + CASCADE_ENDS_OFFSET, glm::value_ptr(cascadeEnds), sizeof(glm::vec4));
+  GLint params[4] = { nActiveCascades_, renderState->getLightIndex(light_.get()), 0, 0 };
+  memcpy(block + PARAMS_OFFSET, params, sizeof(params));
+  glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  glBufferData(GL_UNIFORM_BUFFER, BLOCK_SIZE, block, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  renderState->stats.nUploadedBytes += BLOCK_SIZE;
+
+  assert(!checkGLError());
+  updateTime_ = 1000. * (getTime() - startTime);
+}
+
+
+void ShadowMap::traverse(Traverser* traverser) {
+  // check if node and its sub-tree are visible
+  if (isVisible_) {
+    // time node and its sub-tree if tagged for profiling
+    FrameProfiler* profiler = isProfiled_ ? traverser->getFrameProfiler() : nullptr;
+    if (profiler) {
+      profiler->beginNode(this);
+    }
+
+    // enclose node and its sub-tree in debug group if labeled
+    bool isDebugGroup = isLabeled_ && GLDebug::isActive();
+    if (isDebugGroup) {
+      GLDebug::pushGroup(getMetaInfo(GLDebug::META_INFO_KEY).c_str());
+    }
+
+    // process node
+    accept(traverser);
+
+    // traverse casters and children (if any)
+    staticRoot_->traverse(traverser);
+    dynamicRoot_->traverse(traverser);
+    if (leftChild_) {
+      leftChild_->traverse(traverser);
+    }
+
+    // post-process node
+    acceptPost(traverser);
+
+    if (isDebugGroup) {
+      GLDebug::popGroup();
+    }
+    if (profiler) {
+      profiler->endScope();
+    }
+  }
+
+  // recursively traverse siblings (if any)
+  if (rightSibling_) {
+    rightSibling_->traverse(traverser);
+  }
+}
+
+
+void ShadowMap::accept(Traverser* traverser) {
+  traverser->visitShadowMap(this);
+}
+
+
+void ShadowMap::acceptPost(Traverser* traverser) {
+  traverser->visitPostShadowMap(this);
+}
+
+
+void ShadowMap::render(RenderState* renderState) {
+  update(renderState);
+
+  // bind uniform block and shadow map, save previous bindings
+  glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, OGLConstants::SHADOW.bindingPoint, &uboOld_);
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::SHADOW.bindingPoint, ubo_);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::SHADOW_MAP.texUnit);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &texOld_);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, shadowTex_);
+  glActiveTexture(GL_TEXTURE0);
+  ++renderState->stats.nBufferBinds;
+  ++renderState->stats.nTextureBinds;
+
+  assert(!checkGLError());
+}
+
+
+void ShadowMap::renderPost(RenderState* renderState) {
+  // restore previous bindings
+  glBindBufferBase(GL_UNIFORM_BUFFER, OGLConstants::SHADOW.bindingPoint, uboOld_);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::SHADOW_MAP.texUnit);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texOld_);
+  glActiveTexture(GL_TEXTURE0);
+
+  assert(!checkGLError());
+}
+
+
+void ShadowMap::collectCasters_(RenderState* renderState, GroupSP root,
+    const glm::mat4& baseTransform, std::vector<Caster>& casters) {
+  casters.clear();
+  BatchTraverser batchTraverser(renderState);
+  renderState->modelViewStack.pushMatrix(baseTransform);
+  root->traverse(&batchTraverser);
+  renderState->modelViewStack.popMatrix();
+
+  for (auto& item : batchTraverser.getItems()) {
+    if (!item.geometry->hasBoundingBox()) {
+      continue;
+    }
+    // world bounding box of transformed model bounding box
+    glm::vec3 center = 0.5f * (item.geometry->getBoundingBoxMax() + item.geometry->getBoundingBoxMin());
+    glm::vec3 extent = 0.5f * (item.geometry->getBoundingBoxMax() - item.geometry->getBoundingBoxMin());
+    glm::vec3 worldCenter(item.modelMatrix * glm::vec4(center, 1.f));
+    glm::vec3 worldExtent = glm::abs(glm::vec3(item.modelMatrix[0])) * extent.x
+        + glm::abs(glm::vec3(item.modelMatrix[1])) * extent.y
+        + glm::abs(glm::vec3(item.modelMatrix[2])) * extent.z;
+    Caster caster = { item.geometry.get(), item.modelMatrix,
+        worldCenter - worldExtent, worldCenter + worldExtent };
+    casters.push_back(caster);
+  }
+}
+
+
+void ShadowMap::updateCascades_(RenderState* renderState) {
+  const glm::mat4& modelTransform = light_->getModelTransform();
+  glm::vec4 position = modelTransform * light_->getPosition();
+  isDirectional_ = (light_->getPosition().w < 0.001f);
+
+  if (!isDirectional_) {
+    // spot light: single perspective shadow map covering the spot cone
+    if (light_->getSpotCosCutoff() < 0.001f) {
+      throw std::runtime_error("Point lights without spot are not supported [ShadowMap::update()]");
+    }
+    nActiveCascades_ = 1;
+    glm::vec3 eye = glm::vec3(position) / position.w;
+    glm::vec3 direction = glm::normalize(glm::vec3(modelTransform * light_->getSpotDirection()));
+    glm::vec3 up = (std::fabs(direction.y) > 0.99f) ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f);
+    float fovy = std::min(2.f * std::acos(light_->getSpotCosCutoff()) + glm::radians(2.f),
+        glm::radians(178.f));
+    glm::mat4 viewProjection = glm::perspective(fovy, 1.f, spotNear_, spotFar_)
+        * glm::lookAt(eye, eye + direction, up);
+    Cascade& cascade = cascades_[0];
+    cascade.end = std::numeric_limits<float>::max();
+    if (viewProjection != cascade.viewProjection) {
+      cascade.viewProjection = viewProjection;
+      cascade.isStaticValid = false;
+    }
+    return;
+  }
+
+  // directional light: rotation into light coordinates, with z axis towards light
+  glm::vec3 direction = glm::normalize(glm::vec3(position));
+  bool isRotated = (direction != lightDirection_);
+  lightDirection_ = direction;
+  glm::vec3 up = (std::fabs(direction.y) > 0.99f) ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f);
+  glm::mat4 rotation = glm::lookAt(glm::vec3(0.f), -direction, up);
+  glm::mat4 eyeToLight = rotation * glm::inverse(renderState->getViewTransform());
+
+  // depth range of camera projection, limited by shadow distance
+  const glm::mat4& projection = renderState->getProjection();
+  bool isPerspective = std::fabs(projection[3][3]) < 1e-6f;
+  float near, far;
+  if (isPerspective) {
+    near = projection[3][2] / (projection[2][2] - 1.f);
+    far = projection[3][2] / (projection[2][2] + 1.f);
+    if (!(far > near)) {    // infinite far plane
+      far = std::numeric_limits<float>::max();
+    }
+  }
+  else {
+    near = (projection[3][2] + 1.f) / projection[2][2];
+    far = (projection[3][2] - 1.f) / projection[2][2];
+  }
+  far = std::max(std::min(far, shadowDistance_), near + 1e-3f);
+
+  // corners of near plane in eye coordinates
+  glm::mat4 invProjection = glm::inverse(projection);
+  glm::vec3 nearCorners[4];
+  for (int k = 0; k < 4; ++k) {
+    glm::vec4 corner = invProjection * glm::vec4((k & 1) ? 1.f : -1.f, (k & 2) ? 1.f : -1.f, -1.f, 1.f);
+    nearCorners[k] = glm::vec3(corner) / corner.w;
+  }
+
+  nActiveCascades_ = nCascades_;
+  float splitNear = near;
+  for (int i = 0; i < nActiveCascades_; ++i) {
+    // split depth, weighted mean of logarithmic and uniform split
+    float t = static_cast<float>(i + 1) / nActiveCascades_;
+    float splitFar = (i == nActiveCascades_ - 1) ? far
+        : splitLambda_ * near * std::pow(far / near, t) + (1.f - splitLambda_) * (near + (far - near) * t);
+
+    // bounding sphere of frustum slice, radius only depends on projection
+    glm::vec3 corners[8];
+    for (int k = 0; k < 4; ++k) {
+      if (isPerspective) {
+        corners[k] = nearCorners[k] * (splitNear / near);
+        corners[k + 4] = nearCorners[k] * (splitFar / near);
+      }
+      else {
+        corners[k] = glm::vec3(nearCorners[k].x, nearCorners[k].y, -splitNear);
+        corners[k + 4] = glm::vec3(nearCorners[k].x, nearCorners[k].y, -splitFar);
+      }
+    }
+    glm::vec3 center(0.f);
+    for (int k = 0; k < 8; ++k) {
+      center += corners[k];
+    }
+    center *= 0.125f;
+    float radius = 0.f;
+    for (int k = 0; k < 8; ++k) {
+      radius = std::max(radius, glm::length(corners[k] - center));
+    }
+
+    // re-center cascade if the slice leaves the covered region,
+    // snap center to texels to avoid shimmering edges
+    Cascade& cascade = cascades_[i];
+    float size = radius * (1.f + cascadeMargin_);
+    glm::vec3 lightCenter(eyeToLight * glm::vec4(center, 1.f));
+    glm::vec3 offset = glm::abs(lightCenter - cascade.center);
+    if (isRotated || size != cascade.radius
+        || std::max(std::max(offset.x, offset.y), offset.z) + radius > size) {
+      float texelSize = 2.f * size / resolution_;
+      cascade.center = glm::vec3(std::floor(lightCenter.x / texelSize + 0.5f) * texelSize,
+          std::floor(lightCenter.y / texelSize + 0.5f) * texelSize, lightCenter.z);
+      cascade.radius = size;
+    }
+    cascade.end = splitFar;
+
+    // orthographic projection of cascade region, invalidate cached depth if changed
+    glm::mat4 viewProjection = glm::ortho(-size, size, -size, size, 0.f, 2.f * size)
+        * glm::translate(glm::mat4(1.f), -(cascade.center + glm::vec3(0.f, 0.f, size))) * rotation;
+    if (viewProjection != cascade.viewProjection) {
+      cascade.viewProjection = viewProjection;
+      cascade.isStaticValid = false;
+    }
+    splitNear = splitFar;
+  }
+}
+
+
+bool ShadowMap::isInFrustum_(const Caster& caster, const glm::mat4& viewProjection) const {
+  // count bounding box corners outside of each clip plane
+  int nOutside[6] = { 0, 0, 0, 0, 0, 0 };
+  for (int k = 0; k < 8; ++k) {
+    glm::vec4 corner((k & 1) ? caster.boundsMax.x : caster.boundsMin.x,
+        (k & 2) ? caster.boundsMax.y : caster.boundsMin.y,
+        (k & 4) ? caster.boundsMax.z : caster.boundsMin.z, 1.f);
+    glm::vec4 clip = viewProjection * corner;
+    nOutside[0] += (clip.x < -clip.w);
+    nOutside[1] += (clip.x > clip.w);
+    nOutside[2] += (clip.y < -clip.w);
+    nOutside[3] += (clip.y > clip.w);
+    nOutside[4] += (clip.z > clip.w);
+    nOutside[5] += (!isDirectional_ && clip.z < -clip.w);
+  }
+  for (int j = 0; j < 6; ++j) {
+    if (nOutside[j] == 8) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+int ShadowMap::renderCasters_(RenderState* renderState, const std::vector<Caster>& casters,
+    const glm::mat4& viewProjection) {
+  int nDraws = 0;
+  renderState->projectionStack.setMatrix(viewProjection);
+  for (auto& caster : casters) {
+    if (!isInFrustum_(caster, viewProjection)) {
+      ++nCulledDraws_;
+      ++renderState->stats.nShapesCulled;
+      continue;
+    }
+    renderState->modelViewStack.setMatrix(caster.modelMatrix);
+    caster.geometry->render(renderState);
+    ++nDraws;
+  }
+  return nDraws;
+}
+
+
+void ShadowMap::createBuffers_() {
+  texResolution_ = resolution_;
+  texLayers_ = nActiveCascades_;
+
+  // depth array textures, one layer per cascade, shadow map with depth comparison
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::SHADOW_MAP.texUnit);
+  GLint texOld;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &texOld);
+  GLuint* textures[2] = { &shadowTex_, &staticTex_ };
+  for (int i = 0; i < 2; ++i) {
+    glGenTextures(1, textures[i]);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, *textures[i]);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, texResolution_, texResolution_,
+        texLayers_, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    GLint filter = (i == 0) ? GL_LINEAR : GL_NEAREST;
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (i == 0) {
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    }
+  }
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texOld);
+  glActiveTexture(GL_TEXTURE0);
+
+  // depth-only framebuffers for rendering and copying layers
+  GLint drawFboOld, readFboOld;
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFboOld);
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFboOld);
+  glGenFramebuffers(2, fbo_);
+  for (int i = 0; i < 2; ++i) {
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_[i]);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+  }
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFboOld);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, readFboOld);
+
+  glGenBuffers(1, &ubo_);
+  for (auto& cascade : cascades_) {
+    cascade.isStaticValid = false;
+    cascade.hasDynamic = false;
+  }
+
+  assert(!checkGLError());
+}
+
+
+void ShadowMap::clearBuffers_() {
+  glDeleteTextures(1, &shadowTex_);
+  glDeleteTextures(1, &staticTex_);
+  glDeleteFramebuffers(2, fbo_);
+  glDeleteBuffers(1, &ubo_);
+  shadowTex_ = staticTex_ = 0;
+  fbo_[0] = fbo_[1] = 0;
+  ubo_ = 0;
+}
+
+
+} /* namespace scg */
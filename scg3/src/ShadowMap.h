@@ -0,0 +1,355 @@
+/**
+ * \file ShadowMap.h
+ * \brief A shadow map of a directional or spot light, applied to all nodes of its
+ *    sub-tree (composite node).
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHADOWMAP_H_
+#define SHADOWMAP_H_
+
+#include <vector>
+#include "Composite.h"
+#include "scg_glew_glad.h"
+#include "scg_glm.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A shadow map of a directional or spot light, applied to all nodes of its
+ *    sub-tree (composite node).
+ *
+ * The shadow casters are given as static and dynamic caster nodes, whose
+ * sub-trees are rendered into the depth textures by a depth-only shader
+ * (e.g., shadow_depth_vert.glsl, shadow_depth_frag.glsl). The caster nodes
+ * belong to the sub-tree of the shadow map node, i.e., they are rendered
+ * before its children and receive shadows as well.
+ *
+ * Directional lights use up to MAX_CASCADES cascades that split the view frustum
+ * up to the shadow distance, spot lights use a single perspective shadow map.
+ * Each cascade covers the bounding sphere of its frustum slice, enlarged by a margin,
+ * and is only re-centered when the slice leaves the covered region.
+ * The depth of the static casters is cached per cascade and only re-rendered
+ * if the light matrix of the cascade changes (light movement, cascade re-centering,
+ * projection changes) or the static casters move (changed model matrices)
+ * or invalidate() is called. For each frame, the cached depth is copied and the
+ * dynamic casters are rendered on top. Casters outside of a cascade are culled
+ * by their bounding boxes (cf. GeometryCore::getBoundingBoxMin()).
+ *
+ * The light matrices are stored in the uniform block OGLConstants::SHADOW,
+ * the depth textures in the array texture OGLConstants::SHADOW_MAP (one layer
+ * per cascade). A shadow-aware fragment shader such as blinn_phong_lighting.glsl
+ * with define SHADOW = 1 then attenuates the diffuse and specular contributions
+ * of the shadowed light. The light has to be applied to the sub-tree by a Light node,
+ * its position and direction are taken from the last pre-traversal.
+ * Note: Shapes inside of StaticBatch nodes do not cast shadows.
+ */
+class ShadowMap: public Composite {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  ShadowMap();
+
+  /**
+   * Destructor.
+   */
+  virtual ~ShadowMap();
+
+  /**
+   * Create shared pointer.
+   */
+  static ShadowMapSP create();
+
+  /**
+   * Set shadowed light (directional light or spotlight).
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setLight(LightSP light);
+
+  /**
+   * Get shadowed light.
+   */
+  LightSP getLight() const;
+
+  /**
+   * Set depth-only shader used to render the shadow casters.
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setDepthShader(ShaderCoreSP depthShader);
+
+  /**
+   * Add static shadow caster, whose depth is cached.
+   * \return this pointer for method chaining
+   */
+  ShadowMap* addStaticCaster(NodeSP node);
+
+  /**
+   * Add dynamic shadow caster, which is rendered for each frame.
+   * \return this pointer for method chaining
+   */
+  ShadowMap* addDynamicCaster(NodeSP node);
+
+  /**
+   * Remove all static and dynamic shadow casters.
+   * \return this pointer for method chaining
+   */
+  ShadowMap* clearCasters();
+
+  /**
+   * Set width and height of shadow map in texels.
+   *
+   * Default: 1024
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setResolution(GLsizei resolution);
+
+  /**
+   * Set number of cascades of directional lights (1 to MAX_CASCADES).
+   *
+   * Default: 4
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setNCascades(int nCascades);
+
+  /**
+   * Set maximum distance from camera covered by cascades of directional lights.
+   *
+   * Default: 50
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setShadowDistance(float distance);
+
+  /**
+   * Set weight of logarithmic vs. uniform cascade splits (0 to 1).
+   *
+   * Default: 0.75
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setSplitLambda(float lambda);
+
+  /**
+   * Set relative margin of cascades around their frustum slices, larger margins
+   * require less re-rendering of static casters when the camera moves.
+   *
+   * Default: 0.25
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setCascadeMargin(float margin);
+
+  /**
+   * Set near and far plane distances of spot light shadow map.
+   *
+   * Default: 0.1, 100
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setSpotRange(float near, float far);
+
+  /**
+   * Set polygon offset factor and units applied when rendering the casters.
+   *
+   * Default: 2, 4
+   *
+   * \return this pointer for method chaining
+   */
+  ShadowMap* setDepthBias(float factor, float units);
+
+  /**
+   * Invalidate cached depth of static casters, e.g., after changing their geometry.
+   */
+  void invalidate();
+
+  /**
+   * Get number of cascades used by the last update.
+   */
+  int getNActiveCascades() const;
+
+  /**
+   * Get number of cascades whose static casters have been re-rendered by the last update.
+   */
+  int getNStaticUpdates() const;
+
+  /**
+   * Get number of static caster draw calls of the last update.
+   */
+  int getNStaticDraws() const;
+
+  /**
+   * Get number of dynamic caster draw calls of the last update.
+   */
+  int getNDynamicDraws() const;
+
+  /**
+   * Get number of caster draw calls culled by the last update.
+   */
+  int getNCulledDraws() const;
+
+  /**
+   * Get CPU time of the last update in milliseconds.
+   */
+  double getUpdateTime() const;
+
+  /**
+   * Update cascades and render shadow casters, to be called with active OpenGL
+   * context. Called by render().
+   */
+  void update(RenderState* renderState);
+
+  /**
+   * Traverse static casters, dynamic casters, and children (depth-first, pre-order)
+   * with given traverser.
+   */
+  virtual void traverse(Traverser* traverser);
+
+  /**
+   * Accept traverser.
+   */
+  virtual void accept(Traverser* traverser);
+
+  /**
+   * Accept traverser after traversing sub-tree.
+   */
+  virtual void acceptPost(Traverser* traverser);
+
+  /**
+   * Render shadow map, i.e., update shadow map and bind uniform block and texture.
+   */
+  virtual void render(RenderState* renderState);
+
+  /**
+   * Render shadow map after traversing sub-tree, i.e., restore previous bindings.
+   */
+  virtual void renderPost(RenderState* renderState);
+
+public:
+
+  // maximum number of cascades
+  static const int MAX_CASCADES = 4;
+
+  // size of uniform block in bytes
+  static const int BLOCK_SIZE = 288;
+
+protected:
+
+  /**
+   * Geometry core to be rendered into the shadow map, with world bounding box.
+   */
+  struct Caster {
+    GeometryCore* geometry;
+    glm::mat4 modelMatrix;
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
+  };
+
+  /**
+   * Cascade with light matrix and cached static depth.
+   */
+  struct Cascade {
+    glm::mat4 viewProjection;
+    glm::vec3 center;         // in light coordinates (directional light)
+    float radius;
+    float end;                // far depth of frustum slice
+    bool isStaticValid;
+    bool hasDynamic;          // dynamic casters rendered by last update
+  };
+
+  /**
+   * Collect casters of sub-tree, with model transformations relative to baseTransform.
+   */
+  void collectCasters_(RenderState* renderState, GroupSP root,
+      const glm::mat4& baseTransform, std::vector<Caster>& casters);
+
+  /**
+   * Update light matrices of cascades, invalidate static depth of changed cascades.
+   */
+  void updateCascades_(RenderState* renderState);
+
+  /**
+   * Check if caster bounding box intersects the light frustum (near plane ignored
+   * for directional lights, whose casters are clamped to the near plane).
+   */
+  bool isInFrustum_(const Caster& caster, const glm::mat4& viewProjection) const;
+
+  /**
+   * Render casters into currently bound framebuffer, return number of draw calls.
+   */
+  int renderCasters_(RenderState* renderState, const std::vector<Caster>& casters,
+      const glm::mat4& viewProjection);
+
+  /**
+   * Create depth textures, framebuffers, and uniform buffer object.
+   */
+  void createBuffers_();
+
+  /**
+   * Delete OpenGL objects.
+   */
+  void clearBuffers_();
+
+protected:
+
+  LightSP light_;
+  ShaderCoreSP depthShader_;
+  GroupSP staticRoot_;
+  GroupSP dynamicRoot_;
+  std::vector<Caster> staticCasters_;
+  std::vector<Caster> dynamicCasters_;
+  GLsizei resolution_;
+  int nCascades_;
+  int nActiveCascades_;
+  float shadowDistance_;
+  float splitLambda_;
+  float cascadeMargin_;
+  float spotNear_, spotFar_;
+  float biasFactor_, biasUnits_;
+  bool isDirectional_;
+  glm::vec3 lightDirection_;    // direction towards light (directional light)
+  Cascade cascades_[MAX_CASCADES];
+  GLuint shadowTex_;            // sampled depth, static and dynamic casters
+  GLuint staticTex_;            // cached depth of static casters
+  GLuint fbo_[2];               // draw, read
+  GLuint ubo_;
+  GLsizei texResolution_;
+  int texLayers_;
+  GLint uboOld_;
+  GLint texOld_;
+  int nStaticUpdates_;
+  int nStaticDraws_;
+  int nDynamicDraws_;
+  int nCulledDraws_;
+  double updateTime_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* SHADOWMAP_H_ */
@@ -23,12 +23,15 @@
 
 #include <sstream>
 #include "Camera.h"
+#include "FrameProfiler.h"
+#include "GLDebug.h"
 #include "Node.h"
 #include "InfoTraverser.h"
 #include "PreTraverser.h"
 #include "RenderState.h"
 #include "RenderTraverser.h"
 #include "StandardRenderer.h"
+#include "Tracer.h"
 #include "Viewer.h"
 
 namespace scg {
@@ -59,12 +62,21 @@ void StandardRenderer::initViewer(Viewer *viewer, FrameBufferSize *fbSize) {
 
 std::string StandardRenderer::getInfo() {
   assert(scene_);
+  SCG_TRACE_SCOPE("info traversal");
   scene_->traverse(infoTraverser_.get());
   std::stringstream stream;
   stream << "No. of nodes: " << infoTraverser_->getNNodes() << std::endl
       << "No. of core pointers: " << infoTraverser_->getNCores() << std::endl
-      << "No. of triangles (approx.): " << infoTraverser_->getNTriangles() << std::endl
-      << std::ends;
+      << "No. of triangles (approx.): " << infoTraverser_->getNTriangles() << std::endl;
+  if (!renderStatsHistory_.empty()) {
+    // statistics of rendered frames
+    stream << "Draw calls (last frame): " << renderStats_.nDrawCalls << std::endl
+        << "Triangles submitted (last frame): " << renderStats_.nTriangles << std::endl
+        << "Program switches, texture binds, buffer binds (last frame): "
+        << renderStats_.nProgramSwitches << ", " << renderStats_.nTextureBinds << ", "
+        << renderStats_.nBufferBinds << std::endl;
+  }
+  stream << std::ends;
   return stream.str();
 }
 
@@ -84,14 +96,28 @@ void StandardRenderer::render() {
   renderState_->modelViewStack.pushMatrix();
   renderState_->modelViewStack.setIdentity();
 
-  // pass 1: save camera projection and view transformation
-  scene_->traverse(preTraverser_.get());
+  // pass 1: save camera projection and view transformation, collect lights
+  {
+    FrameProfiler::Scope scope(frameProfiler_, FrameProfiler::PRE_PASS);
+    SCG_TRACE_SCOPE("pre-pass traversal");
+    SCG_GL_DEBUG_GROUP("pre-pass traversal");
+    scene_->traverse(preTraverser_.get());
+
+    // upload lights of all scopes at once (once per eye in stereo rendering,
+    // as the lights are transformed into the eye coordinates of each view)
+    renderState_->uploadLights();
+  }
 
   // apply projection and view transformation as determined in previous frame
   renderState_->applyProjectionViewTransform();
 
   // pass 2: render scene
-  scene_->traverse(renderTraverser_.get());
+  {
+    FrameProfiler::Scope scope(frameProfiler_, FrameProfiler::RENDER_PASS);
+    SCG_TRACE_SCOPE("render traversal");
+    SCG_GL_DEBUG_GROUP("render traversal");
+    scene_->traverse(renderTraverser_.get());
+  }
 
   // restore projection and modelview matrices
   renderState_->modelViewStack.popMatrix();
@@ -99,4 +125,10 @@ void StandardRenderer::render() {
 }
 
 
+void StandardRenderer::setFrameProfiler(FrameProfiler* frameProfiler) {
+  frameProfiler_ = frameProfiler;
+  renderTraverser_->setFrameProfiler(frameProfiler);
+}
+
+
 } /* namespace scg */
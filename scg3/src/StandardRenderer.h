@@ -37,7 +37,7 @@ namespace scg {
  *    InfoTraverser.
  *
  * The stencil buffer is activated for later use in projection shadows and planar
- * reflections.
+ * reflections. Shadow maps are rendered by ShadowMap nodes during the render traversal.
  */
 class StandardRenderer: public Renderer {
 
@@ -78,6 +78,11 @@ public:
    */
   virtual void render();
 
+  /**
+   * Set frame profiler to time render passes and tagged sub-trees, may be null (default).
+   */
+  virtual void setFrameProfiler(FrameProfiler* frameProfiler);
+
 protected:
 
   InfoTraverserUP infoTraverser_;
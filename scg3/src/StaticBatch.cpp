@@ -0,0 +1,409 @@
+/**
+ * \file StaticBatch.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include "BatchTraverser.h"
+#include "GeometryCore.h"
+#include "Group.h"
+#include "MaterialCore.h"
+#include "MaterialTable.h"
+#include "RenderState.h"
+#include "StaticBatch.h"
+#include "Tracer.h"
+#include "TextureCore.h"
+#include "Traverser.h"
+#include "scg_glm.h"
+#include "scg_utilities.h"
+
+namespace scg {
+
+
+StaticBatch::StaticBatch()
+    : root_(Group::create()), vboDrawIndex_(0), tboDrawData_(0), texDrawData_(0),
+      isBuilt_(false), isMultiDrawIndirect_(true) {
+}
+
+
+StaticBatch::~StaticBatch() {
+  if (isGLContextActive()) {
+    clearBatches_();
+  }
+}
+
+
+StaticBatchSP StaticBatch::create() {
+  return std::make_shared<StaticBatch>();
+}
+
+
+StaticBatch* StaticBatch::addCore(CoreSP core) {
+  if (std::dynamic_pointer_cast<GeometryCore>(core)) {
+    throw std::runtime_error("GeometryCore cannot be added to StaticBatch [StaticBatch::addCore()]");
+  }
+  cores_.push_back(core);
+  return this;
+}
+
+
+StaticBatch* StaticBatch::addNode(NodeSP node) {
+  root_->addChild(node);
+  isBuilt_ = false;
+  return this;
+}
+
+
+StaticBatch* StaticBatch::setMultiDrawIndirect(bool isEnabled) {
+  // indirect buffers are only created by build() if enabled
+  if (isEnabled != isMultiDrawIndirect_) {
+    isMultiDrawIndirect_ = isEnabled;
+    isBuilt_ = false;
+  }
+  return this;
+}
+
+
+bool StaticBatch::isMultiDrawIndirect() const {
+  return isMultiDrawIndirect_ && SCG_GL_EXTENSION_SUPPORTED(ARB_multi_draw_indirect)
+      && SCG_GL_EXTENSION_SUPPORTED(ARB_base_instance);
+}
+
+
+void StaticBatch::invalidate() {
+  isBuilt_ = false;
+}
+
+
+void StaticBatch::build(RenderState* renderState) {
+  SCG_TRACE_SCOPE("static batch build");
+  clearBatches_();
+
+  // collect geometry cores with inherited material, texture, and model matrix
+  BatchTraverser batchTraverser(renderState);
+  renderState->modelViewStack.pushMatrix(glm::mat4(1.0f));
+  root_->traverse(&batchTraverser);
+  renderState->modelViewStack.popMatrix();
+  const std::vector<BatchItem>& items = batchTraverser.getItems();
+
+  // find material table added as core or inherited from render state
+  MaterialTable* materialTable = renderState->getMaterialTable();
+  for (auto& core : cores_) {
+    if (auto table = std::dynamic_pointer_cast<MaterialTable>(core)) {
+      materialTable = table.get();
+    }
+  }
+
+  // group items by material (unless indexed by material table), texture,
+  // primitive type, and attribute layout
+  typedef std::tuple<MaterialCore*, TextureCore*, GLenum, std::vector<GLint>> BatchKey;
+  std::map<BatchKey, std::vector<const BatchItem*>> groups;
+  std::vector<BatchKey> keys;
+  for (auto& item : items) {
+    std::vector<GLint> layout;
+    for (auto& attribute : item.geometry->getVertexAttributes()) {
+      layout.push_back(static_cast<GLint>(attribute.location));
+      layout.push_back(attribute.dim);
+    }
+    BatchKey key(materialTable ? nullptr : item.material.get(), item.texture.get(),
+        item.geometry->getPrimitiveType(), layout);
+    auto& group = groups[key];
+    if (group.empty()) {
+      keys.push_back(key);
+    }
+    group.push_back(&item);
+  }
+
+  GLint maxTexels = 0;
+  glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+  if (static_cast<GLint>(items.size()) * DRAW_DATA_TEXELS > maxTexels) {
+    throw std::runtime_error("Too many draw commands for buffer texture [StaticBatch::build()]");
+  }
+
+  // merge geometry of each group, keeping the order of first occurrence
+  std::vector<glm::vec4> drawData;
+  drawData.reserve(items.size() * DRAW_DATA_TEXELS);
+  GLuint drawIndex = 0;
+  for (auto& key : keys) {
+    const std::vector<const BatchItem*>& group = groups[key];
+    const std::vector<VertexAttribute>& attributes = group.front()->geometry->getVertexAttributes();
+    std::vector<std::vector<GLfloat>> vertexData(attributes.size());
+    std::vector<GLuint> indexData;
+    Batch batch;
+    batch.material = materialTable ? nullptr : group.front()->material;
+    batch.texture = group.front()->texture;
+    batch.primitiveType = std::get<2>(key);
+    GLint nVertices = 0;
+    for (auto item : group) {
+      // append vertex attributes
+      GLint nItemVertices = 0;
+      std::vector<GLfloat> data;
+      for (size_t i = 0; i < attributes.size(); ++i) {
+        item->geometry->readAttributeData(item->geometry->getVertexAttributes()[i], data);
+        vertexData[i].insert(vertexData[i].end(), data.begin(), data.end());
+        if (i == 0) {
+          nItemVertices = static_cast<GLint>(data.size()) / attributes[i].dim;
+        }
+      }
+
+      // append element indices, create sequential indices for DrawMode::ARRAYS
+      DrawCommand command;
+      command.count = item->geometry->getNElements();
+      command.instanceCount = 1;
+      command.firstIndex = static_cast<GLuint>(indexData.size());
+      command.baseVertex = nVertices;
+      command.baseInstance = drawIndex++;
+      if (item->geometry->getDrawMode() == DrawMode::ELEMENTS) {
+        std::vector<GLuint> indices;
+        item->geometry->readElementIndexData(indices);
+        indexData.insert(indexData.end(), indices.begin(), indices.begin() + command.count);
+      }
+      else {
+        for (GLuint i = 0; i < command.count; ++i) {
+          indexData.push_back(i);
+        }
+      }
+      batch.commands.push_back(command);
+      nVertices += nItemVertices;
+
+      // append model matrix, normal matrix, and texture matrix (std140-like columns)
+      glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(item->modelMatrix)));
+      for (int i = 0; i < 4; ++i) {
+        drawData.push_back(item->modelMatrix[i]);
+      }
+      for (int i = 0; i < 3; ++i) {
+        drawData.push_back(glm::vec4(normalMatrix[i], 0.0f));
+      }
+      // material index, -1 for inherited material
+      GLint materialIndex = -1;
+      if (materialTable && item->material) {
+        materialIndex = materialTable->addMaterial(item->material);
+      }
+      drawData.push_back(glm::vec4(static_cast<GLfloat>(materialIndex), 0.0f, 0.0f, 0.0f));
+      for (int i = 0; i < 4; ++i) {
+        drawData.push_back(item->textureMatrix[i]);
+      }
+    }
+
+    // create VAO and VBOs of merged geometry
+    glGenVertexArrays(1, &batch.vao);
+    glBindVertexArray(batch.vao);
+    for (size_t i = 0; i < attributes.size(); ++i) {
+      GLuint vbo = 0;
+      glGenBuffers(1, &vbo);
+      glBindBuffer(GL_ARRAY_BUFFER, vbo);
+      glBufferData(GL_ARRAY_BUFFER, vertexData[i].size() * sizeof(GLfloat),
+          vertexData[i].data(), GL_STATIC_DRAW);
+      glVertexAttribPointer(attributes[i].location, attributes[i].dim, GL_FLOAT, GL_FALSE, 0,
+          static_cast<const GLvoid*>(0));
+      glEnableVertexAttribArray(attributes[i].location);
+      batch.vboAttributes.push_back(vbo);
+    }
+    glGenBuffers(1, &batch.vboIndex);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vboIndex);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size() * sizeof(GLuint),
+        indexData.data(), GL_STATIC_DRAW);
+    // Note: GL_ELEMENT_ARRAY_BUFFER has to be kept bound
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // create indirect buffer
+    batch.indirectBuffer = 0;
+    if (isMultiDrawIndirect()) {
+      glGenBuffers(1, &batch.indirectBuffer);
+      glBindBuffer(GL_DRAW_INDIRECT_BUFFER, batch.indirectBuffer);
+      glBufferData(GL_DRAW_INDIRECT_BUFFER, batch.commands.size() * sizeof(DrawCommand),
+          batch.commands.data(), GL_STATIC_DRAW);
+      glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    batches_.push_back(batch);
+  }
+
+  // create instanced draw index attribute, shared by all batches
+  std::vector<GLuint> drawIndices(items.size());
+  for (GLuint i = 0; i < drawIndices.size(); ++i) {
+    drawIndices[i] = i;
+  }
+  glGenBuffers(1, &vboDrawIndex_);
+  glBindBuffer(GL_ARRAY_BUFFER, vboDrawIndex_);
+  glBufferData(GL_ARRAY_BUFFER, drawIndices.size() * sizeof(GLuint),
+      drawIndices.data(), GL_STATIC_DRAW);
+  for (auto& batch : batches_) {
+    glBindVertexArray(batch.vao);
+    glVertexAttribIPointer(OGLConstants::DRAW_INDEX.location, 1, GL_UNSIGNED_INT, 0,
+        static_cast<const GLvoid*>(0));
+    glVertexAttribDivisor(OGLConstants::DRAW_INDEX.location, 1);
+    glEnableVertexAttribArray(OGLConstants::DRAW_INDEX.location);
+  }
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  // create buffer texture containing model and normal matrices
+  glGenBuffers(1, &tboDrawData_);
+  glBindBuffer(GL_TEXTURE_BUFFER, tboDrawData_);
+  glBufferData(GL_TEXTURE_BUFFER, drawData.size() * sizeof(glm::vec4),
+      drawData.data(), GL_STATIC_DRAW);
+  glBindBuffer(GL_TEXTURE_BUFFER, 0);
+  glGenTextures(1, &texDrawData_);
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DRAW_DATA.texUnit);
+  GLint texOld = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld);
+  glBindTexture(GL_TEXTURE_BUFFER, texDrawData_);
+  glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, tboDrawData_);
+  glBindTexture(GL_TEXTURE_BUFFER, texOld);
+  glActiveTexture(GL_TEXTURE0);
+
+  // upload materials added to material table
+  if (materialTable) {
+    materialTable->update();
+  }
+
+  isBuilt_ = true;
+
+  assert(!checkGLError());
+}
+
+
+int StaticBatch::getNBatches() const {
+  return static_cast<int>(batches_.size());
+}
+
+
+int StaticBatch::getNDrawCommands() const {
+  int result = 0;
+  for (auto& batch : batches_) {
+    result += static_cast<int>(batch.commands.size());
+  }
+  return result;
+}
+
+
+void StaticBatch::traverseNodes(Traverser* traverser) {
+  root_->traverse(traverser);
+}
+
+
+void StaticBatch::accept(Traverser* traverser) {
+  traverser->visitStaticBatch(this);
+}
+
+
+void StaticBatch::render(RenderState* renderState) {
+  if (!isBuilt_) {
+    build(renderState);
+  }
+
+  // apply shader etc.
+  processCores_(renderState);
+
+  // bind buffer texture containing model and normal matrices
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DRAW_DATA.texUnit);
+  GLint texOld = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &texOld);
+  glBindTexture(GL_TEXTURE_BUFFER, texDrawData_);
+  glActiveTexture(GL_TEXTURE0);
+  ++renderState->stats.nTextureBinds;
+
+  bool useMultiDrawIndirect = isMultiDrawIndirect();
+  for (auto& batch : batches_) {
+    if (batch.material) {
+      batch.material->render(renderState);
+    }
+    // texture matrix of batch texture is already part of per-draw texture matrices
+    glm::mat4 textureMatrix = renderState->textureStack.getMatrix();
+    if (batch.texture) {
+      batch.texture->render(renderState);
+      renderState->textureStack.setMatrix(textureMatrix);
+    }
+    renderState->passToShader();
+    drawBatch_(batch, useMultiDrawIndirect);
+    renderState->stats.nDrawCalls += useMultiDrawIndirect ? 1 : static_cast<int>(batch.commands.size());
+    for (auto& command : batch.commands) {
+      renderState->stats.addPrimitives(batch.primitiveType, command.count);
+    }
+    if (batch.texture) {
+      batch.texture->renderPost(renderState);
+    }
+    if (batch.material) {
+      batch.material->renderPost(renderState);
+    }
+  }
+
+  // restore buffer texture binding
+  glActiveTexture(GL_TEXTURE0 + OGLConstants::DRAW_DATA.texUnit);
+  glBindTexture(GL_TEXTURE_BUFFER, texOld);
+  glActiveTexture(GL_TEXTURE0);
+
+  // restore render state (shader, material, texture, etc.)
+  postProcessCores_(renderState);
+
+  assert(!checkGLError());
+}
+
+
+void StaticBatch::clearBatches_() {
+  for (auto& batch : batches_) {
+    for (auto vbo : batch.vboAttributes) {
+      glDeleteBuffers(1, &vbo);
+    }
+    glDeleteBuffers(1, &batch.vboIndex);
+    glDeleteBuffers(1, &batch.indirectBuffer);
+    glDeleteVertexArrays(1, &batch.vao);
+  }
+  batches_.clear();
+  glDeleteBuffers(1, &vboDrawIndex_);
+  glDeleteBuffers(1, &tboDrawData_);
+  glDeleteTextures(1, &texDrawData_);
+  vboDrawIndex_ = tboDrawData_ = texDrawData_ = 0;
+  isBuilt_ = false;
+}
+
+
+void StaticBatch::drawBatch_(const Batch& batch, bool useMultiDrawIndirect) {
+  glBindVertexArray(batch.vao);
+  if (useMultiDrawIndirect) {
+    // submit all draw commands at once, base instance selects draw index
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, batch.indirectBuffer);
+    glMultiDrawElementsIndirect(batch.primitiveType, GL_UNSIGNED_INT, static_cast<const GLvoid*>(0),
+        static_cast<GLsizei>(batch.commands.size()), 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  }
+  else {
+    // submit draw commands one by one, offset draw index attribute instead of base instance
+    glBindBuffer(GL_ARRAY_BUFFER, vboDrawIndex_);
+    for (auto& command : batch.commands) {
+      glVertexAttribIPointer(OGLConstants::DRAW_INDEX.location, 1, GL_UNSIGNED_INT, 0,
+          reinterpret_cast<const GLvoid*>(command.baseInstance * sizeof(GLuint)));
+      glDrawElementsBaseVertex(batch.primitiveType, command.count, GL_UNSIGNED_INT,
+          reinterpret_cast<const GLvoid*>(command.firstIndex * sizeof(GLuint)), command.baseVertex);
+    }
+    glVertexAttribIPointer(OGLConstants::DRAW_INDEX.location, 1, GL_UNSIGNED_INT, 0,
+        static_cast<const GLvoid*>(0));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+  glBindVertexArray(0);
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,214 @@
+/**
+ * \file StaticBatch.h
+ * \brief A node that merges static sub-trees into few multi-draw batches (leaf node).
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STATICBATCH_H_
+#define STATICBATCH_H_
+
+#include <vector>
+#include "scg_glew_glad.h"
+#include "Leaf.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A node that merges static sub-trees into few multi-draw batches (leaf node).
+ *
+ * The geometry cores of the added sub-trees are merged into one set of VBOs per
+ * combination of material, texture, primitive type, and vertex attribute layout.
+ * Each shape becomes one draw command of its batch, such that a batch is submitted
+ * by a single glMultiDrawElementsIndirect() call if ARB_multi_draw_indirect and
+ * ARB_base_instance are supported (OpenGL 4.3). Otherwise, one
+ * glDrawElementsBaseVertex() call per draw command is issued (OpenGL 3.3).
+ *
+ * The model, normal, and texture matrices of all draw commands are stored in a buffer texture
+ * that is bound to sampler OGLConstants::DRAW_DATA and indexed by the instanced
+ * attribute OGLConstants::DRAW_INDEX, selected by the base instance of each
+ * draw command. Thus, a batch-aware shader such as phong_batch_vert.glsl
+ * has to be added to this node.
+ *
+ * Shapes with different materials end up in different batches, unless a MaterialTable
+ * is added to this node or inherited from the scene graph. In this case,
+ * the materials are added to the table and their indices are stored per draw command,
+ * such that a shader variant with MATERIAL_TABLE defined to 1 is required.
+ *
+ * Shapes with different textures end up in different batches. To merge textured shapes,
+ * the textures can be packed into an array texture by TextureArrayBuilder, which is
+ * added to this node, while the shapes only refer to their TextureLayerCore.
+ *
+ * The batches are built on first rendering (or by calling build()) and
+ * have to be rebuilt by calling invalidate() after the sub-trees have changed.
+ * Shader and color cores as well as lights and cameras inside the sub-trees are ignored.
+ *
+ * Allowed core types: ColorCore, MaterialCore, MaterialTable, ShaderCore, TextureCore.
+ */
+class StaticBatch: public Leaf {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  StaticBatch();
+
+  /**
+   * Destructor.
+   */
+  virtual ~StaticBatch();
+
+  /**
+   * Create shared pointer.
+   */
+  static StaticBatchSP create();
+
+  /**
+   * Add core to be applied to all batches, in particular the batch-aware shader.
+   *
+   * Allowed core types: ColorCore, MaterialCore, MaterialTable, ShaderCore, TextureCore.
+   *
+   * \return this pointer for method chaining
+   */
+  StaticBatch* addCore(CoreSP core);
+
+  /**
+   * Add sub-tree to be merged into the batches. The node must not be part
+   * of another scene graph.
+   *
+   * \return this pointer for method chaining
+   */
+  StaticBatch* addNode(NodeSP node);
+
+  /**
+   * Enable or disable submission by glMultiDrawElementsIndirect() (default: enabled),
+   * e.g., for comparison with per-command draw calls.
+   * Ignored if ARB_multi_draw_indirect or ARB_base_instance are not supported.
+   * Changing the setting rebuilds the batch on next rendering.
+   *
+   * \return this pointer for method chaining
+   */
+  StaticBatch* setMultiDrawIndirect(bool isEnabled);
+
+  /**
+   * Check if batches are submitted by glMultiDrawElementsIndirect().
+   */
+  bool isMultiDrawIndirect() const;
+
+  /**
+   * Mark batches to be rebuilt on next rendering, e.g., after the sub-trees have changed.
+   */
+  void invalidate();
+
+  /**
+   * Merge sub-trees into batches, to be called with active OpenGL context.
+   * Called by render() if necessary.
+   */
+  void build(RenderState* renderState);
+
+  /**
+   * Get number of batches, i.e., number of multi-draw calls per rendering.
+   */
+  int getNBatches() const;
+
+  /**
+   * Get number of draw commands, i.e., number of merged geometry cores.
+   */
+  int getNDrawCommands() const;
+
+  /**
+   * Traverse the batched sub-trees with given traverser,
+   * e.g., called by InfoTraverser::visitStaticBatch().
+   */
+  void traverseNodes(Traverser* traverser);
+
+  /**
+   * Accept traverser (visitor pattern).
+   */
+  virtual void accept(Traverser* traverser);
+
+  /**
+   * Render batches, i.e., process cores and submit draw commands.
+   */
+  virtual void render(RenderState* renderState);
+
+public:
+
+  // number of RGBA texels per draw command in buffer texture
+  // (model matrix, normal matrix, material index, texture matrix)
+  static const int DRAW_DATA_TEXELS = 12;
+
+protected:
+
+  /**
+   * Draw command as defined for glMultiDrawElementsIndirect().
+   */
+  struct DrawCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+  };
+
+  /**
+   * Merged geometry of all draw commands sharing material, texture,
+   * primitive type, and vertex attribute layout.
+   */
+  struct Batch {
+    MaterialCoreSP material;
+    TextureCoreSP texture;
+    GLenum primitiveType;
+    GLuint vao;
+    std::vector<GLuint> vboAttributes;
+    GLuint vboIndex;
+    GLuint indirectBuffer;
+    std::vector<DrawCommand> commands;
+  };
+
+  /**
+   * Delete batches and OpenGL buffers.
+   */
+  void clearBatches_();
+
+  /**
+   * Submit draw commands of a single batch.
+   */
+  void drawBatch_(const Batch& batch, bool useMultiDrawIndirect);
+
+protected:
+
+  GroupSP root_;
+  std::vector<Batch> batches_;
+  GLuint vboDrawIndex_;
+  GLuint tboDrawData_;
+  GLuint texDrawData_;
+  bool isBuilt_;
+  bool isMultiDrawIndirect_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* STATICBATCH_H_ */
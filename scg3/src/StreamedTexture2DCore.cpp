@@ -0,0 +1,120 @@
+/**
+ * \file StreamedTexture2DCore.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <limits>
+#include "RenderState.h"
+#include "scg_utilities.h"
+#include "StreamedTexture2DCore.h"
+#include "TextureContainer.h"
+
+namespace scg {
+
+
+StreamedTexture2DCore::StreamedTexture2DCore(TextureContainerSP container, GLenum wrapModeS,
+    GLenum wrapModeT, GLenum minFilter, GLenum magFilter)
+    : Texture2DCore(), container_(container), wrapModeS_(wrapModeS), wrapModeT_(wrapModeT),
+      minFilter_(minFilter), magFilter_(magFilter), residentLevel_(container->getNLevels()),
+      minResidentLevel_(container->getNLevels() - 1), requestedLevel_(container->getNLevels() - 1), pendingLevel_(-1), isUsed_(false),
+      viewDistance_(std::numeric_limits<GLfloat>::max()), lastUsedFrame_(0) {
+  assert(container->getNLevels() > 0);
+}
+
+
+StreamedTexture2DCore::~StreamedTexture2DCore() {
+}
+
+
+StreamedTexture2DCoreSP StreamedTexture2DCore::create(TextureContainerSP container,
+    GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  return std::make_shared<StreamedTexture2DCore>(container, wrapModeS, wrapModeT,
+      minFilter, magFilter);
+}
+
+
+TextureContainerSP StreamedTexture2DCore::getContainer() const {
+  return container_;
+}
+
+
+int StreamedTexture2DCore::getResidentLevel() const {
+  return residentLevel_;
+}
+
+
+int StreamedTexture2DCore::getRequestedLevel() const {
+  return requestedLevel_;
+}
+
+
+size_t StreamedTexture2DCore::getResidentBytes() const {
+  return getLevelBytes(residentLevel_);
+}
+
+
+size_t StreamedTexture2DCore::getLevelBytes(int level) const {
+  size_t bytes = 0;
+  int endLevel = isMipmapFilter_(minFilter_) ? container_->getNLevels() : level + 1;
+  for (int i = level; i < endLevel; ++i) {
+    bytes += container_->getSize(i);
+  }
+  return bytes;
+}
+
+
+void StreamedTexture2DCore::render(RenderState* renderState) {
+  // record distance of model coordinate origin if in front of the camera
+  isUsed_ = true;
+  const glm::vec4& ecOrigin = renderState->modelViewStack.getMatrix()[3];
+  if ((renderState->projectionStack.getMatrix() * ecOrigin).w > 0.f) {
+    viewDistance_ = glm::min(viewDistance_, glm::length(glm::vec3(ecOrigin)));
+  }
+
+  Texture2DCore::render(renderState);
+}
+
+
+void StreamedTexture2DCore::setResidentLevel_(int level,
+    const std::vector<std::vector<unsigned char>>& levelData) {
+  assert(level >= 0 && level < container_->getNLevels());
+
+  // take staged data of newly resident levels, container data of all other levels
+  int nLevels = isMipmapFilter_(minFilter_) ? container_->getNLevels() - level : 1;
+  std::vector<const unsigned char*> data;
+  for (int i = 0; i < nLevels; ++i) {
+    size_t iStaged = static_cast<size_t>(i);
+    data.push_back(iStaged < levelData.size() ? levelData[iStaged].data()
+        : container_->getData(level + i));
+  }
+
+  // create new texture object, delete previous one
+  initTexture_(wrapModeS_, wrapModeT_, minFilter_, magFilter_);
+  setTextureLevels_(*container_, level, data);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  residentLevel_ = level;
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,133 @@
+/**
+ * \file StreamedTexture2DCore.h
+ * \brief 2D texture core whose mipmap residency is managed by a TextureStreamer.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STREAMEDTEXTURE2DCORE_H_
+#define STREAMEDTEXTURE2DCORE_H_
+
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "Texture2DCore.h"
+
+namespace scg {
+
+
+/**
+ * \brief 2D texture core whose mipmap residency is managed by a TextureStreamer.
+ *
+ * Only the levels from the resident level down to the coarsest level of the texture container
+ * are stored in GPU memory, the resident level becoming texture level 0.
+ * During rendering, the eye-space distance of the current model coordinate origin is recorded,
+ * from which the streamer derives the requested level.
+ *
+ * Streamed texture cores are created by TextureStreamer::createTexture() or
+ * TextureCoreFactory::createStreamed2DTextureFromFile().
+ */
+class StreamedTexture2DCore: public Texture2DCore {
+
+public:
+
+  /**
+   * Constructor with texture container and texture parameters
+   * (cf. Texture2DCore::setTexture()).
+   */
+  StreamedTexture2DCore(TextureContainerSP container, GLenum wrapModeS, GLenum wrapModeT,
+      GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Destructor.
+   */
+  virtual ~StreamedTexture2DCore();
+
+  /**
+   * Create shared pointer with texture container and texture parameters.
+   */
+  static StreamedTexture2DCoreSP create(TextureContainerSP container, GLenum wrapModeS,
+      GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Get texture container.
+   */
+  TextureContainerSP getContainer() const;
+
+  /**
+   * Get finest mipmap level stored in GPU memory.
+   */
+  int getResidentLevel() const;
+
+  /**
+   * Get finest mipmap level requested by the streamer.
+   */
+  int getRequestedLevel() const;
+
+  /**
+   * Get GPU memory occupied by the resident levels (bytes).
+   */
+  size_t getResidentBytes() const;
+
+  /**
+   * Get GPU memory required if the given level and all coarser levels are resident (bytes).
+   */
+  size_t getLevelBytes(int level) const;
+
+  /**
+   * Render core, i.e., record view distance, bind texture, and post-multiply
+   * current texture matrix by local texture matrix.
+   */
+  virtual void render(RenderState* renderState);
+
+protected:
+
+  /**
+   * Replace texture object by one containing the given level and all coarser levels.
+   *
+   * \param level new resident level
+   * \param levelData data of levels level, level + 1, ..., getResidentLevel() - 1
+   *    if residency is raised (may be empty), otherwise the data are taken from the container
+   */
+  void setResidentLevel_(int level, const std::vector<std::vector<unsigned char>>& levelData);
+
+protected:
+
+  TextureContainerSP container_;
+  GLenum wrapModeS_;
+  GLenum wrapModeT_;
+  GLenum minFilter_;
+  GLenum magFilter_;
+  int residentLevel_;
+  int minResidentLevel_;
+  int requestedLevel_;
+  int pendingLevel_;
+  bool isUsed_;
+  GLfloat viewDistance_;
+  unsigned long lastUsedFrame_;
+
+  friend class TextureStreamer;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* STREAMEDTEXTURE2DCORE_H_ */
@@ -0,0 +1,118 @@
+/**
+ * \file Texture2DArrayCore.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include "RenderState.h"
+#include "scg_utilities.h"
+#include "Texture2DArrayCore.h"
+
+namespace scg {
+
+
+Texture2DArrayCore::Texture2DArrayCore()
+    : TextureCore(), nLayers_(0) {
+}
+
+
+Texture2DArrayCore::~Texture2DArrayCore() {
+  if (isGLContextActive()) {
+    glDeleteTextures(1, &tex_);
+  }
+}
+
+
+Texture2DArrayCoreSP Texture2DArrayCore::create() {
+  return std::make_shared<Texture2DArrayCore>();
+}
+
+
+void Texture2DArrayCore::setTextureArray(GLsizei width, GLsizei height,
+    const std::vector<const unsigned char*>& rgbaData,
+    GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  assert(!rgbaData.empty());
+  nLayers_ = static_cast<GLsizei>(rgbaData.size());
+  glDeleteTextures(1, &tex_);
+  glGenTextures(1, &tex_);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, tex_);
+  assert(glIsTexture(tex_));
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, wrapModeS);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, wrapModeT);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, minFilter);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, magFilter);
+
+  // use anisotropic filtering
+  GLfloat maxAnisotropy;
+  glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+  glTexParameterf(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
+
+  // transfer layers to GPU memory, generate mipmap if requested, unbind texture
+  glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, width, height, nLayers_, 0,
+      GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  for (GLsizei layer = 0; layer < nLayers_; ++layer) {
+    assert(rgbaData[layer]);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1,
+        GL_RGBA, GL_UNSIGNED_BYTE, rgbaData[layer]);
+  }
+  if (minFilter == GL_NEAREST_MIPMAP_NEAREST || minFilter == GL_NEAREST_MIPMAP_LINEAR ||
+      minFilter == GL_LINEAR_MIPMAP_NEAREST || minFilter == GL_LINEAR_MIPMAP_LINEAR) {
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+  }
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+  assert(!checkGLError());
+}
+
+
+GLsizei Texture2DArrayCore::getNLayers() const {
+  return nLayers_;
+}
+
+
+void Texture2DArrayCore::render(RenderState* renderState) {
+  // multiply current texture matrix by local texture matrix
+  TextureCore::render(renderState);
+
+  // save texture binding
+  glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &texOld_);
+
+  // bind texture
+  assert(glIsTexture(tex_));
+  glBindTexture(GL_TEXTURE_2D_ARRAY, tex_);
+  ++renderState->stats.nTextureBinds;
+
+  assert(!checkGLError());
+}
+
+
+void Texture2DArrayCore::renderPost(RenderState* renderState) {
+  // restore texture binding
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texOld_);
+
+  // restore texture matrix
+  TextureCore::renderPost(renderState);
+
+  assert(!checkGLError());
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,107 @@
+/**
+ * \file Texture2DArrayCore.h
+ * \brief 2D array texture core, e.g., to be created by TextureArrayBuilder.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEXTURE2DARRAYCORE_H_
+#define TEXTURE2DARRAYCORE_H_
+
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "TextureCore.h"
+
+namespace scg {
+
+
+/**
+ * \brief 2D array texture core, e.g., to be created by TextureArrayBuilder.
+ *
+ * The layers are selected by TextureLayerCore nodes via the texture matrix.
+ * To be used with a shader using texture2d_array_modulate.glsl.
+ */
+class Texture2DArrayCore: public TextureCore {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  Texture2DArrayCore();
+
+  /**
+   * Destructor.
+   */
+  virtual ~Texture2DArrayCore();
+
+  /**
+   * Create shared pointer.
+   */
+  static Texture2DArrayCoreSP create();
+
+  /**
+   * Create array texture from RGBA images of equal size with given parameters.
+   * If minFilter is GL_*_MIPMAP_* (see below), a mipmap is created from the
+   * given images.
+   *
+   * \param width texture width
+   * \param height texture height
+   * \param rgbaData arrays of RGBA values, one per layer
+   * \param wrapModeS GL_CLAMP, GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE,
+   *    GL_MIRRORED_REPEAT, or GL_REPEAT
+   * \param wrapModeT see wrapModeS
+   * \param minFilter GL_NEAREST, GL_LINEAR,\n
+   *    GL_NEAREST_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_NEAREST,
+   *    GL_NEAREST_MIPMAP_LINEAR, or GL_LINEAR_MIPMAP_LINEAR
+   * \param magFilter GL_NEAREST or GL_LINEAR
+   */
+  void setTextureArray(GLsizei width, GLsizei height,
+      const std::vector<const unsigned char*>& rgbaData,
+      GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Get number of layers.
+   */
+  GLsizei getNLayers() const;
+
+  /**
+   * Render core, i.e., bind array texture and post-multiply current texture matrix
+   * by local texture matrix.
+   */
+  virtual void render(RenderState* renderState);
+
+  /**
+   * Render core after traversing sub-tree, i.e., restore previous texture matrix
+   * and bind previous array texture.
+   */
+  virtual void renderPost(RenderState* renderState);
+
+protected:
+
+  GLsizei nLayers_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* TEXTURE2DARRAYCORE_H_ */
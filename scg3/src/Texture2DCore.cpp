@@ -25,6 +25,7 @@
 #include "RenderState.h"
 #include "scg_utilities.h"
 #include "Texture2DCore.h"
+#include "TextureContainer.h"
 
 namespace scg {
 
@@ -49,6 +50,38 @@ Texture2DCoreSP Texture2DCore::create() {
 void Texture2DCore::setTexture(GLsizei width, GLsizei height, const unsigned char* rgbaData,
     GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
   assert(rgbaData);
+  initTexture_(wrapModeS, wrapModeT, minFilter, magFilter);
+
+  // transfer texture to GPU memory, generate mipmap if requested, unbind texture
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
+  if (isMipmapFilter_(minFilter)) {
+    glGenerateMipmap(GL_TEXTURE_2D);
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  assert(!checkGLError());
+}
+
+
+void Texture2DCore::setTexture(const TextureContainer& container,
+    GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  assert(container.getNLevels() > 0);
+  initTexture_(wrapModeS, wrapModeT, minFilter, magFilter);
+
+  // transfer pre-baked mipmap levels to GPU memory, unbind texture
+  GLsizei nLevels = isMipmapFilter_(minFilter) ? container.getNLevels() : 1;
+  std::vector<const unsigned char*> levelData;
+  for (GLint level = 0; level < nLevels; ++level) {
+    levelData.push_back(container.getData(level));
+  }
+  setTextureLevels_(container, 0, levelData);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  assert(!checkGLError());
+}
+
+
+void Texture2DCore::initTexture_(GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
   glDeleteTextures(1, &tex_);
   glGenTextures(1, &tex_);
   glBindTexture(GL_TEXTURE_2D, tex_);
@@ -62,16 +95,48 @@ void Texture2DCore::setTexture(GLsizei width, GLsizei height, const unsigned cha
   GLfloat maxAnisotropy;
   glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
   glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
+}
 
-  // transfer texture to GPU memory, generate mipmap if requested, unbind texture
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
-  if (minFilter == GL_NEAREST_MIPMAP_NEAREST || minFilter == GL_NEAREST_MIPMAP_LINEAR ||
-      minFilter == GL_LINEAR_MIPMAP_NEAREST || minFilter == GL_LINEAR_MIPMAP_LINEAR) {
-    glGenerateMipmap(GL_TEXTURE_2D);
+
+void Texture2DCore::setTextureLevels_(const TextureContainer& container, GLint firstLevel,
+    const std::vector<const unsigned char*>& levelData) {
+  assert(!levelData.empty());
+  GLsizei nLevels = static_cast<GLsizei>(levelData.size());
+  GLenum format = container.getInternalFormat();
+  bool isStorage = SCG_GL_EXTENSION_SUPPORTED(ARB_texture_storage) != 0;
+  if (isStorage) {
+    glTexStorage2D(GL_TEXTURE_2D, nLevels, format, container.getWidth(firstLevel),
+        container.getHeight(firstLevel));
   }
-  glBindTexture(GL_TEXTURE_2D, 0);
+  for (GLint level = 0; level < nLevels; ++level) {
+    GLsizei width = container.getWidth(firstLevel + level);
+    GLsizei height = container.getHeight(firstLevel + level);
+    GLsizei size = static_cast<GLsizei>(container.getSize(firstLevel + level));
+    const GLvoid* data = levelData[level];
+    if (container.isCompressed()) {
+      if (isStorage) {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format, size, data);
+      }
+      else {
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, size, data);
+      }
+    }
+    else {
+      if (isStorage) {
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data);
+      }
+      else {
+        glTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+      }
+    }
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, nLevels - 1);
+}
 
-  assert(!checkGLError());
+
+bool Texture2DCore::isMipmapFilter_(GLenum minFilter) {
+  return minFilter == GL_NEAREST_MIPMAP_NEAREST || minFilter == GL_NEAREST_MIPMAP_LINEAR ||
+      minFilter == GL_LINEAR_MIPMAP_NEAREST || minFilter == GL_LINEAR_MIPMAP_LINEAR;
 }
 
 
@@ -95,6 +160,7 @@ void Texture2DCore::render(RenderState* renderState) {
   // bind texture
   assert(glIsTexture(tex_));
   glBindTexture(GL_TEXTURE_2D, tex_);
+  ++renderState->stats.nTextureBinds;
 
   assert(!checkGLError());
 }
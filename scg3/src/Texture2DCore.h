@@ -25,6 +25,7 @@
 #ifndef TEXTURE2DCORE_H_
 #define TEXTURE2DCORE_H_
 
+#include <vector>
 #include "scg_glew_glad.h"
 #include "scg_glm.h"
 #include "scg_internals.h"
@@ -74,6 +75,24 @@ public:
   void setTexture(GLsizei width, GLsizei height, const unsigned char* rgbaData,
       GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
 
+  /**
+   * Create texture from pre-baked texture container with given parameters.
+   * If minFilter is GL_*_MIPMAP_* (see below), all mipmap levels of the container
+   * are uploaded, otherwise only the base level. Immutable texture storage
+   * (glTexStorage2D()) is used if available.
+   *
+   * \param container texture container, e.g., loaded by TextureContainer::load()
+   * \param wrapModeS GL_CLAMP, GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE,
+   *    GL_MIRRORED_REPEAT, or GL_REPEAT
+   * \param wrapModeT see wrapModeS
+   * \param minFilter GL_NEAREST, GL_LINEAR,\n
+   *    GL_NEAREST_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_NEAREST,
+   *    GL_NEAREST_MIPMAP_LINEAR, or GL_LINEAR_MIPMAP_LINEAR
+   * \param magFilter GL_NEAREST or GL_LINEAR
+   */
+  void setTexture(const TextureContainer& container,
+      GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
+
   /**
    * Rotate texture around (0,0,1) axis
    * (post-multiply local texture matrix by transformation).
@@ -102,6 +121,29 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+protected:
+
+  /**
+   * Create and bind new texture object, set texture parameters.
+   */
+  void initTexture_(GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Transfer levels of texture container to bound texture object, starting
+   * with given container level as texture level 0, and set maximum texture level.
+   *
+   * \param container texture container providing level sizes and format
+   * \param firstLevel container level to become texture level 0
+   * \param levelData data of container levels firstLevel, firstLevel + 1, ...
+   */
+  void setTextureLevels_(const TextureContainer& container, GLint firstLevel,
+      const std::vector<const unsigned char*>& levelData);
+
+  /**
+   * Check if minification filter uses mipmaps.
+   */
+  static bool isMipmapFilter_(GLenum minFilter);
+
 };
 
 
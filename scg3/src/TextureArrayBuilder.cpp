@@ -0,0 +1,149 @@
+/**
+ * \file TextureArrayBuilder.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include "scg_stb_image.h"
+#include "scg_utilities.h"
+#include "Texture2DArrayCore.h"
+#include "TextureArrayBuilder.h"
+#include "TextureLayerCore.h"
+
+namespace scg {
+
+
+TextureArrayBuilder::TextureArrayBuilder() {
+}
+
+
+TextureArrayBuilder::TextureArrayBuilder(const std::string& filePath) {
+  addFilePath(filePath);
+}
+
+
+TextureArrayBuilder::~TextureArrayBuilder() {
+}
+
+
+void TextureArrayBuilder::addFilePath(const std::string& filePath) {
+  assert(!filePath.empty());
+  splitFilePath(filePath, filePaths_);
+}
+
+
+TextureLayerCoreSP TextureArrayBuilder::addTexture(GLsizei width, GLsizei height,
+    const unsigned char* rgbaData) {
+  assert(width > 0 && height > 0 && rgbaData);
+  Layer layer;
+  layer.width = width;
+  layer.height = height;
+  layer.rgbaData.assign(rgbaData, rgbaData + 4 * width * height);
+  layer.core = TextureLayerCore::create(static_cast<GLint>(layers_.size()));
+  layers_.push_back(std::move(layer));
+  return layers_.back().core;
+}
+
+
+TextureLayerCoreSP TextureArrayBuilder::addTextureFromFile(const std::string& fileName) {
+
+  // try to find file
+  std::string fullFileName = getFullFileName(filePaths_, fileName);
+  if (fullFileName.empty()) {
+    throw std::runtime_error("Cannot open file" + fileName
+        + " [TextureArrayBuilder::addTextureFromFile()]");
+  }
+
+  // load image and create array with 4 components (RGBA)
+  int width, height, dummy;
+  unsigned char* rgbaData = stbi_load(fullFileName.c_str(), &width, &height, &dummy, 4);
+  if (!rgbaData) {
+    throw std::runtime_error("stb_image error: " + std::string(stbi_failure_reason())
+        + " [TextureArrayBuilder::addTextureFromFile()]");
+  }
+
+  // add layer and free image memory
+  auto core = addTexture(width, height, rgbaData);
+  stbi_image_free(rgbaData);
+  return core;
+}
+
+
+int TextureArrayBuilder::getNLayers() const {
+  return static_cast<int>(layers_.size());
+}
+
+
+Texture2DArrayCoreSP TextureArrayBuilder::build(GLenum wrapModeS, GLenum wrapModeT,
+    GLenum minFilter, GLenum magFilter) {
+  if (layers_.empty()) {
+    throw std::runtime_error("No textures added [TextureArrayBuilder::build()]");
+  }
+  GLint maxLayers;
+  glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+  if (static_cast<GLint>(layers_.size()) > maxLayers) {
+    throw std::runtime_error("Number of layers exceeds GL_MAX_ARRAY_TEXTURE_LAYERS"
+        " [TextureArrayBuilder::build()]");
+  }
+
+  // determine array texture size
+  GLsizei width = 0, height = 0;
+  for (auto& layer : layers_) {
+    width = std::max(width, layer.width);
+    height = std::max(height, layer.height);
+  }
+
+  // pad smaller images by replicating edge texels, set texture coordinate scaling
+  std::vector<std::vector<unsigned char>> paddedData;
+  std::vector<const unsigned char*> rgbaData;
+  for (auto& layer : layers_) {
+    if (layer.width == width && layer.height == height) {
+      rgbaData.push_back(layer.rgbaData.data());
+    }
+    else {
+      paddedData.push_back(std::vector<unsigned char>(4 * width * height));
+      unsigned char* dst = paddedData.back().data();
+      for (GLsizei y = 0; y < height; ++y) {
+        const unsigned char* srcRow = layer.rgbaData.data()
+            + 4 * std::min(y, layer.height - 1) * layer.width;
+        unsigned char* dstRow = dst + 4 * y * width;
+        memcpy(dstRow, srcRow, 4 * layer.width);
+        for (GLsizei x = layer.width; x < width; ++x) {
+          memcpy(dstRow + 4 * x, srcRow + 4 * (layer.width - 1), 4);
+        }
+      }
+      rgbaData.push_back(dst);
+    }
+    layer.core->setLayerScaling(glm::vec2(static_cast<float>(layer.width) / width,
+        static_cast<float>(layer.height) / height));
+  }
+
+  // create array texture
+  auto core = Texture2DArrayCore::create();
+  core->setTextureArray(width, height, rgbaData, wrapModeS, wrapModeT, minFilter, magFilter);
+  return core;
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,148 @@
+/**
+ * \file TextureArrayBuilder.h
+ * \brief A builder that packs 2D textures into the layers of an array texture.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEXTUREARRAYBUILDER_H_
+#define TEXTUREARRAYBUILDER_H_
+
+#include <string>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A builder that packs 2D textures into the layers of an array texture.
+ *
+ * Each added texture becomes one layer of a Texture2DArrayCore, represented by a
+ * TextureLayerCore that is to be added to the respective shape(s). The array texture
+ * is to be added to a common ancestor node (e.g., a StaticBatch) together with a shader
+ * using texture2d_array_modulate.glsl. Since all shapes then share one texture object,
+ * StaticBatch can merge them into a single draw batch.
+ *
+ * The array texture is sized to the largest added image. Smaller images are stored
+ * in the lower left corner of their layer, padded by replicating their edge texels,
+ * and the texture coordinates are scaled by the layer's texture matrix.
+ * Note that wrap mode GL_REPEAT requires all images to be of equal size.
+ *
+ * Example:
+ * \code
+ * TextureArrayBuilder builder("../scg3/textures;../../scg3/textures");
+ * auto brickLayer = builder.addTextureFromFile("brick_bump.png");
+ * auto woodLayer = builder.addTextureFromFile("wood_256.png");
+ * auto texArray = builder.build(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+ * \endcode
+ */
+class TextureArrayBuilder {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  TextureArrayBuilder();
+
+  /**
+   * Constructor with file path to be searched for texture files.
+   * \param filePath list of directories separated by ';'
+   */
+  explicit TextureArrayBuilder(const std::string& filePath);
+
+  /**
+   * Destructor.
+   */
+  virtual ~TextureArrayBuilder();
+
+  /**
+   * Add file path to be searched for texture files.
+   * \param filePath list of directories separated by ';'
+   */
+  void addFilePath(const std::string& filePath);
+
+  /**
+   * Add RGBA image as new layer, the image data are copied.
+   *
+   * \param width image width
+   * \param height image height
+   * \param rgbaData array of RGBA values
+   * \return layer core to be added to the shape(s) using the image
+   */
+  TextureLayerCoreSP addTexture(GLsizei width, GLsizei height, const unsigned char* rgbaData);
+
+  /**
+   * Add image file as new layer, using stb_image to load the image file.
+   * \return layer core to be added to the shape(s) using the image
+   */
+  TextureLayerCoreSP addTextureFromFile(const std::string& fileName);
+
+  /**
+   * Get number of layers added so far.
+   */
+  int getNLayers() const;
+
+  /**
+   * Create array texture containing all added images and set texture coordinate
+   * scaling of the layer cores, to be called with active OpenGL context.
+   * Throws an exception if the number of layers exceeds GL_MAX_ARRAY_TEXTURE_LAYERS.
+   *
+   * \param wrapModeS see Texture2DArrayCore::setTextureArray()
+   * \param wrapModeT see Texture2DArrayCore::setTextureArray()
+   * \param minFilter see Texture2DArrayCore::setTextureArray()
+   * \param magFilter see Texture2DArrayCore::setTextureArray()
+   */
+  Texture2DArrayCoreSP build(GLenum wrapModeS = GL_CLAMP_TO_EDGE,
+      GLenum wrapModeT = GL_CLAMP_TO_EDGE, GLenum minFilter = GL_LINEAR_MIPMAP_LINEAR,
+      GLenum magFilter = GL_LINEAR);
+
+protected:
+
+  /**
+   * Image of a single layer.
+   */
+  struct Layer {
+    GLsizei width;
+    GLsizei height;
+    std::vector<unsigned char> rgbaData;
+    TextureLayerCoreSP core;
+  };
+
+protected:
+
+  std::vector<std::string> filePaths_;
+  std::vector<Layer> layers_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(TextureArrayBuilder);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* TEXTUREARRAYBUILDER_H_ */
@@ -0,0 +1,419 @@
+/**
+ * \file TextureContainer.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "TextureContainer.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCG_TEXTURE_CONTAINER_SSE
+#include <emmintrin.h>
+#endif
+
+namespace scg {
+
+
+// container file header (24 bytes) and level table entry (24 bytes)
+struct TextureContainerHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t internalFormat;
+  uint32_t width;
+  uint32_t height;
+  uint32_t nLevels;
+};
+
+struct TextureContainerLevel {
+  uint32_t width;
+  uint32_t height;
+  uint64_t offset;
+  uint64_t size;
+};
+
+static const char MAGIC[4] = { 'S', 'C', 'G', 'T' };
+static const uint32_t VERSION = 1;
+static const size_t LEVEL_ALIGNMENT = 16;
+static const int MAX_LEVELS = 32;
+static const uint32_t MAX_SIZE = 1 << 16;
+static const int ENCODE_TABLE_SIZE = 4096;
+
+
+/**
+ * \brief Lookup tables for conversion of 8-bit values to linear values [0,1] and back.
+ */
+struct ColorTables {
+  float decode[256];
+  unsigned char encode[ENCODE_TABLE_SIZE];
+
+  ColorTables(bool isSRGB) {
+    for (int i = 0; i < 256; ++i) {
+      float c = i / 255.f;
+      decode[i] = isSRGB ? (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f)) : c;
+    }
+    for (int i = 0; i < ENCODE_TABLE_SIZE; ++i) {
+      float c = i / static_cast<float>(ENCODE_TABLE_SIZE - 1);
+      if (isSRGB) {
+        c = (c <= 0.0031308f ? 12.92f * c : 1.055f * std::pow(c, 1.f / 2.4f) - 0.055f);
+      }
+      encode[i] = static_cast<unsigned char>(std::min(255.f, c * 255.f + 0.5f));
+    }
+  }
+};
+
+
+// minimum number of bytes of a level: RGBA8 or 4x4 blocks of compressed formats
+// (8 bytes for RGTC1 and unknown formats, 16 bytes for RGTC2)
+static uint64_t getMinLevelSize(GLenum internalFormat, uint32_t width, uint32_t height) {
+  switch (internalFormat) {
+    case GL_RGBA8:
+    case GL_SRGB8_ALPHA8:
+    case GL_RGBA:
+      return 4 * static_cast<uint64_t>(width) * height;
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2:
+      return 16 * static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+    default:
+      return 8 * static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+  }
+}
+
+
+// average four RGBA pixels, color values in linear space, alpha values unchanged
+static inline void averagePixels(const unsigned char* p00, const unsigned char* p01,
+    const unsigned char* p10, const unsigned char* p11, const ColorTables& tables,
+    unsigned char* result) {
+  const float* lut = tables.decode;
+  int index[4];
+#ifdef SCG_TEXTURE_CONTAINER_SSE
+  __m128 sum = _mm_set_ps(p00[3], lut[p00[2]], lut[p00[1]], lut[p00[0]]);
+  sum = _mm_add_ps(sum, _mm_set_ps(p01[3], lut[p01[2]], lut[p01[1]], lut[p01[0]]));
+  sum = _mm_add_ps(sum, _mm_set_ps(p10[3], lut[p10[2]], lut[p10[1]], lut[p10[0]]));
+  sum = _mm_add_ps(sum, _mm_set_ps(p11[3], lut[p11[2]], lut[p11[1]], lut[p11[0]]));
+  const float s = 0.25f * (ENCODE_TABLE_SIZE - 1);
+  __m128 scaled = _mm_add_ps(_mm_mul_ps(sum, _mm_set_ps(0.25f, s, s, s)), _mm_set1_ps(0.5f));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(index), _mm_cvttps_epi32(scaled));
+#else
+  for (int i = 0; i < 3; ++i) {
+    float sum = lut[p00[i]] + lut[p01[i]] + lut[p10[i]] + lut[p11[i]];
+    index[i] = static_cast<int>(sum * 0.25f * (ENCODE_TABLE_SIZE - 1) + 0.5f);
+  }
+  index[3] = (p00[3] + p01[3] + p10[3] + p11[3] + 2) / 4;
+#endif
+  result[0] = tables.encode[index[0]];
+  result[1] = tables.encode[index[1]];
+  result[2] = tables.encode[index[2]];
+  result[3] = static_cast<unsigned char>(index[3]);
+}
+
+
+TextureContainer::TextureContainer()
+    : internalFormat_(GL_RGBA8), data_(nullptr), mappedData_(nullptr), mappedSize_(0),
+      mappingHandle_(nullptr) {
+}
+
+
+TextureContainer::~TextureContainer() {
+  unmap_();
+}
+
+
+TextureContainerSP TextureContainer::create() {
+  return std::make_shared<TextureContainer>();
+}
+
+
+TextureContainerSP TextureContainer::createFromRGBA(GLsizei width, GLsizei height,
+    const unsigned char* rgbaData, bool isSRGB) {
+  assert(rgbaData);
+  assert(width > 0 && height > 0);
+
+  std::vector<std::vector<unsigned char>> mipmaps;
+  generateMipmaps(width, height, rgbaData, isSRGB, mipmaps);
+
+  // copy all levels into one aligned block
+  auto container = create();
+  container->internalFormat_ = GL_RGBA8;
+  size_t offset = 0;
+  for (int i = 0; i <= static_cast<int>(mipmaps.size()); ++i) {
+    Level level;
+    level.width = std::max(1, width >> i);
+    level.height = std::max(1, height >> i);
+    level.offset = offset;
+    level.size = 4 * static_cast<size_t>(level.width) * level.height;
+    container->levels_.push_back(level);
+    offset += (level.size + LEVEL_ALIGNMENT - 1) / LEVEL_ALIGNMENT * LEVEL_ALIGNMENT;
+  }
+  container->ownData_.resize(offset);
+  for (size_t i = 0; i < container->levels_.size(); ++i) {
+    const Level& level = container->levels_[i];
+    const unsigned char* src = (i == 0) ? rgbaData : mipmaps[i - 1].data();
+    memcpy(&container->ownData_[level.offset], src, level.size);
+  }
+  container->data_ = container->ownData_.data();
+  return container;
+}
+
+
+TextureContainerSP TextureContainer::load(const std::string& fileName) {
+  auto container = create();
+
+  // map file into memory
+#if defined(_WIN32)
+  HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Cannot open file " + fileName + " [TextureContainer::load()]");
+  }
+  LARGE_INTEGER fileSize;
+  GetFileSizeEx(file, &fileSize);
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping) {
+    throw std::runtime_error("Cannot map file " + fileName + " [TextureContainer::load()]");
+  }
+  container->mappingHandle_ = mapping;
+  container->mappedData_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  container->mappedSize_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open file " + fileName + " [TextureContainer::load()]");
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw std::runtime_error("Cannot stat file " + fileName + " [TextureContainer::load()]");
+  }
+  container->mappedSize_ = static_cast<size_t>(fileStat.st_size);
+  void* data = mmap(nullptr, container->mappedSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  container->mappedData_ = (data == MAP_FAILED) ? nullptr : data;
+#endif
+  if (!container->mappedData_) {
+    throw std::runtime_error("Cannot map file " + fileName + " [TextureContainer::load()]");
+  }
+
+  // check header
+  const unsigned char* bytes = static_cast<const unsigned char*>(container->mappedData_);
+  TextureContainerHeader header;
+  if (container->mappedSize_ < sizeof(header)) {
+    throw std::runtime_error("Invalid texture container " + fileName + " [TextureContainer::load()]");
+  }
+  memcpy(&header, bytes, sizeof(header));
+  if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION
+      || header.nLevels == 0 || header.nLevels > MAX_LEVELS
+      || header.width == 0 || header.width > MAX_SIZE
+      || header.height == 0 || header.height > MAX_SIZE
+      || sizeof(header) + header.nLevels * sizeof(TextureContainerLevel) > container->mappedSize_) {
+    throw std::runtime_error("Invalid texture container " + fileName + " [TextureContainer::load()]");
+  }
+  container->internalFormat_ = header.internalFormat;
+
+  // read level table, offsets are relative to file start; level dimensions have to halve
+  // per level, level data has to be complete and within the file (uploads read
+  // 4 * width * height bytes of uncompressed levels)
+  const unsigned char* table = bytes + sizeof(header);
+  for (uint32_t i = 0; i < header.nLevels; ++i) {
+    TextureContainerLevel entry;
+    memcpy(&entry, table + i * sizeof(entry), sizeof(entry));
+    if (entry.width != std::max(1u, header.width >> i)
+        || entry.height != std::max(1u, header.height >> i)
+        || entry.size < getMinLevelSize(header.internalFormat, entry.width, entry.height)
+        || entry.offset > container->mappedSize_
+        || entry.size > container->mappedSize_ - entry.offset) {
+      throw std::runtime_error("Invalid texture container " + fileName + " [TextureContainer::load()]");
+    }
+    Level level;
+    level.width = static_cast<GLsizei>(entry.width);
+    level.height = static_cast<GLsizei>(entry.height);
+    level.offset = static_cast<size_t>(entry.offset);
+    level.size = static_cast<size_t>(entry.size);
+    container->levels_.push_back(level);
+  }
+  container->data_ = bytes;
+  return container;
+}
+
+
+void TextureContainer::save(const std::string& fileName) const {
+  std::ofstream stream(fileName.c_str(), std::ios::binary);
+  if (!stream) {
+    throw std::runtime_error("Cannot open file " + fileName + " [TextureContainer::save()]");
+  }
+
+  // write header
+  TextureContainerHeader header;
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.internalFormat = internalFormat_;
+  header.width = static_cast<uint32_t>(getWidth());
+  header.height = static_cast<uint32_t>(getHeight());
+  header.nLevels = static_cast<uint32_t>(levels_.size());
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  // write level table
+  size_t tableEnd = sizeof(header) + levels_.size() * sizeof(TextureContainerLevel);
+  size_t offset = (tableEnd + LEVEL_ALIGNMENT - 1) / LEVEL_ALIGNMENT * LEVEL_ALIGNMENT;
+  std::vector<size_t> offsets;
+  for (auto& level : levels_) {
+    TextureContainerLevel entry;
+    entry.width = static_cast<uint32_t>(level.width);
+    entry.height = static_cast<uint32_t>(level.height);
+    entry.offset = offset;
+    entry.size = level.size;
+    stream.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    offsets.push_back(offset);
+    offset += (level.size + LEVEL_ALIGNMENT - 1) / LEVEL_ALIGNMENT * LEVEL_ALIGNMENT;
+  }
+
+  // write level data, padded to alignment
+  const char padding[LEVEL_ALIGNMENT] = { 0 };
+  size_t position = tableEnd;
+  for (size_t i = 0; i < levels_.size(); ++i) {
+    stream.write(padding, offsets[i] - position);
+    stream.write(reinterpret_cast<const char*>(getData(static_cast<int>(i))), levels_[i].size);
+    position = offsets[i] + levels_[i].size;
+  }
+  if (!stream) {
+    throw std::runtime_error("Cannot write file " + fileName + " [TextureContainer::save()]");
+  }
+}
+
+
+bool TextureContainer::isContainerFile(const std::string& fileName) {
+  std::ifstream stream(fileName.c_str(), std::ios::binary);
+  char magic[sizeof(MAGIC)] = { 0 };
+  stream.read(magic, sizeof(magic));
+  return stream && memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+
+GLenum TextureContainer::getInternalFormat() const {
+  return internalFormat_;
+}
+
+
+bool TextureContainer::isCompressed() const {
+  return internalFormat_ != GL_RGBA8 && internalFormat_ != GL_SRGB8_ALPHA8
+      && internalFormat_ != GL_RGBA;
+}
+
+
+int TextureContainer::getNLevels() const {
+  return static_cast<int>(levels_.size());
+}
+
+
+GLsizei TextureContainer::getWidth(int level) const {
+  assert(level >= 0 && level < getNLevels());
+  return levels_[level].width;
+}
+
+
+GLsizei TextureContainer::getHeight(int level) const {
+  assert(level >= 0 && level < getNLevels());
+  return levels_[level].height;
+}
+
+
+const unsigned char* TextureContainer::getData(int level) const {
+  assert(level >= 0 && level < getNLevels());
+  return data_ + levels_[level].offset;
+}
+
+
+size_t TextureContainer::getSize(int level) const {
+  assert(level >= 0 && level < getNLevels());
+  return levels_[level].size;
+}
+
+
+void TextureContainer::generateMipmaps(GLsizei width, GLsizei height, const unsigned char* rgbaData,
+    bool isSRGB, std::vector<std::vector<unsigned char>>& levels) {
+  static const ColorTables srgbTables(true);
+  static const ColorTables linearTables(false);
+  const ColorTables& tables = isSRGB ? srgbTables : linearTables;
+
+  levels.clear();
+  const unsigned char* src = rgbaData;
+  GLsizei srcWidth = width;
+  GLsizei srcHeight = height;
+  while (srcWidth > 1 || srcHeight > 1) {
+    // 2x2 box filter, clamp to edge for odd sizes
+    GLsizei dstWidth = std::max(1, srcWidth / 2);
+    GLsizei dstHeight = std::max(1, srcHeight / 2);
+    levels.push_back(std::vector<unsigned char>(4 * static_cast<size_t>(dstWidth) * dstHeight));
+    unsigned char* dst = levels.back().data();
+    for (GLsizei y = 0; y < dstHeight; ++y) {
+      const unsigned char* row0 = src + 4 * static_cast<size_t>(srcWidth) * std::min(2 * y, srcHeight - 1);
+      const unsigned char* row1 = src + 4 * static_cast<size_t>(srcWidth) * std::min(2 * y + 1, srcHeight - 1);
+      for (GLsizei x = 0; x < dstWidth; ++x) {
+        GLsizei x0 = 4 * std::min(2 * x, srcWidth - 1);
+        GLsizei x1 = 4 * std::min(2 * x + 1, srcWidth - 1);
+        averagePixels(row0 + x0, row0 + x1, row1 + x0, row1 + x1, tables,
+            dst + 4 * (static_cast<size_t>(dstWidth) * y + x));
+      }
+    }
+    src = dst;
+    srcWidth = dstWidth;
+    srcHeight = dstHeight;
+  }
+}
+
+
+void TextureContainer::unmap_() {
+#if defined(_WIN32)
+  if (mappedData_) {
+    UnmapViewOfFile(mappedData_);
+  }
+  if (mappingHandle_) {
+    CloseHandle(static_cast<HANDLE>(mappingHandle_));
+  }
+#else
+  if (mappedData_) {
+    munmap(mappedData_, mappedSize_);
+  }
+#endif
+  mappedData_ = nullptr;
+  mappedSize_ = 0;
+  mappingHandle_ = nullptr;
+  data_ = nullptr;
+}
+
+
+} /* namespace scg */
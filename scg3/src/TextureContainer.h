@@ -0,0 +1,188 @@
+/**
+ * \file TextureContainer.h
+ * \brief A pre-baked 2D texture including its full mipmap chain, stored in a container file.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEXTURECONTAINER_H_
+#define TEXTURECONTAINER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A pre-baked 2D texture including its full mipmap chain, stored in a container file.
+ *
+ * File format (little endian, file extension .scgt):
+ * - header: magic "SCGT", version, internal format, width, height, number of levels
+ *   (6 x 4 bytes)
+ * - level table: width, height (2 x 4 bytes), offset, size (2 x 8 bytes) per level
+ * - level data, each level aligned to 16 bytes
+ *
+ * The internal format is GL_RGBA8 for containers created by createFromRGBA(),
+ * other formats are treated as compressed formats (e.g., GL_COMPRESSED_RED_RGTC1)
+ * and uploaded by glCompressedTexSubImage2D().
+ *
+ * Loaded container files are memory-mapped, such that the level data can be
+ * passed to OpenGL without intermediate copies.
+ */
+class TextureContainer {
+
+public:
+
+  /**
+   * Constructor.
+   */
+  TextureContainer();
+
+  /**
+   * Destructor, unmaps container file (if any).
+   */
+  virtual ~TextureContainer();
+
+  /**
+   * Create shared pointer.
+   */
+  static TextureContainerSP create();
+
+  /**
+   * Create shared pointer from RGBA image, including full mipmap chain (GL_RGBA8).
+   * The mipmaps are computed by a 2x2 box filter in linear color space if isSRGB is true
+   * (e.g., for color textures) or directly on the stored values otherwise (e.g., for normal maps).
+   *
+   * \param width image width
+   * \param height image height
+   * \param rgbaData array of RGBA values
+   * \param isSRGB true if image is sRGB-encoded, i.e., filtering is to be gamma-correct
+   */
+  static TextureContainerSP createFromRGBA(GLsizei width, GLsizei height,
+      const unsigned char* rgbaData, bool isSRGB = true);
+
+  /**
+   * Create shared pointer by memory-mapping a container file.
+   * \param fileName full file name
+   */
+  static TextureContainerSP load(const std::string& fileName);
+
+  /**
+   * Save container to file.
+   * \param fileName full file name
+   */
+  void save(const std::string& fileName) const;
+
+  /**
+   * Check if given file is a container file, i.e., starts with the magic number.
+   */
+  static bool isContainerFile(const std::string& fileName);
+
+  /**
+   * Get OpenGL internal format, e.g., GL_RGBA8.
+   */
+  GLenum getInternalFormat() const;
+
+  /**
+   * Check if internal format is a compressed format.
+   */
+  bool isCompressed() const;
+
+  /**
+   * Get number of mipmap levels.
+   */
+  int getNLevels() const;
+
+  /**
+   * Get width of mipmap level.
+   */
+  GLsizei getWidth(int level = 0) const;
+
+  /**
+   * Get height of mipmap level.
+   */
+  GLsizei getHeight(int level = 0) const;
+
+  /**
+   * Get data of mipmap level.
+   */
+  const unsigned char* getData(int level = 0) const;
+
+  /**
+   * Get data size of mipmap level in bytes.
+   */
+  size_t getSize(int level = 0) const;
+
+  /**
+   * Compute mipmap chain of RGBA image by a 2x2 box filter (SSE-accelerated if available).
+   *
+   * \param width image width
+   * \param height image height
+   * \param rgbaData array of RGBA values
+   * \param isSRGB true if filtering is to be performed in linear color space
+   * \param levels output: RGBA values of levels 1 (half size) to n (1x1)
+   */
+  static void generateMipmaps(GLsizei width, GLsizei height, const unsigned char* rgbaData,
+      bool isSRGB, std::vector<std::vector<unsigned char>>& levels);
+
+protected:
+
+  /**
+   * Mipmap level description, offset relative to data_.
+   */
+  struct Level {
+    GLsizei width;
+    GLsizei height;
+    size_t offset;
+    size_t size;
+  };
+
+  /**
+   * Unmap container file (if any).
+   */
+  void unmap_();
+
+protected:
+
+  GLenum internalFormat_;
+  std::vector<Level> levels_;
+  const unsigned char* data_;
+  std::vector<unsigned char> ownData_;
+  void* mappedData_;
+  size_t mappedSize_;
+  void* mappingHandle_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(TextureContainer);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* TEXTURECONTAINER_H_ */
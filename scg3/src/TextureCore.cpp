@@ -22,6 +22,7 @@
  */
 
 #include <cassert>
+#include "GLDebug.h"
 #include "RenderState.h"
 #include "TextureCore.h"
 
@@ -55,6 +56,11 @@ TextureCore* TextureCore::setMatrix(glm::mat4 matrix) {
 }
 
 
+const glm::mat4& TextureCore::getMatrix() const {
+  return matrix_;
+}
+
+
 void TextureCore::render(RenderState* renderState) {
   // post-multiply current texture matrix by local texture matrix
   renderState->textureStack.pushMatrix();
@@ -68,4 +74,9 @@ void TextureCore::renderPost(RenderState* renderState) {
 }
 
 
+void TextureCore::setDebugLabel(const std::string& label) {
+  GLDebug::setObjectLabel(GL_TEXTURE, tex_, label);
+}
+
+
 } /* namespace scg */
@@ -71,6 +71,11 @@ public:
    */
   TextureCore* setMatrix(glm::mat4 matrix);
 
+  /**
+   * Get texture matrix.
+   */
+  const glm::mat4& getMatrix() const;
+
   /**
    * Render core, i.e., post-multiply current texture matrix by local texture matrix.
    * Note: Derived classes must call this function at the beginning of their render() function.
@@ -83,6 +88,11 @@ public:
    */
   virtual void renderPost(RenderState* renderState);
 
+  /**
+   * Label texture object for GL debuggers (cf. GLDebug).
+   */
+  virtual void setDebugLabel(const std::string& label);
+
 protected:
 
   GLuint tex_;
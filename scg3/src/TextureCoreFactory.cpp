@@ -25,10 +25,15 @@
 #include <stdexcept>
 #include "BumpMapCore.h"
 #include "CubeMapCore.h"
+#include "ResourceCache.h"
 #include "scg_stb_image.h"
 #include "scg_utilities.h"
+#include "StreamedTexture2DCore.h"
 #include "Texture2DCore.h"
+#include "TextureContainer.h"
 #include "TextureCoreFactory.h"
+#include "TextureStreamer.h"
+#include "Tracer.h"
 
 namespace scg {
 
@@ -52,8 +57,19 @@ void TextureCoreFactory::addFilePath(const std::string& filePath) {
 }
 
 
+void TextureCoreFactory::setResourceCache(ResourceCacheSP resourceCache) {
+  resourceCache_ = resourceCache;
+}
+
+
+ResourceCacheSP TextureCoreFactory::getResourceCache() const {
+  return resourceCache_;
+}
+
+
 Texture2DCoreSP TextureCoreFactory::create2DTextureFromFile(const std::string& fileName,
     GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  SCG_TRACE_SCOPE_ARG("create 2D texture from file", fileName);
 
   // try to find file
   std::string fullFileName = getFullFileName(filePaths_, fileName);
@@ -62,6 +78,29 @@ Texture2DCoreSP TextureCoreFactory::create2DTextureFromFile(const std::string& f
         + " [TextureCoreFactory::create2DTextureFromFile()]");
   }
 
+  // return cached core (if any)
+  std::string key = ResourceCache::makeKey("texture2D:" + fullFileName,
+      {static_cast<double>(wrapModeS), static_cast<double>(wrapModeT),
+       static_cast<double>(minFilter), static_cast<double>(magFilter)});
+  auto cachedCore = std::static_pointer_cast<Texture2DCore>(findCached_(key));
+  if (cachedCore) {
+    return cachedCore;
+  }
+
+  // create texture core from pre-baked texture container
+  auto core = Texture2DCore::create();
+  if (TextureContainer::isContainerFile(fullFileName)) {
+    auto container = TextureContainer::load(fullFileName);
+    core->setTexture(*container, wrapModeS, wrapModeT, minFilter, magFilter);
+    core->setDebugLabel(fileName);
+    size_t bytes = 0;
+    for (int level = 0; level < container->getNLevels(); ++level) {
+      bytes += container->getSize(level);
+    }
+    insertCached_(key, core, bytes);
+    return core;
+  }
+
   // load image and create array with 4 components (RGBA)
   int width, height, dummy;
   unsigned char* rgbaData = stbi_load(fullFileName.c_str(), &width, &height, &dummy, 4);
@@ -70,19 +109,92 @@ Texture2DCoreSP TextureCoreFactory::create2DTextureFromFile(const std::string& f
         + " [TextureCoreFactory::create2DTextureFromFile()]");
   }
 
-  // create texture core
-  auto core = Texture2DCore::create();
+  // set texture from image
   core->setTexture(width, height, rgbaData, wrapModeS, wrapModeT, minFilter, magFilter);
+  core->setDebugLabel(fileName);
 
   // free image memory and return texture core
   stbi_image_free(rgbaData);
+  insertCached_(key, core, 4 * width * height);
   return core;
 }
 
 
+void TextureCoreFactory::bake2DTextureFile(const std::string& fileName,
+    const std::string& containerFileName, bool isSRGB) {
+  SCG_TRACE_SCOPE_ARG("bake 2D texture file", fileName);
+
+  // try to find file
+  std::string fullFileName = getFullFileName(filePaths_, fileName);
+  if (fullFileName.empty()) {
+    throw std::runtime_error("Cannot open file" + fileName
+        + " [TextureCoreFactory::bake2DTextureFile()]");
+  }
+
+  // load image and create array with 4 components (RGBA)
+  int width, height, dummy;
+  unsigned char* rgbaData = stbi_load(fullFileName.c_str(), &width, &height, &dummy, 4);
+  if (!rgbaData) {
+    throw std::runtime_error("stb_image error: " + std::string(stbi_failure_reason())
+        + " [TextureCoreFactory::bake2DTextureFile()]");
+  }
+
+  // compute mipmap chain and save container file
+  auto container = TextureContainer::createFromRGBA(width, height, rgbaData, isSRGB);
+  stbi_image_free(rgbaData);
+  container->save(containerFileName);
+}
+
+
+StreamedTexture2DCoreSP TextureCoreFactory::createStreamed2DTextureFromFile(
+    const std::string& fileName, TextureStreamerSP streamer, GLenum wrapModeS,
+    GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  SCG_TRACE_SCOPE_ARG("create streamed 2D texture from file", fileName);
+  assert(streamer);
+
+  // try to find file
+  std::string fullFileName = getFullFileName(filePaths_, fileName);
+  if (fullFileName.empty()) {
+    throw std::runtime_error("Cannot open file" + fileName
+        + " [TextureCoreFactory::createStreamed2DTextureFromFile()]");
+  }
+
+  // memory-map texture container or compute mipmap chain of image
+  TextureContainerSP container;
+  if (TextureContainer::isContainerFile(fullFileName)) {
+    container = TextureContainer::load(fullFileName);
+  }
+  else {
+    int width, height, dummy;
+    unsigned char* rgbaData = stbi_load(fullFileName.c_str(), &width, &height, &dummy, 4);
+    if (!rgbaData) {
+      throw std::runtime_error("stb_image error: " + std::string(stbi_failure_reason())
+          + " [TextureCoreFactory::createStreamed2DTextureFromFile()]");
+    }
+    container = TextureContainer::createFromRGBA(width, height, rgbaData);
+    stbi_image_free(rgbaData);
+  }
+
+  // create texture core with low-resolution levels
+  return streamer->createTexture(container, wrapModeS, wrapModeT, minFilter, magFilter);
+}
+
+
 BumpMapCoreSP TextureCoreFactory::createBumpMapFromFiles(const std::string& texFileName,
     const std::string& normalFileName, GLenum wrapModeS, GLenum wrapModeT,
     GLenum minFilter, GLenum magFilter) {
+  SCG_TRACE_SCOPE_ARG("create bump map from files", texFileName);
+
+  // return cached core (if any)
+  std::string key = ResourceCache::makeKey("bumpMap:" + getFullFileName(filePaths_, texFileName)
+      + ":" + getFullFileName(filePaths_, normalFileName),
+      {static_cast<double>(wrapModeS), static_cast<double>(wrapModeT),
+       static_cast<double>(minFilter), static_cast<double>(magFilter)});
+  auto cachedCore = std::static_pointer_cast<BumpMapCore>(findCached_(key));
+  if (cachedCore) {
+    return cachedCore;
+  }
+  size_t bytes = 0;
 
   // create bump map core
   auto core = BumpMapCore::create();
@@ -103,6 +215,7 @@ BumpMapCoreSP TextureCoreFactory::createBumpMapFromFiles(const std::string& texF
           + " [TextureCoreFactory::createBumpMapFromFiles()]");
     }
     core->setTexture(width, height, rgbaData, wrapModeS, wrapModeT, minFilter, magFilter);
+    bytes += 4 * width * height;
 
     // free image memory
     stbi_image_free(rgbaData);
@@ -123,17 +236,30 @@ BumpMapCoreSP TextureCoreFactory::createBumpMapFromFiles(const std::string& texF
         + " [TextureCoreFactory::createBumpMapFromFiles()]");
   }
   core->setNormalMap(width, height, rgbaData, wrapModeS, wrapModeT, minFilter, magFilter);
+  bytes += 4 * width * height;
 
   // free image memory and return bump map core
   stbi_image_free(rgbaData);
+  insertCached_(key, core, bytes);
   return core;
 }
 
 
 CubeMapCoreSP TextureCoreFactory::createCubeMapFromFiles(const std::vector<std::string>& fileNames) {
+  SCG_TRACE_SCOPE("create cube map from files");
 
   assert(fileNames.size() == 6);
 
+  // return cached core (if any)
+  std::string key = "cubeMap";
+  for (auto& fileName : fileNames) {
+    key += ":" + getFullFileName(filePaths_, fileName);
+  }
+  auto cachedCore = std::static_pointer_cast<CubeMapCore>(findCached_(key));
+  if (cachedCore) {
+    return cachedCore;
+  }
+
   int width, height, dummy;
   std::vector<unsigned char*> rgbaData;
   for (int i = 0; i < 6; ++i) {
@@ -160,6 +286,7 @@ CubeMapCoreSP TextureCoreFactory::createCubeMapFromFiles(const std::vector<std::
   for (int i = 0; i < 6; ++i) {
     stbi_image_free(rgbaData[i]);
   }
+  insertCached_(key, core, 6 * 4 * width * height);
   return core;
 }
 
@@ -170,4 +297,19 @@ CubeMapCoreSP TextureCoreFactory::createCubeMapFromFiles(std::vector<std::string
 }
 
 
+
+CoreSP TextureCoreFactory::findCached_(const std::string& key) const {
+  if (!resourceCache_) {
+    return nullptr;
+  }
+  return resourceCache_->find(key);
+}
+
+
+void TextureCoreFactory::insertCached_(const std::string& key, CoreSP core, size_t bytes) const {
+  if (resourceCache_) {
+    resourceCache_->insert(key, core, bytes);
+  }
+}
+
 } /* namespace scg */
@@ -66,11 +66,25 @@ public:
    */
   void addFilePath(const std::string& filePath);
 
+  /**
+   * Set resource cache to share texture cores loaded from identical files with identical
+   * parameters (nullptr: no caching, default). Streamed textures are not cached.
+   */
+  void setResourceCache(ResourceCacheSP resourceCache);
+
+  /**
+   * Get resource cache (nullptr if caching is disabled).
+   */
+  ResourceCacheSP getResourceCache() const;
+
   /**
    * Load texture image from source file and create a 2D texture with given parameters.
    * If minFilter is GL_*_MIPMAP_* (see below), a mipmap is created from the
    * given image.
    *
+   * Pre-baked texture container files (cf. bake2DTextureFile()) are detected by their
+   * magic number and uploaded including their mipmap levels without decoding.
+   *
    * \param fileName file name to be searched for in known file paths
    * \param wrapModeS GL_CLAMP, GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE,
    *    GL_MIRRORED_REPEAT, or GL_REPEAT
@@ -83,6 +97,36 @@ public:
   Texture2DCoreSP create2DTextureFromFile(const std::string& fileName,
       GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter);
 
+  /**
+   * Load texture image from source file, compute its mipmap chain, and save it as
+   * pre-baked texture container file (cf. TextureContainer) to be loaded by
+   * create2DTextureFromFile().
+   *
+   * \param fileName image file name to be searched for in known file paths
+   * \param containerFileName full file name of container file, e.g., "wood_256.scgt"
+   * \param isSRGB true if image is sRGB-encoded, i.e., mipmap filtering is to be
+   *    gamma-correct (false for normal maps etc.)
+   */
+  void bake2DTextureFile(const std::string& fileName, const std::string& containerFileName,
+      bool isSRGB = true);
+
+  /**
+   * Create a 2D texture whose mipmap levels are streamed by the given texture streamer,
+   * initially with only its low-resolution levels resident (cf. TextureStreamer).
+   * Texture container files are memory-mapped, other image files are decoded
+   * and their mipmap chain is computed in memory.
+   *
+   * \param fileName file name to be searched for in known file paths
+   * \param streamer texture streamer managing the texture
+   * \param wrapModeS see create2DTextureFromFile()
+   * \param wrapModeT see create2DTextureFromFile()
+   * \param minFilter see create2DTextureFromFile()
+   * \param magFilter see create2DTextureFromFile()
+   */
+  StreamedTexture2DCoreSP createStreamed2DTextureFromFile(const std::string& fileName,
+      TextureStreamerSP streamer, GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter,
+      GLenum magFilter);
+
   /**
    * Load texture (optional) and normal map images from source files and create a bump map
    * with given parameters.
@@ -117,9 +161,24 @@ public:
    */
   CubeMapCoreSP createCubeMapFromFiles(std::vector<std::string>&& fileNames);
 
+protected:
+
+  /**
+   * Find texture core in resource cache (if any).
+   * \return cached core, or nullptr
+   */
+  CoreSP findCached_(const std::string& key) const;
+
+  /**
+   * Insert texture core into resource cache (if any).
+   * \param bytes size of uploaded image data
+   */
+  void insertCached_(const std::string& key, CoreSP core, size_t bytes) const;
+
 protected:
 
   std::vector<std::string> filePaths_;
+  ResourceCacheSP resourceCache_;
 
 };
 
@@ -0,0 +1,57 @@
+/**
+ * \file TextureLayerCore.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TextureLayerCore.h"
+
+namespace scg {
+
+
+TextureLayerCore::TextureLayerCore(GLint layer)
+    : TextureCore(), layer_(layer) {
+  setLayerScaling(glm::vec2(1.f, 1.f));
+}
+
+
+TextureLayerCore::~TextureLayerCore() {
+}
+
+
+TextureLayerCoreSP TextureLayerCore::create(GLint layer) {
+  return std::make_shared<TextureLayerCore>(layer);
+}
+
+
+GLint TextureLayerCore::getLayer() const {
+  return layer_;
+}
+
+
+TextureLayerCore* TextureLayerCore::setLayerScaling(glm::vec2 scaling) {
+  // store layer index as r texture coordinate
+  matrix_ = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.f, 0.f, static_cast<GLfloat>(layer_))),
+      glm::vec3(scaling, 1.f));
+  return this;
+}
+
+
+} /* namespace scg */
@@ -0,0 +1,89 @@
+/**
+ * \file TextureLayerCore.h
+ * \brief A texture core that selects a layer of a Texture2DArrayCore.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEXTURELAYERCORE_H_
+#define TEXTURELAYERCORE_H_
+
+#include "scg_glew_glad.h"
+#include "scg_internals.h"
+#include "TextureCore.h"
+
+namespace scg {
+
+
+/**
+ * \brief A texture core that selects a layer of a Texture2DArrayCore.
+ *
+ * The layer index and the texture coordinate scaling of the layer are expressed
+ * by the texture matrix, i.e., texture coordinates (s,t,0,1) are transformed to
+ * (s*sx, t*sy, layer, 1). No texture object is bound, the array texture has to be
+ * applied by an ancestor node (or earlier in the same shape), combined with
+ * a shader using texture2d_array_modulate.glsl.
+ *
+ * Layer cores are created by TextureArrayBuilder.
+ * Since they do not bind a texture object, shapes referring to different layers of the
+ * same array texture can be merged into a single draw batch by StaticBatch.
+ */
+class TextureLayerCore: public TextureCore {
+
+public:
+
+  /**
+   * Constructor with layer index.
+   */
+  TextureLayerCore(GLint layer);
+
+  /**
+   * Destructor.
+   */
+  virtual ~TextureLayerCore();
+
+  /**
+   * Create shared pointer with layer index.
+   */
+  static TextureLayerCoreSP create(GLint layer);
+
+  /**
+   * Get layer index.
+   */
+  GLint getLayer() const;
+
+  /**
+   * Set texture coordinate scaling of the layer, e.g., if the texture image
+   * is smaller than the array texture, and update texture matrix.
+   *
+   * \return this pointer for method chaining
+   */
+  TextureLayerCore* setLayerScaling(glm::vec2 scaling);
+
+protected:
+
+  GLint layer_;
+
+};
+
+
+} /* namespace scg */
+
+#endif /* TEXTURELAYERCORE_H_ */
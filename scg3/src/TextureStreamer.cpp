@@ -0,0 +1,311 @@
+/**
+ * \file TextureStreamer.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "StreamedTexture2DCore.h"
+#include "TextureContainer.h"
+#include "TextureStreamer.h"
+#include "Tracer.h"
+
+namespace scg {
+
+
+TextureStreamer::TextureStreamer(size_t budget)
+    : budget_(budget), uploadLimit_(16 * 1024 * 1024), fullResolutionDistance_(2.f),
+      minResidentSize_(64), residentBytes_(0), pendingBytes_(0), uploadedBytes_(0),
+      nPendingRequests_(0), frame_(0), isStopped_(false) {
+  worker_ = std::thread(&TextureStreamer::run_, this);
+}
+
+
+TextureStreamer::~TextureStreamer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  requestCondition_.notify_all();
+  worker_.join();
+}
+
+
+TextureStreamerSP TextureStreamer::create(size_t budget) {
+  return std::make_shared<TextureStreamer>(budget);
+}
+
+
+size_t TextureStreamer::getBudget() const {
+  return budget_;
+}
+
+
+TextureStreamer* TextureStreamer::setBudget(size_t budget) {
+  budget_ = budget;
+  return this;
+}
+
+
+TextureStreamer* TextureStreamer::setUploadLimit(size_t uploadLimit) {
+  uploadLimit_ = uploadLimit;
+  return this;
+}
+
+
+TextureStreamer* TextureStreamer::setFullResolutionDistance(GLfloat distance) {
+  assert(distance > 0.f);
+  fullResolutionDistance_ = distance;
+  return this;
+}
+
+
+TextureStreamer* TextureStreamer::setMinResidentSize(GLsizei size) {
+  minResidentSize_ = size;
+  return this;
+}
+
+
+StreamedTexture2DCoreSP TextureStreamer::createTexture(TextureContainerSP container,
+    GLenum wrapModeS, GLenum wrapModeT, GLenum minFilter, GLenum magFilter) {
+  assert(container);
+  auto core = StreamedTexture2DCore::create(container, wrapModeS, wrapModeT, minFilter, magFilter);
+
+  // upload low-resolution levels, i.e., all levels not exceeding the minimum resident size
+  int level = container->getNLevels() - 1;
+  while (level > 0 && container->getWidth(level - 1) <= minResidentSize_
+      && container->getHeight(level - 1) <= minResidentSize_) {
+    --level;
+  }
+  core->minResidentLevel_ = level;
+  core->requestedLevel_ = level;
+  core->lastUsedFrame_ = frame_;
+  core->setResidentLevel_(level, std::vector<std::vector<unsigned char>>());
+  residentBytes_ += core->getResidentBytes();
+
+  textures_.push_back(core);
+  return core;
+}
+
+
+int TextureStreamer::getNTextures() const {
+  return static_cast<int>(textures_.size());
+}
+
+
+size_t TextureStreamer::getResidentBytes() const {
+  return residentBytes_;
+}
+
+
+int TextureStreamer::getNPendingRequests() const {
+  return nPendingRequests_;
+}
+
+
+size_t TextureStreamer::getUploadedBytes() const {
+  return uploadedBytes_;
+}
+
+
+void TextureStreamer::processFrame() {
+  SCG_TRACE_SCOPE("texture streaming");
+  ++frame_;
+  uploadedBytes_ = 0;
+
+  // remove deleted textures, update requested levels of textures rendered since last update
+  textures_.erase(std::remove_if(textures_.begin(), textures_.end(),
+      [](const std::weak_ptr<StreamedTexture2DCore>& texture) { return texture.expired(); }),
+      textures_.end());
+  std::vector<StreamedTexture2DCoreSP> cores;
+  residentBytes_ = 0;
+  for (auto& texture : textures_) {
+    auto core = texture.lock();
+    if (core->isUsed_) {
+      core->lastUsedFrame_ = frame_;
+      core->requestedLevel_ = getRequestedLevel_(core.get());
+      core->isUsed_ = false;
+      core->viewDistance_ = std::numeric_limits<GLfloat>::max();
+    }
+    residentBytes_ += core->getResidentBytes();
+    cores.push_back(core);
+  }
+
+  // upload levels read by worker thread, keep remaining ones for next frame if limit is exceeded
+  std::deque<Request> results;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    results.swap(results_);
+  }
+  while (!results.empty()) {
+    Request& result = results.front();
+    auto core = result.core.lock();
+    if (core) {
+      if (uploadedBytes_ > 0 && uploadedBytes_ + result.bytes > uploadLimit_) {
+        break;
+      }
+      assert(core->residentLevel_ == result.residentLevel);
+      residentBytes_ -= core->getResidentBytes();
+      core->setResidentLevel_(result.level, result.levelData);
+      residentBytes_ += core->getResidentBytes();
+      core->pendingLevel_ = -1;
+      uploadedBytes_ += result.bytes;
+    }
+    pendingBytes_ -= result.bytes;
+    --nPendingRequests_;
+    results.pop_front();
+  }
+  if (!results.empty()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    results_.insert(results_.begin(), std::make_move_iterator(results.begin()),
+        std::make_move_iterator(results.end()));
+  }
+
+  // request finer levels of textures rendered since last update, nearest textures first
+  std::vector<StreamedTexture2DCoreSP> candidates;
+  for (auto& core : cores) {
+    if (core->lastUsedFrame_ == frame_ && core->pendingLevel_ < 0
+        && core->requestedLevel_ < core->residentLevel_) {
+      candidates.push_back(core);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+      [](const StreamedTexture2DCoreSP& a, const StreamedTexture2DCoreSP& b) {
+        return a->requestedLevel_ < b->requestedLevel_;
+      });
+  bool hasRequests = false;
+  for (auto& core : candidates) {
+    // request coarser level if requested level does not fit into budget
+    int level = core->requestedLevel_;
+    while (level < core->residentLevel_
+        && !evict_(core->getLevelBytes(level) - core->getResidentBytes(), core.get())) {
+      ++level;
+    }
+    if (level == core->residentLevel_) {
+      continue;
+    }
+    Request request;
+    request.core = core;
+    request.container = core->container_;
+    request.level = level;
+    request.residentLevel = core->residentLevel_;
+    request.bytes = core->getLevelBytes(level) - core->getResidentBytes();
+    core->pendingLevel_ = level;
+    pendingBytes_ += request.bytes;
+    ++nPendingRequests_;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      requests_.push_back(std::move(request));
+    }
+    hasRequests = true;
+  }
+  if (hasRequests) {
+    requestCondition_.notify_one();
+  }
+
+  // evict textures if budget has been reduced
+  evict_(0, nullptr);
+}
+
+
+void TextureStreamer::update(double currTime) {
+  if (isRunning_) {
+    Animation::update(currTime);
+    processFrame();
+  }
+}
+
+
+void TextureStreamer::run_() {
+  Tracer::setThreadName("texture streamer");
+  while (true) {
+    Request request;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      requestCondition_.wait(lock, [this]() { return isStopped_ || !requests_.empty(); });
+      if (isStopped_) {
+        return;
+      }
+      request = std::move(requests_.front());
+      requests_.pop_front();
+    }
+
+    // copy levels from memory-mapped container, i.e., read file outside of render thread
+    SCG_TRACE_SCOPE("read texture levels");
+    for (int level = request.level; level < request.residentLevel; ++level) {
+      const unsigned char* data = request.container->getData(level);
+      request.levelData.push_back(std::vector<unsigned char>(data,
+          data + request.container->getSize(level)));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    results_.push_back(std::move(request));
+  }
+}
+
+
+int TextureStreamer::getRequestedLevel_(const StreamedTexture2DCore* core) const {
+  int level = 0;
+  if (core->viewDistance_ > fullResolutionDistance_) {
+    level = static_cast<int>(std::log2(core->viewDistance_ / fullResolutionDistance_));
+  }
+  return std::min(level, core->minResidentLevel_);
+}
+
+
+bool TextureStreamer::evict_(size_t requiredBytes, const StreamedTexture2DCore* requester) {
+  if (residentBytes_ + pendingBytes_ + requiredBytes <= budget_) {
+    return true;
+  }
+
+  // collect textures with levels not needed, least recently used first
+  std::vector<StreamedTexture2DCoreSP> candidates;
+  for (auto& texture : textures_) {
+    auto core = texture.lock();
+    if (core && core.get() != requester && core->pendingLevel_ < 0) {
+      int level = (core->lastUsedFrame_ < frame_) ? core->minResidentLevel_ : core->requestedLevel_;
+      if (level > core->residentLevel_) {
+        candidates.push_back(core);
+      }
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+      [](const StreamedTexture2DCoreSP& a, const StreamedTexture2DCoreSP& b) {
+        return a->lastUsedFrame_ < b->lastUsedFrame_;
+      });
+
+  // reduce residency until required bytes fit into budget
+  for (auto& core : candidates) {
+    int level = (core->lastUsedFrame_ < frame_) ? core->minResidentLevel_ : core->requestedLevel_;
+    residentBytes_ -= core->getResidentBytes();
+    core->setResidentLevel_(level, std::vector<std::vector<unsigned char>>());
+    residentBytes_ += core->getResidentBytes();
+    if (residentBytes_ + pendingBytes_ + requiredBytes <= budget_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+} /* namespace scg */
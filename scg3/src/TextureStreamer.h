@@ -0,0 +1,223 @@
+/**
+ * \file TextureStreamer.h
+ * \brief A manager that streams mipmap levels of textures into GPU memory under a memory budget.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEXTURESTREAMER_H_
+#define TEXTURESTREAMER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "scg_glew_glad.h"
+#include "Animation.h"
+#include "scg_internals.h"
+
+namespace scg {
+
+
+/**
+ * \brief A manager that streams mipmap levels of textures into GPU memory under a memory budget.
+ *
+ * Streamed textures (StreamedTexture2DCore) are created from texture containers,
+ * initially with only the low-resolution levels resident, i.e., all levels not exceeding
+ * the minimum resident size. Each frame, the streamer determines the requested level
+ * of each texture rendered in the previous frame from its view distance:
+ * level 0 is requested up to the full resolution distance, and each doubling
+ * of the distance drops one level.
+ *
+ * Finer levels are read from the (memory-mapped) container files by a worker thread,
+ * such that the render thread only uploads the prepared data, limited to a maximum
+ * number of bytes per frame. If the requested residency exceeds the budget, the least
+ * recently used textures are evicted down to their low-resolution levels.
+ *
+ * The streamer is updated once per frame by update() (cf. Animation) or by processFrame(),
+ * both to be called with active OpenGL context.
+ *
+ * Example:
+ * \code
+ * auto streamer = TextureStreamer::create(128 * 1024 * 1024);
+ * auto texCore = textureFactory.createStreamed2DTextureFromFile("brick.scgt", streamer,
+ *     GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
+ * ...
+ * viewer->addAnimation(streamer);
+ * viewer->startAnimations();
+ * \endcode
+ */
+class TextureStreamer: public Animation {
+
+public:
+
+  /**
+   * Constructor with GPU memory budget (bytes), starts worker thread.
+   */
+  explicit TextureStreamer(size_t budget = 256 * 1024 * 1024);
+
+  /**
+   * Destructor, stops worker thread.
+   */
+  virtual ~TextureStreamer();
+
+  /**
+   * Create shared pointer with GPU memory budget (bytes).
+   */
+  static TextureStreamerSP create(size_t budget = 256 * 1024 * 1024);
+
+  /**
+   * Get GPU memory budget (bytes).
+   */
+  size_t getBudget() const;
+
+  /**
+   * Set GPU memory budget (bytes). Textures are evicted on next update if necessary.
+   * \return this pointer for method chaining
+   */
+  TextureStreamer* setBudget(size_t budget);
+
+  /**
+   * Set maximum number of bytes to be uploaded per frame (default: 16 MiB).
+   * \return this pointer for method chaining
+   */
+  TextureStreamer* setUploadLimit(size_t uploadLimit);
+
+  /**
+   * Set view distance up to which level 0 is requested (default: 2).
+   * \return this pointer for method chaining
+   */
+  TextureStreamer* setFullResolutionDistance(GLfloat distance);
+
+  /**
+   * Set maximum width and height of levels that are always resident (default: 64).
+   * Applies to textures created afterwards.
+   * \return this pointer for method chaining
+   */
+  TextureStreamer* setMinResidentSize(GLsizei size);
+
+  /**
+   * Create streamed texture from texture container with given parameters
+   * (cf. Texture2DCore::setTexture()), upload low-resolution levels.
+   */
+  StreamedTexture2DCoreSP createTexture(TextureContainerSP container,
+      GLenum wrapModeS = GL_REPEAT, GLenum wrapModeT = GL_REPEAT,
+      GLenum minFilter = GL_LINEAR_MIPMAP_LINEAR, GLenum magFilter = GL_LINEAR);
+
+  /**
+   * Get number of managed textures.
+   */
+  int getNTextures() const;
+
+  /**
+   * Get GPU memory occupied by resident levels of all managed textures (bytes).
+   */
+  size_t getResidentBytes() const;
+
+  /**
+   * Get number of requested levels not yet uploaded, i.e., being read by the worker thread
+   * or waiting for upload.
+   */
+  int getNPendingRequests() const;
+
+  /**
+   * Get number of bytes uploaded by last update.
+   */
+  size_t getUploadedBytes() const;
+
+  /**
+   * Update residency once per frame: upload levels read by the worker thread,
+   * request finer levels of recently rendered textures, evict least recently used textures.
+   */
+  void processFrame();
+
+  /**
+   * Update animation with given time, i.e., call processFrame() if running.
+   *
+   * \param currTime current time (seconds)
+   */
+  virtual void update(double currTime);
+
+protected:
+
+  /**
+   * Level request to be processed by the worker thread.
+   */
+  struct Request {
+    std::weak_ptr<StreamedTexture2DCore> core;
+    TextureContainerSP container;
+    int level;
+    int residentLevel;
+    size_t bytes;
+    std::vector<std::vector<unsigned char>> levelData;
+  };
+
+  /**
+   * Worker thread: copy level data of requests from their containers.
+   */
+  void run_();
+
+  /**
+   * Determine requested level from view distance.
+   */
+  int getRequestedLevel_(const StreamedTexture2DCore* core) const;
+
+  /**
+   * Evict least recently used textures (not used in current frame first) until
+   * the given number of additional bytes fits into the budget.
+   * \return true if the additional bytes fit into the budget
+   */
+  bool evict_(size_t requiredBytes, const StreamedTexture2DCore* requester);
+
+protected:
+
+  size_t budget_;
+  size_t uploadLimit_;
+  GLfloat fullResolutionDistance_;
+  GLsizei minResidentSize_;
+  std::vector<std::weak_ptr<StreamedTexture2DCore>> textures_;
+  size_t residentBytes_;
+  size_t pendingBytes_;
+  size_t uploadedBytes_;
+  int nPendingRequests_;
+  unsigned long frame_;
+
+  std::thread worker_;
+  std::mutex mutex_;
+  std::condition_variable requestCondition_;
+  std::deque<Request> requests_;
+  std::deque<Request> results_;
+  bool isStopped_;
+
+private:
+
+  /**
+   * Disallow copy constructor and assignment operator.
+   */
+  SCG_DISALLOW_COPY_AND_ASSIGN(TextureStreamer);
+
+};
+
+
+} /* namespace scg */
+
+#endif /* TEXTURESTREAMER_H_ */
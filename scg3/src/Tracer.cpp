@@ -0,0 +1,250 @@
+/**
+ * \file Tracer.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "Tracer.h"
+
+namespace scg {
+
+
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  int64_t startTime;
+  int64_t endTime;
+  char arg[TraceScope::MAX_ARG_LENGTH + 1];
+};
+
+// ring buffer written by its thread only, read by writeChromeTrace()
+struct ThreadBuffer {
+  ThreadBuffer() : threadID(0), nEvents(0) {}
+  int threadID;
+  std::string threadName;
+  std::vector<TraceEvent> events;
+  std::atomic<uint64_t> nEvents;
+};
+
+// buffers are kept until program exit, they may outlive their threads
+struct Registry {
+  Registry() : bufferSize(32768) {}
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  size_t bufferSize;
+};
+
+Registry& getRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+thread_local ThreadBuffer* threadBuffer = nullptr;
+
+ThreadBuffer* getThreadBuffer() {
+  if (!threadBuffer) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer));
+    threadBuffer = registry.buffers.back().get();
+    threadBuffer->threadID = static_cast<int>(registry.buffers.size());
+  }
+  return threadBuffer;
+}
+
+void writeEscaped(std::ostream& out, const char* str) {
+  for (const char* c = str; *c; ++c) {
+    switch (*c) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    default:
+      if (static_cast<unsigned char>(*c) < 0x20) {
+        char buf[8];
+        std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(*c));
+        out << buf;
+      }
+      else {
+        out << *c;
+      }
+    }
+  }
+}
+
+} /* namespace */
+
+
+std::atomic<bool> Tracer::isEnabled_(false);
+
+
+void Tracer::setEnabled(bool isEnabled) {
+  getTime();    // start clock
+  isEnabled_.store(isEnabled, std::memory_order_relaxed);
+}
+
+
+void Tracer::setBufferSize(size_t nEvents) {
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.bufferSize = std::max(nEvents, static_cast<size_t>(1));
+}
+
+
+void Tracer::setThreadName(const std::string& name) {
+  ThreadBuffer* buffer = getThreadBuffer();
+  std::lock_guard<std::mutex> lock(getRegistry().mutex);
+  buffer->threadName = name;
+}
+
+
+void Tracer::clear() {
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& buffer : registry.buffers) {
+    if (buffer->nEvents.load(std::memory_order_acquire) > 0) {
+      buffer->nEvents.store(0, std::memory_order_release);
+    }
+  }
+}
+
+
+size_t Tracer::getNEvents() {
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  size_t nEvents = 0;
+  for (auto& buffer : registry.buffers) {
+    uint64_t n = buffer->nEvents.load(std::memory_order_acquire);
+    if (n > 0) {
+      nEvents += static_cast<size_t>(std::min(n, static_cast<uint64_t>(buffer->events.size())));
+    }
+  }
+  return nEvents;
+}
+
+
+void Tracer::writeChromeTrace(const std::string& fileName) {
+  std::ofstream out(fileName.c_str());
+  if (!out) {
+    throw std::runtime_error("Cannot open file " + fileName + " [Tracer::writeChromeTrace()]");
+  }
+
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  char ts[64];
+  bool isFirst = true;
+  out << "{\"traceEvents\":[";
+  for (auto& buffer : registry.buffers) {
+    // thread name as metadata event
+    if (!buffer->threadName.empty()) {
+      out << (isFirst ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+          << buffer->threadID << ",\"args\":{\"name\":\"";
+      writeEscaped(out, buffer->threadName.c_str());
+      out << "\"}}";
+      isFirst = false;
+    }
+
+    // events buffered in ring, oldest first; the writing thread may continue to record,
+    // therefore each event is copied and skipped if its slot may have been overwritten
+    // in the meantime (event n is written into slot n % size before count n + 1 is stored)
+    uint64_t n = buffer->nEvents.load(std::memory_order_acquire);
+    if (n == 0) {
+      continue;
+    }
+    uint64_t size = buffer->events.size();
+    for (uint64_t i = (n > size) ? n - size : 0; i < n; ++i) {
+      TraceEvent event = buffer->events[i % size];
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (buffer->nEvents.load(std::memory_order_relaxed) >= i + size) {
+        continue;
+      }
+      event.arg[TraceScope::MAX_ARG_LENGTH] = '\0';
+      std::snprintf(ts, sizeof(ts), "\"ts\":%.3f,\"dur\":%.3f",
+          1.e-3 * event.startTime, 1.e-3 * (event.endTime - event.startTime));
+      out << (isFirst ? "" : ",") << "\n{\"name\":\"";
+      writeEscaped(out, event.name);
+      out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadID << "," << ts;
+      if (event.arg[0]) {
+        out << ",\"args\":{\"arg\":\"";
+        writeEscaped(out, event.arg);
+        out << "\"}";
+      }
+      out << "}";
+      isFirst = false;
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  if (!out) {
+    throw std::runtime_error("Cannot write file " + fileName + " [Tracer::writeChromeTrace()]");
+  }
+}
+
+
+int64_t Tracer::getTime() {
+  static const auto startTime = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - startTime).count();
+}
+
+
+void Tracer::addEvent(const char* name, const char* arg, int64_t startTime, int64_t endTime) {
+  ThreadBuffer* buffer = getThreadBuffer();
+  uint64_t n = buffer->nEvents.load(std::memory_order_relaxed);
+  if (buffer->events.empty()) {
+    // allocate on first event, before the event count becomes visible
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffer->events.resize(registry.bufferSize);
+  }
+  TraceEvent& event = buffer->events[n % buffer->events.size()];
+  event.name = name;
+  event.startTime = startTime;
+  event.endTime = endTime;
+  std::strcpy(event.arg, arg ? arg : "");
+  buffer->nEvents.store(n + 1, std::memory_order_release);
+}
+
+
+void TraceScope::begin_(const char* name, const std::string* arg) {
+  name_ = name;
+  arg_[0] = '\0';
+  if (arg) {
+    // keep tail of long arguments, e.g., file names with long paths
+    size_t length = arg->size();
+    size_t offset = (length > MAX_ARG_LENGTH) ? length - MAX_ARG_LENGTH : 0;
+    std::memcpy(arg_, arg->c_str() + offset, length - offset + 1);
+  }
+  startTime_ = Tracer::getTime();
+}
+
+
+} /* namespace scg */
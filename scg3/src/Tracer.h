@@ -0,0 +1,214 @@
+/**
+ * \file Tracer.h
+ * \brief Lightweight trace scopes buffered per thread and exported as Chrome trace JSON.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRACER_H_
+#define TRACER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace scg {
+
+
+/**
+ * \brief Lightweight trace scopes buffered per thread and exported as Chrome trace JSON.
+ *
+ * Trace scopes are placed by the macros SCG_TRACE_SCOPE(name) and
+ * SCG_TRACE_SCOPE_ARG(name, arg), where name has to be a string literal and arg is
+ * a string (e.g., a file name) shown as argument of the event:
+ * \code
+ * void f(const std::string& fileName) {
+ *   SCG_TRACE_SCOPE_ARG("load file", fileName);
+ *   ...
+ * }
+ * \endcode
+ *
+ * Tracing is disabled at runtime by default, then a scope costs a single atomic load.
+ * Defining SCG_DISABLE_TRACING (CMake option SCG_TRACING=OFF) removes all scopes at
+ * compile time.
+ *
+ * When enabled, each thread records complete events into its own ring buffer without
+ * locking, older events are overwritten when the buffer is full. writeChromeTrace()
+ * writes the buffered events of all threads in Chrome trace event format, to be opened
+ * with chrome://tracing or https://ui.perfetto.dev. Events overwritten by their threads
+ * during export are skipped, such that the export is complete only if all writing threads
+ * are quiescent, i.e., tracing is disabled and worker threads (e.g., of TextureStreamer,
+ * FrameCapture) have finished their scopes.
+ *
+ * The KeyboardController toggles tracing by key 't', writing file scg3_trace.json
+ * when tracing is switched off.
+ */
+class Tracer {
+
+public:
+
+  /**
+   * Check if tracing is enabled.
+   */
+  static bool isEnabled() {
+    return isEnabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Enable or disable tracing (default: false).
+   */
+  static void setEnabled(bool isEnabled);
+
+  /**
+   * Set capacity of per-thread ring buffers (number of events) allocated after this call
+   * (default: 32768).
+   */
+  static void setBufferSize(size_t nEvents);
+
+  /**
+   * Set name of calling thread, shown in trace viewer.
+   */
+  static void setThreadName(const std::string& name);
+
+  /**
+   * Discard all buffered events. Tracing should be disabled.
+   */
+  static void clear();
+
+  /**
+   * Get number of events currently buffered for all threads.
+   */
+  static size_t getNEvents();
+
+  /**
+   * Write buffered events of all threads to Chrome trace JSON file, skipping events
+   * overwritten during export (see above).
+   * Throws an exception if the file cannot be written.
+   */
+  static void writeChromeTrace(const std::string& fileName);
+
+  /**
+   * Get current time stamp (nanoseconds since first call).
+   */
+  static int64_t getTime();
+
+  /**
+   * Record complete event of calling thread, called by TraceScope.
+   *
+   * \param name event name with static storage duration (string literal)
+   * \param arg event argument, may be null or empty
+   * \param startTime start time (nanoseconds, cf. getTime())
+   * \param endTime end time (nanoseconds, cf. getTime())
+   */
+  static void addEvent(const char* name, const char* arg, int64_t startTime, int64_t endTime);
+
+private:
+
+  Tracer();
+
+  static std::atomic<bool> isEnabled_;
+
+};
+
+
+/**
+ * \brief Trace scope recording a complete event from construction to destruction,
+ *    to be used by the macros SCG_TRACE_SCOPE() and SCG_TRACE_SCOPE_ARG().
+ */
+class TraceScope {
+
+public:
+
+  /**
+   * Maximum length of event argument, longer arguments keep their tail.
+   */
+  static const size_t MAX_ARG_LENGTH = 63;
+
+  /**
+   * Constructor with event name (string literal).
+   */
+  explicit TraceScope(const char* name)
+      : name_(nullptr) {
+    if (Tracer::isEnabled()) {
+      begin_(name, nullptr);
+    }
+  }
+
+  /**
+   * Constructor with event name (string literal) and argument.
+   */
+  TraceScope(const char* name, const std::string& arg)
+      : name_(nullptr) {
+    if (Tracer::isEnabled()) {
+      begin_(name, &arg);
+    }
+  }
+
+  /**
+   * Destructor, records event if tracing was enabled at construction.
+   */
+  ~TraceScope() {
+    if (name_) {
+      Tracer::addEvent(name_, arg_, startTime_, Tracer::getTime());
+    }
+  }
+
+private:
+
+  void begin_(const char* name, const std::string* arg);
+
+  const char* name_;
+  int64_t startTime_;
+  char arg_[MAX_ARG_LENGTH + 1];
+
+  TraceScope(const TraceScope&);
+  TraceScope& operator=(const TraceScope&);
+
+};
+
+
+} /* namespace scg */
+
+
+#ifndef SCG_DISABLE_TRACING
+
+#define SCG_TRACE_CONCAT_(a, b) a##b
+#define SCG_TRACE_CONCAT(a, b) SCG_TRACE_CONCAT_(a, b)
+
+/**
+ * Trace current scope as event with given name (string literal).
+ */
+#define SCG_TRACE_SCOPE(name) \
+  scg::TraceScope SCG_TRACE_CONCAT(scgTraceScope_, __LINE__)(name)
+
+/**
+ * Trace current scope as event with given name (string literal) and argument (string).
+ */
+#define SCG_TRACE_SCOPE_ARG(name, arg) \
+  scg::TraceScope SCG_TRACE_CONCAT(scgTraceScope_, __LINE__)(name, arg)
+
+#else
+
+#define SCG_TRACE_SCOPE(name)
+#define SCG_TRACE_SCOPE_ARG(name, arg)
+
+#endif
+
+#endif /* TRACER_H_ */
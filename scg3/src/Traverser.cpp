@@ -27,7 +27,7 @@ namespace scg {
 
 
 Traverser::Traverser(RenderState* renderState)
-    : renderState_(renderState) {
+    : renderState_(renderState), frameProfiler_(nullptr) {
 }
 
 
@@ -45,6 +45,11 @@ void Traverser::visitShape(Shape* node) {
 }
 
 
+void Traverser::visitStaticBatch(StaticBatch* node) {
+  // do nothing by default
+}
+
+
 void Traverser::visitCamera(Camera* node) {
   // do nothing by default
 }
@@ -75,6 +80,26 @@ void Traverser::visitPostLight(Light* node) {
 }
 
 
+void Traverser::visitLightCluster(LightCluster* node) {
+  // do nothing by default
+}
+
+
+void Traverser::visitPostLightCluster(LightCluster* node) {
+  // do nothing by default
+}
+
+
+void Traverser::visitShadowMap(ShadowMap* node) {
+  // do nothing by default
+}
+
+
+void Traverser::visitPostShadowMap(ShadowMap* node) {
+  // do nothing by default
+}
+
+
 void Traverser::visitTransformation(Transformation* node) {
   // do nothing by default
 }
@@ -47,6 +47,21 @@ public:
    */
   virtual ~Traverser() = 0;
 
+  /**
+   * Get frame profiler for timing of tagged sub-trees, may be null.
+   */
+  FrameProfiler* getFrameProfiler() const {
+    return frameProfiler_;
+  }
+
+  /**
+   * Set frame profiler for timing of tagged sub-trees (cf. Node::setMetaInfo()
+   * and FrameProfiler::META_INFO_KEY), may be null (default).
+   */
+  void setFrameProfiler(FrameProfiler* frameProfiler) {
+    frameProfiler_ = frameProfiler;
+  }
+
   // leaf nodes
 
   /**
@@ -59,6 +74,11 @@ public:
    */
   virtual void visitShape(Shape* node);
 
+  /**
+   * Visit StaticBatch node.
+   */
+  virtual void visitStaticBatch(StaticBatch* node);
+
   // composite nodes
 
   /**
@@ -91,6 +111,26 @@ public:
    */
   virtual void visitPostLight(Light* node);
 
+  /**
+   * Visit LightCluster node.
+   */
+  virtual void visitLightCluster(LightCluster* node);
+
+  /**
+   * Visit LightCluster node after traversing sub-tree.
+   */
+  virtual void visitPostLightCluster(LightCluster* node);
+
+  /**
+   * Visit ShadowMap node.
+   */
+  virtual void visitShadowMap(ShadowMap* node);
+
+  /**
+   * Visit ShadowMap node after traversing sub-tree.
+   */
+  virtual void visitPostShadowMap(ShadowMap* node);
+
   /**
    * Visit Transformation node.
    */
@@ -104,6 +144,7 @@ public:
 protected:
 
   RenderState* renderState_;
+  FrameProfiler* frameProfiler_;
 
 };
 
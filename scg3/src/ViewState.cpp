@@ -26,14 +26,19 @@
 #include <iostream>
 #include "scg_glew_glad.h"
 #include <GLFW/glfw3.h>
+#include "GLDebug.h"
 #include "ViewState.h"
 
 namespace scg {
 
 
+static const size_t FRAME_TIME_WINDOW = 120;
+
+
 ViewState::ViewState()
-    : isMouseCursorVisible_(true), isAnimationLocked_(false),
-      isFrameRateOutput_(false), frameRateInterval_(3.), frameRate_(0.) {
+    : window_(nullptr), isMouseCursorVisible_(true), isAnimationLocked_(false),
+      isFrameRateOutput_(false), isHUDVisible_(false), frameRateInterval_(3.), frameRate_(0.),
+      nFrames_(-1), nextFrameTime_(0), frameProfiler_(new FrameProfiler) {
 }
 
 
@@ -81,6 +86,16 @@ void ViewState::setFrameRateOutput(bool isOutput) {
 }
 
 
+bool ViewState::isHUDVisible() const {
+  return isHUDVisible_;
+}
+
+
+void ViewState::setHUDVisible(bool isVisible) {
+  isHUDVisible_ = isVisible;
+}
+
+
 void ViewState::setFrameRateInterval(double intervalSeconds) {
   frameRateInterval_ = intervalSeconds;
 }
@@ -91,20 +106,65 @@ double ViewState::getFrameRate() const {
 }
 
 
+FrameTimeStats ViewState::getFrameTimeStats() const {
+  return FrameProfiler::computeStats(frameTimes_);
+}
+
+
+double ViewState::getLastFrameTime() const {
+  if (frameTimes_.empty()) {
+    return 0.;
+  }
+  return frameTimes_[(nextFrameTime_ + FRAME_TIME_WINDOW - 1) % FRAME_TIME_WINDOW];
+}
+
+
+FrameProfiler* ViewState::getFrameProfiler() const {
+  return frameProfiler_.get();
+}
+
+
 void ViewState::updateFrameRate() {
+  auto currTime = std::chrono::steady_clock::now();
+
+  // first call starts measurement
+  if (nFrames_ < 0) {
+    nFrames_ = 0;
+    lastTime_ = currTime;
+    lastFrameTime_ = currTime;
+    return;
+  }
+
+  // frame time of last frame (ring buffer)
+  double frameTime = std::chrono::duration<double, std::milli>(currTime - lastFrameTime_).count();
+  lastFrameTime_ = currTime;
+  if (frameTimes_.size() < FRAME_TIME_WINDOW) {
+    frameTimes_.push_back(frameTime);
+  }
+  else {
+    frameTimes_[nextFrameTime_] = frameTime;
+  }
+  nextFrameTime_ = (nextFrameTime_ + 1) % FRAME_TIME_WINDOW;
+
   if (frameRateInterval_ > DBL_EPSILON) {
-    static int nFrames = 0;
-    static double lastTime = glfwGetTime();
-    ++nFrames;
-    double currTime = glfwGetTime();
-    double diffTime = currTime - lastTime;
+    ++nFrames_;
+    double diffTime = std::chrono::duration<double>(currTime - lastTime_).count();
     if (diffTime > frameRateInterval_) {
-      frameRate_ = nFrames / diffTime;
-      nFrames = 0;
-      lastTime = currTime;
+      frameRate_ = nFrames_ / diffTime;
+      nFrames_ = 0;
+      lastTime_ = currTime;
       if (isFrameRateOutput_) {
+        auto stats = getFrameTimeStats();
         std::cout << "Frame rate: " << std::fixed << std::setw(6) << std::setprecision(1)
-            << frameRate_ << " FPS" << std::endl;
+            << frameRate_ << " FPS (frame time avg " << std::setprecision(2) << stats.avg
+            << " ms, p99 " << stats.p99 << " ms)" << std::endl;
+        if (frameProfiler_->isEnabled()) {
+          std::cout << frameProfiler_->getReport();
+        }
+        if (GLDebug::isActive() && GLDebug::getNPerformanceWarnings() > 0) {
+          std::cout << "GL performance warnings: " << GLDebug::getNPerformanceWarnings()
+              << std::endl;
+        }
       }
     }
   }
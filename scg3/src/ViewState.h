@@ -26,8 +26,12 @@
 #ifndef VIEWSTATE_H_
 #define VIEWSTATE_H_
 
+#include <chrono>
+#include <vector>
 #include "scg_glew_glad.h"
 #include <GLFW/glfw3.h>
+#include "FrameProfiler.h"
+#include "scg_internals.h"
 
 namespace scg {
 
@@ -90,6 +94,17 @@ public:
    */
   void setFrameRateOutput(bool isOutput);
 
+  /**
+   * Check visibility of performance HUD.
+   */
+  bool isHUDVisible() const;
+
+  /**
+   * Set visibility of performance HUD drawn by Viewer (default: false/hidden),
+   * cf. PerformanceHUD.
+   */
+  void setHUDVisible(bool isVisible);
+
   /**
    * Set interval for frame rate computation (default: 3 sec).
    *
@@ -104,7 +119,25 @@ public:
   double getFrameRate() const;
 
   /**
-   * Update frame rate, called by Viewer::startMainLoop().
+   * Get statistics of the frame times (milliseconds, time between consecutive frames)
+   * of the last 120 frames.
+   */
+  FrameTimeStats getFrameTimeStats() const;
+
+  /**
+   * Get frame time (milliseconds) of the last frame, 0 if not yet available.
+   */
+  double getLastFrameTime() const;
+
+  /**
+   * Get frame profiler, disabled by default (cf. FrameProfiler::setEnabled()).
+   */
+  FrameProfiler* getFrameProfiler() const;
+
+  /**
+   * Update frame rate and frame time statistics, called by Viewer::startMainLoop().
+   * If frame rate output is enabled, the report of an enabled frame profiler is
+   * printed as well.
    */
   void updateFrameRate();
 
@@ -114,8 +147,15 @@ protected:
   bool isMouseCursorVisible_;
   bool isAnimationLocked_;
   bool isFrameRateOutput_;
+  bool isHUDVisible_;
   double frameRateInterval_;
   double frameRate_;
+  int nFrames_;
+  std::chrono::steady_clock::time_point lastTime_;
+  std::chrono::steady_clock::time_point lastFrameTime_;
+  std::vector<double> frameTimes_;
+  size_t nextFrameTime_;
+  FrameProfilerUP frameProfiler_;
 
 };
 
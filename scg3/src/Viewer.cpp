@@ -22,32 +22,47 @@
  */
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include "Animation.h"
 #include "Camera.h"
 #include "Controller.h"
+#include "FrameCapture.h"
+#include "FrameProfiler.h"
+#include "GLDebug.h"
 #include "Group.h"
 #include "KeyboardController.h"
 #include "Light.h"
 #include "MouseController.h"
 #include "Node.h"
+#include "NullGL.h"
+#include "PerformanceHUD.h"
 #include "PerspectiveCamera.h"
 #include "Renderer.h"
 #include "ShaderCore.h"
 #include "ShaderCoreFactory.h"
 #include "StandardRenderer.h"
+#include "Tracer.h"
 #include "scg_glm.h"
 #include "scg_utilities.h"
 #include "Viewer.h"
 #include "ViewState.h"
 
+#ifdef SCG_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 namespace scg {
 
 
 Viewer::Viewer()
-    : window_(nullptr), viewState_(new ViewState) {
+    : window_(nullptr), viewState_(new ViewState), eglDisplay_(nullptr), eglContext_(nullptr),
+      eglSurface_(nullptr), frameBuffer_(0), renderBuffers_(), frameBufferWidth_(0),
+      frameBufferHeight_(0) {
   if (isInstantiated_) {
     throw std::runtime_error("Cannot instantiate more than one Viewer [Viewer::Viewer()]");
   }
@@ -56,6 +71,25 @@ Viewer::Viewer()
 
 
 Viewer::~Viewer() {
+  if (frameCapture_) {
+    frameCapture_->finish();
+    frameCapture_.reset();
+  }
+  performanceHUD_.reset();
+  if (frameBuffer_ != 0 && isGLContextActive()) {
+    glDeleteFramebuffers(1, &frameBuffer_);
+    glDeleteRenderbuffers(2, renderBuffers_);
+  }
+#ifdef SCG_HEADLESS_EGL
+  if (eglContext_) {
+    eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (eglSurface_) {
+      eglDestroySurface(eglDisplay_, eglSurface_);
+    }
+    eglDestroyContext(eglDisplay_, eglContext_);
+    eglTerminate(eglDisplay_);
+  }
+#endif
   glfwTerminate();
   glfwSetErrorCallback(nullptr);
 }
@@ -75,13 +109,26 @@ Viewer* Viewer::setOpenGLConfig(const OGLConfig& oglConfig) {
 Viewer* Viewer::init(RendererSP renderer) {
   assert(renderer);
   renderer_ = renderer;
+  Tracer::setThreadName("main");
+  if (oglConfig_.nullGL) {
+    oglConfig_.headless = true;
+  }
+  renderer_->setFrameProfiler(viewState_->getFrameProfiler());
 
-  // initialize GLFW
+  // initialize GLFW (null platform in headless mode, if available)
   glfwSetErrorCallback(errorCB_);
+#ifdef GLFW_PLATFORM_NULL
+  if (oglConfig_.headless) {
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+  }
+#endif
   int retCode = glfwInit();
-  if (retCode == GL_FALSE) {
+  if (retCode == GL_FALSE && !oglConfig_.headless) {
     throw std::runtime_error("glfwInit() failed [Viewer::init()]");
   }
+  // headless mode: offscreen context may still be created by EGL,
+  // timing does not depend on GLFW (cf. getTime())
+  getTime();
 
   // set OpenGL configuration
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, oglConfig_.versionMajor);
@@ -93,6 +140,7 @@ Viewer* Viewer::init(RendererSP renderer) {
   if (oglVersion_ >= 302) {   // OpenGL 3.2 or higher
     glfwWindowHint(GLFW_OPENGL_PROFILE, static_cast<int>(oglConfig_.profile));
   }
+  glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, oglConfig_.debug ? GL_TRUE : GL_FALSE);
 
   // initialize OpenGL parameters specific for render strategy
   renderer_->initViewer(this, &frameBufferSize_);
@@ -195,8 +243,14 @@ Viewer* Viewer::addAnimations(std::vector<AnimationSP>&& animations) {
 }
 
 
+Viewer* Viewer::setFrameCapture(FrameCaptureSP frameCapture) {
+  frameCapture_ = frameCapture;
+  return this;
+}
+
+
 Viewer* Viewer::startAnimations() {
-  double currTime = glfwGetTime();
+  double currTime = getTime();
 
   for (auto animation : animations_) {
     animation->start(currTime);
@@ -206,11 +260,20 @@ Viewer* Viewer::startAnimations() {
 
 
 void Viewer::getWindowSize(int& width, int& height) const {
+  if (oglConfig_.headless) {
+    width = frameBufferWidth_;
+    height = frameBufferHeight_;
+    return;
+  }
   glfwGetWindowSize(window_, &width, &height);
 }
 
 
 Viewer* Viewer::setWindowSize(int width, int height) {
+  if (oglConfig_.headless) {
+    createFrameBuffer_(width, height);
+    return this;
+  }
   glfwSetWindowSize(window_, width, height);
   return this;
 }
@@ -225,7 +288,9 @@ bool Viewer::isWindowResized() {
 
 
 Viewer* Viewer::setWindowTitle(const char* title) {
-  glfwSetWindowTitle(window_, title);
+  if (window_ && !oglConfig_.headless) {
+    glfwSetWindowTitle(window_, title);
+  }
   return this;
 }
 
@@ -248,6 +313,10 @@ void Viewer::startMainLoop() {
   if (!renderer_) {
     throw std::runtime_error("Undefined renderer, call Viewer::init() first [Viewer::render()]");
   }
+  if (oglConfig_.headless) {
+    throw std::runtime_error("No main loop in headless mode, call Viewer::renderFrames() instead"
+        " [Viewer::render()]");
+  }
   if (!window_) {
     throw std::runtime_error("No open window, call Viewer::createWindow() first [Viewer::render()]");
   }
@@ -256,24 +325,47 @@ void Viewer::startMainLoop() {
 
   // main loop
   while (!glfwWindowShouldClose(window_)) {
+    renderFrame_();
+  }
+  if (frameCapture_) {
+    frameCapture_->finish();
+  }
+}
 
-    // check controllers for input and update animations
-    processControllers_();
-    processAnimations_();
 
-    // let renderer display scene
-    glClear(frameBufferClearMask_);
-    renderer_->render();
-    glfwSwapBuffers(window_);
+void Viewer::renderFrames(int nFrames) {
+  assert(nFrames >= 0);
+  if (!renderer_) {
+    throw std::runtime_error("Undefined renderer, call Viewer::init() first [Viewer::renderFrames()]");
+  }
+  if (!window_ && frameBuffer_ == 0) {
+    throw std::runtime_error("No open window, call Viewer::createWindow() first"
+        " [Viewer::renderFrames()]");
+  }
+
+  for (int i = 0; i < nFrames; ++i) {
+    renderFrame_();
+  }
+}
 
-    // update frame rate
-    viewState_->updateFrameRate();
 
-    // poll events, e.g., Alt-F4
-    glfwPollEvents();
+bool Viewer::isHeadless() const {
+  return oglConfig_.headless;
+}
 
-    assert(!checkGLError());
-  }
+
+GLuint Viewer::getFrameBufferObject() const {
+  return frameBuffer_;
+}
+
+
+ViewState* Viewer::getViewState() const {
+  return viewState_.get();
+}
+
+
+PerformanceHUD* Viewer::getPerformanceHUD() const {
+  return performanceHUD_.get();
 }
 
 
@@ -282,37 +374,67 @@ void Viewer::createWindow_(const char* title, int width, int height, bool fullsc
     throw std::runtime_error("Undefined renderer, call Viewer::init() first [Viewer::createWindow_()]");
   }
 
-  // open window and create OpenGL context
-  GLFWmonitor* monitorPtr = fullscreenMode ? glfwGetPrimaryMonitor() : nullptr;
-  window_ = glfwCreateWindow(width, height, title, monitorPtr, nullptr);
-  if (!window_) {
-    throw std::runtime_error("glfwCreateWindow() failed [Viewer::createWindow_()]");
+  if (oglConfig_.nullGL) {
+    // no context: entry points of null backend are loaded below
   }
-  glfwMakeContextCurrent(window_);
-  viewState_->setWindow(window_);
-  isWindowResized_ = true;    // trigger update of camera projection
+  else if (oglConfig_.headless) {
+    // create offscreen context instead of window
+    createHeadlessContext_();
+  }
+  else {
+    // open window and create OpenGL context
+    GLFWmonitor* monitorPtr = fullscreenMode ? glfwGetPrimaryMonitor() : nullptr;
+    window_ = glfwCreateWindow(width, height, title, monitorPtr, nullptr);
+    if (!window_) {
+      throw std::runtime_error("glfwCreateWindow() failed [Viewer::createWindow_()]");
+    }
+    glfwMakeContextCurrent(window_);
+    viewState_->setWindow(window_);
 
-  // synchronize frame rate with vertical display frequency
-  glfwSwapInterval(1);
+    // synchronize frame rate with vertical display frequency (unless disabled)
+    glfwSwapInterval(oglConfig_.swapInterval);
 
-  // register callback functions
-  glfwSetFramebufferSizeCallback(window_, framebufferSizeCB_);
+    // register callback functions
+    glfwSetFramebufferSizeCallback(window_, framebufferSizeCB_);
+  }
+  isWindowResized_ = true;    // trigger update of camera projection
 
+  if (oglConfig_.nullGL) {
+    NullGL::load();
+  }
 #ifndef SCG_GLAD_VERSION
   // initialize GLEW
-  GLenum error = glewInit();
-  if (error != GLEW_OK) {
-    throw std::runtime_error(std::string("glewInit() failed: ") + (const char*) glewGetErrorString(error)
-        + " [Viewer::createWindow_()]");
+  else {
+    GLenum error = glewInit();
+    if (error != GLEW_OK) {
+      throw std::runtime_error(std::string("glewInit() failed: ") + (const char*) glewGetErrorString(error)
+          + " [Viewer::createWindow_()]");
+    }
+    glGetError();   // ignore GL error (invalid enum) in glewInit
   }
-  glGetError();   // ignore GL error (invalid enum) in glewInit
 #else
   // experimental: initialize Glad
-  if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-    throw std::runtime_error("gladLoadGLLoader() failed [Viewer::createWindow_()]");
+  else {
+#ifdef SCG_HEADLESS_EGL
+    GLADloadproc loadProc = eglContext_ ? (GLADloadproc) eglGetProcAddress
+        : (GLADloadproc) glfwGetProcAddress;
+#else
+    GLADloadproc loadProc = (GLADloadproc) glfwGetProcAddress;
+#endif
+    if (!gladLoadGLLoader(loadProc)) {
+      throw std::runtime_error("gladLoadGLLoader() failed [Viewer::createWindow_()]");
+    }
   }
 #endif
 
+  // debug output replaces polling of GL errors (cf. checkGLError())
+  bool isDebugOutput = oglConfig_.debug && !oglConfig_.nullGL && GLDebug::init();
+
+  // headless mode: render into frame buffer object
+  if (oglConfig_.headless) {
+    createFrameBuffer_(width, height);
+  }
+
   // set OpenGL parameters
   glEnable(GL_DEPTH_TEST);
   glClearColor(oglConfig_.clearColor[0], oglConfig_.clearColor[1], oglConfig_.clearColor[2],
@@ -325,6 +447,9 @@ void Viewer::createWindow_(const char* title, int width, int height, bool fullsc
   std::cout << "GL vendor: " << (const char*) glGetString(GL_VENDOR) << std::endl;
   std::cout << "GL renderer: " << (const char*) glGetString(GL_RENDERER) << std::endl;
   std::cout << "GLSL version: " << (const char*) glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
+  if (oglConfig_.debug && !oglConfig_.nullGL) {
+    std::cout << "GL debug output: " << (isDebugOutput ? "enabled" : "not supported") << std::endl;
+  }
 #ifndef SCG_GLAD_VERSION
   std::cout << "GLEW version: " << glewGetString(GLEW_VERSION) << std::endl;
 #else
@@ -343,6 +468,186 @@ void Viewer::createWindow_(const char* title, int width, int height, bool fullsc
 }
 
 
+void Viewer::createHeadlessContext_() {
+#ifdef SCG_HEADLESS_EGL
+  // EGL display of surfaceless platform (no display server required) or default display
+  EGLDisplay display = EGL_NO_DISPLAY;
+  const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  if (clientExtensions && strstr(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+        eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay) {
+      display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+  }
+  if (display == EGL_NO_DISPLAY) {
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  EGLint eglMajor, eglMinor;
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, &eglMajor, &eglMinor)
+      || !eglBindAPI(EGL_OPENGL_API)) {
+    throw std::runtime_error("Cannot initialize EGL [Viewer::createHeadlessContext_()]");
+  }
+  eglDisplay_ = display;
+
+  // context attributes corresponding to OpenGL configuration
+  std::vector<EGLint> contextAttribs = {
+      EGL_CONTEXT_MAJOR_VERSION, oglConfig_.versionMajor,
+      EGL_CONTEXT_MINOR_VERSION, oglConfig_.versionMinor };
+  if (oglVersion_ >= 300 && oglConfig_.forwardCompatible) {
+    contextAttribs.insert(contextAttribs.end(), { EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE, EGL_TRUE });
+  }
+  if (oglVersion_ >= 302) {
+    contextAttribs.insert(contextAttribs.end(), { EGL_CONTEXT_OPENGL_PROFILE_MASK,
+        oglConfig_.profile == OGLProfile::COMPATIBILITY
+        ? EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT : EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT });
+  }
+  if (oglConfig_.debug) {
+    contextAttribs.insert(contextAttribs.end(), { EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE });
+  }
+  contextAttribs.push_back(EGL_NONE);
+
+  // context with 1x1 pbuffer surface if available, otherwise surfaceless context
+  // (the frame buffer object is created later)
+  const EGLint configAttribs[] = {
+      EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+  EGLConfig config = nullptr;
+  EGLint nConfigs = 0;
+  if (!eglChooseConfig(display, configAttribs, &config, 1, &nConfigs)) {
+    nConfigs = 0;
+  }
+  EGLContext context = eglCreateContext(display, (nConfigs > 0) ? config : EGL_NO_CONFIG_KHR,
+      EGL_NO_CONTEXT, contextAttribs.data());
+  if (context == EGL_NO_CONTEXT) {
+    throw std::runtime_error("eglCreateContext() failed [Viewer::createHeadlessContext_()]");
+  }
+  eglContext_ = context;
+  EGLSurface surface = EGL_NO_SURFACE;
+  if (nConfigs > 0) {
+    const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    eglSurface_ = (surface != EGL_NO_SURFACE) ? surface : nullptr;
+  }
+  if (!eglMakeCurrent(display, surface, surface, context)) {
+    throw std::runtime_error("eglMakeCurrent() failed [Viewer::createHeadlessContext_()]");
+  }
+#else
+  // invisible window, OSMesa context on GLFW null platform
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef GLFW_PLATFORM_NULL
+  if (glfwGetPlatform() == GLFW_PLATFORM_NULL) {
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+  }
+#endif
+  window_ = glfwCreateWindow(1, 1, "", nullptr, nullptr);
+  if (!window_) {
+    throw std::runtime_error("glfwCreateWindow() failed [Viewer::createHeadlessContext_()]");
+  }
+  glfwMakeContextCurrent(window_);
+#endif
+}
+
+
+void Viewer::createFrameBuffer_(int width, int height) {
+  assert(width > 0 && height > 0);
+  if (frameBuffer_ == 0) {
+    glGenFramebuffers(1, &frameBuffer_);
+    glGenRenderbuffers(2, renderBuffers_);
+  }
+  frameBufferWidth_ = width;
+  frameBufferHeight_ = height;
+
+  // color buffer, combined depth and stencil buffer as requested by renderer
+  glBindRenderbuffer(GL_RENDERBUFFER, renderBuffers_[0]);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+      renderBuffers_[0]);
+  if (frameBufferSize_.depthbits > 0 || frameBufferSize_.stencilbits > 0) {
+    bool hasStencil = frameBufferSize_.stencilbits > 0;
+    glBindRenderbuffer(GL_RENDERBUFFER, renderBuffers_[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, hasStencil ? GL_DEPTH24_STENCIL8 : GL_DEPTH_COMPONENT24,
+        width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER,
+        hasStencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+        renderBuffers_[1]);
+  }
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    throw std::runtime_error("Frame buffer object is incomplete [Viewer::createFrameBuffer_()]");
+  }
+  glDrawBuffer(GL_COLOR_ATTACHMENT0);
+  glReadBuffer(GL_COLOR_ATTACHMENT0);
+
+  // adjust viewport, trigger update of camera projection
+  glViewport(0, 0, width, height);
+  isWindowResized_ = true;
+
+  assert(!checkGLError());
+}
+
+
+void Viewer::renderFrame_() {
+  SCG_TRACE_SCOPE("frame");
+  FrameProfiler* profiler = viewState_->getFrameProfiler();
+  profiler->beginFrame();
+
+  // check controllers for input and update animations
+  if (!oglConfig_.headless) {
+    FrameProfiler::Scope scope(profiler, FrameProfiler::CONTROLLERS);
+    SCG_TRACE_SCOPE("controllers");
+    processControllers_();
+  }
+  {
+    FrameProfiler::Scope scope(profiler, FrameProfiler::ANIMATIONS);
+    processAnimations_();
+  }
+
+  // let renderer display scene
+  glClear(frameBufferClearMask_);
+  {
+    SCG_TRACE_SCOPE("render");
+    renderer_->beginFrame();
+    renderer_->render();
+    renderer_->endFrame();
+  }
+
+  // draw performance HUD on top of the scene (if visible)
+  if (viewState_->isHUDVisible()) {
+    FrameProfiler::Scope scope(profiler, FrameProfiler::HUD);
+    SCG_TRACE_SCOPE("HUD");
+    if (!performanceHUD_) {
+      performanceHUD_.reset(new PerformanceHUD);
+    }
+    performanceHUD_->render(viewState_.get(), renderer_.get());
+  }
+  {
+    FrameProfiler::Scope scope(profiler, FrameProfiler::SWAP);
+    SCG_TRACE_SCOPE("swap");
+    if (frameCapture_) {
+      frameCapture_->capture();
+    }
+    if (!oglConfig_.headless) {
+      glfwSwapBuffers(window_);
+    }
+    else {
+      glFlush();
+    }
+  }
+  profiler->endFrame();
+
+  // update frame rate
+  viewState_->updateFrameRate();
+
+  // poll events, e.g., Alt-F4
+  if (!oglConfig_.headless) {
+    glfwPollEvents();
+  }
+
+  assert(!checkGLError());
+}
+
+
 void Viewer::processControllers_() {
   for (auto controller : controllers_) {
     controller->checkInput(viewState_.get());
@@ -352,9 +657,10 @@ void Viewer::processControllers_() {
 
 void Viewer::processAnimations_() {
   if (!(animations_.empty() || viewState_->isAnimationLocked())) {
-    double currTime = glfwGetTime();
+    double currTime = getTime();
 
     for (auto animation : animations_) {
+      SCG_TRACE_SCOPE("animation update");
       animation->update(currTime);
     }
   }
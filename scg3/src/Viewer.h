@@ -57,24 +57,53 @@ enum class OGLProfile: int {
  * - forward-compatible context
  * - core profile
  * - bright gray background color
+ * - frame rate synchronized with vertical display frequency (swap interval 1)
+ * - window (no headless mode)
+ * - debug context with debug output (cf. GLDebug) in debug builds, none if NDEBUG is defined
+ * - OpenGL driver (no null backend)
+ *
+ * In headless mode, Viewer::createWindow() creates an offscreen context with a frame buffer
+ * object instead of a window, e.g., for batch jobs and automated tests on servers without
+ * display. The context is created by EGL (surfaceless platform or pbuffer, macro
+ * SCG_HEADLESS_EGL, requires Glad) if available, otherwise by an invisible GLFW window
+ * (OSMesa context on the GLFW null platform, if available). Both work with software
+ * OpenGL implementations such as Mesa llvmpipe.
+ *
+ * With the null backend (implies headless mode, requires Glad), no OpenGL context is created
+ * at all; the entry points are replaced by no-op functions counting and optionally recording
+ * all calls (cf. NullGL), e.g., for CPU-only benchmarks and call stream validation.
  */
 struct OGLConfig {
 
   OGLConfig()
       : versionMajor(3), versionMinor(2), forwardCompatible(GL_TRUE), profile(OGLProfile::CORE),
-        clearColor(glm::vec4(0.15f, 0.15f, 0.15f, 1.0f)) {
+        clearColor(glm::vec4(0.15f, 0.15f, 0.15f, 1.0f)), swapInterval(1), headless(false),
+        debug(isDebugBuild()), nullGL(false) {
   }
 
   OGLConfig(int versionMajor0, int versionMinor0, GLboolean forwardCompatible0,
       OGLProfile profile0, glm::vec4 clearColor0)
       : versionMajor(versionMajor0), versionMinor(versionMinor0),
-        forwardCompatible(forwardCompatible0), profile(profile0), clearColor(clearColor0) {
+        forwardCompatible(forwardCompatible0), profile(profile0), clearColor(clearColor0),
+        swapInterval(1), headless(false), debug(isDebugBuild()), nullGL(false) {
+  }
+
+  static bool isDebugBuild() {
+#ifdef NDEBUG
+    return false;
+#else
+    return true;
+#endif
   }
 
   int versionMajor, versionMinor;
   GLboolean forwardCompatible;  // GL_TRUE requires OpenGL 3.0 or higher
   OGLProfile profile;        // CORE or COMPATIBILITY require OpenGL 3.2 or higher
   glm::vec4 clearColor;
+  int swapInterval;          // 0: no vertical synchronization, e.g., for benchmarks
+  bool headless;             // offscreen context without window (see above)
+  bool debug;                // debug context and debug output, requires KHR_debug
+  bool nullGL;               // null backend without context, implies headless (see above)
 
 };
 
@@ -195,6 +224,12 @@ public:
    */
   Viewer* addAnimations(std::vector<AnimationSP>&& animations);
 
+  /**
+   * Set frame capture, called after rendering each frame (nullptr to disable).
+   * \return this pointer for method chaining
+   */
+  Viewer* setFrameCapture(FrameCaptureSP frameCapture);
+
   /**
    * Start all animations.
    * \return this pointer for method chaining
@@ -202,12 +237,12 @@ public:
   Viewer* startAnimations();
 
   /**
-   * Get current window dimensions.
+   * Get current window dimensions (frame buffer dimensions in headless mode).
    */
   void getWindowSize(int& width, int& height) const;
 
   /**
-   * Set window dimensions.
+   * Set window dimensions (frame buffer dimensions in headless mode).
    * \return this pointer for method chaining
    */
   Viewer* setWindowSize(int width, int height);
@@ -227,6 +262,8 @@ public:
   /**
    * Create OpenGL context, open window with given title and dimensions,
    * and initialize GLEW.
+   * In headless mode (cf. OGLConfig), an offscreen context is created instead,
+   * rendering into a frame buffer object of the given dimensions.
    * \return this pointer for method chaining
    */
   Viewer* createWindow(const char* title, int width, int height);
@@ -240,9 +277,38 @@ public:
 
   /**
    * Start main loop, periodically check input devices and render scene.
+   * Not available in headless mode, use renderFrames() instead.
    */
   void startMainLoop();
 
+  /**
+   * Render given number of frames by the main loop logic (controllers, animations,
+   * rendering), without waiting for user input, e.g., for automated tests.
+   * Controllers are not checked in headless mode.
+   */
+  void renderFrames(int nFrames);
+
+  /**
+   * Check if viewer runs in headless mode (cf. OGLConfig).
+   */
+  bool isHeadless() const;
+
+  /**
+   * Get frame buffer object rendered into in headless mode, 0 otherwise.
+   */
+  GLuint getFrameBufferObject() const;
+
+  /**
+   * Get view state, e.g., to access frame time statistics and the frame profiler.
+   */
+  ViewState* getViewState() const;
+
+  /**
+   * Get performance HUD, created when it is shown for the first time
+   * (cf. ViewState::setHUDVisible()), nullptr before.
+   */
+  PerformanceHUD* getPerformanceHUD() const;
+
 protected:
 
   /**
@@ -252,6 +318,21 @@ protected:
    */
   void createWindow_(const char* title, int width, int height, bool fullscreenMode);
 
+  /**
+   * Create offscreen OpenGL context in headless mode, called by createWindow_().
+   */
+  void createHeadlessContext_();
+
+  /**
+   * Create or resize frame buffer object in headless mode and bind it.
+   */
+  void createFrameBuffer_(int width, int height);
+
+  /**
+   * Render one frame, called by startMainLoop() and renderFrames().
+   */
+  void renderFrame_();
+
   /**
    * Check controllers for input, called by startMainLoop().
    */
@@ -292,8 +373,16 @@ protected:
   RendererSP renderer_;
   std::vector<AnimationSP> animations_;
   std::vector<ControllerSP> controllers_;
+  FrameCaptureSP frameCapture_;
+  PerformanceHUDUP performanceHUD_;
   FrameBufferSize frameBufferSize_;
   GLbitfield frameBufferClearMask_;
+  void* eglDisplay_;                    // headless mode with EGL
+  void* eglContext_;
+  void* eglSurface_;
+  GLuint frameBuffer_;                  // headless mode
+  GLuint renderBuffers_[2];             // color, depth and stencil
+  int frameBufferWidth_, frameBufferHeight_;
 
 };
 
@@ -0,0 +1,82 @@
+/**
+ * \file scg_core_utilities.cpp
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include "scg_core_utilities.h"
+
+namespace scg {
+
+
+void formatFilePath(std::string& filePath) {
+  for (char& c : filePath) {
+    if (c == '\\') {
+      c = '/';
+    }
+  }
+  if (filePath.back() != '/') {
+     filePath += '/';
+   }
+}
+
+
+std::string getFullFileName(const std::vector<std::string>& filePaths, const std::string& fileName) {
+  // first try to open local file, then search known paths
+  std::string result;
+  std::ifstream istr(fileName.c_str());
+  if (istr.is_open()) {
+    istr.close();
+    result = fileName;
+  }
+  else {
+    for (auto filePath : filePaths) {
+      istr.open((filePath + fileName).c_str());
+      if (istr.is_open()) {
+        istr.close();
+        result = filePath + fileName;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+
+void splitFilePath(const std::string& filePath, std::vector<std::string>& splitPaths) {
+  std::string path;
+  size_t length = filePath.length();
+  size_t startPos = 0;
+  size_t endPos = length;
+  while (startPos < length) {
+    endPos = filePath.find_first_of(";,", startPos);
+    if (endPos == std::string::npos) {
+      endPos = length;
+    }
+    path = filePath.substr(startPos, endPos - startPos);
+    formatFilePath(path);
+    splitPaths.push_back(path);
+    startPos = endPos + 1;
+  }
+}
+
+
+} /* namespace scg */
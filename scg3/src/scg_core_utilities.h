@@ -0,0 +1,68 @@
+/**
+ * \file scg_core_utilities.h
+ * \brief Utility functions without OpenGL dependencies, part of the library scg3_assets.
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCG_CORE_UTILITIES_H_
+#define SCG_CORE_UTILITIES_H_
+
+#include <string>
+#include <vector>
+
+namespace scg {
+
+
+/**
+ * Pi constant.
+ */
+const float PI = 3.141592654f;
+
+
+/**
+ * \brief Replace backslashes by slashes and ensure that the last character is a slash.
+ */
+void formatFilePath(std::string& filePath);
+
+
+/**
+ * \brief Try to find file name in a list of file paths.
+ *
+ * The local directory is searched first.
+ *
+ * \return full file name including path, empty string if the file has not been found
+ */
+std::string getFullFileName(const std::vector<std::string>& filePaths, const std::string& fileName);
+
+
+/**
+ * \brief Split string containing one or more file paths into a vector of single paths.
+ *
+ * Allowed delimiters: ';' and ','.
+ *
+ * For each split path formatFilePath() is called.
+ */
+void splitFilePath(const std::string& filePath, std::vector<std::string>& splitPaths);
+
+
+} /* namespace scg */
+
+#endif /* SCG_CORE_UTILITIES_H_ */
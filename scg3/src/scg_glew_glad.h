@@ -40,4 +40,12 @@
 #include "../extern/glad/glad.h"
 #endif
 
+// check at runtime if an OpenGL extension is supported, e.g.,
+// SCG_GL_EXTENSION_SUPPORTED(ARB_multi_draw_indirect)
+#ifndef SCG_GLAD_VERSION
+#define SCG_GL_EXTENSION_SUPPORTED(_ext) (GLEW_##_ext)
+#else
+#define SCG_GL_EXTENSION_SUPPORTED(_ext) (GLAD_GL_##_ext)
+#endif
+
 #endif /* SCG_GLEW_H_ */
@@ -36,11 +36,17 @@ const OGLAttrib OGLConstants::TEX_COORD_0 = { "vTexCoord0", 3 };
 const OGLAttrib OGLConstants::TEX_COORD_1 = { "vTexCoord1", 4 };
 const OGLAttrib OGLConstants::TANGENT = { "vTangent", 5 };
 const OGLAttrib OGLConstants::BINORMAL = { "vBinormal", 6 };
+const OGLAttrib OGLConstants::DRAW_INDEX = { "vDrawIndex", 7 };
 
 const OGLFragData OGLConstants::FRAG_COLOR = { "fragColor", 0 };
+const OGLFragData OGLConstants::G_ALBEDO = { "gAlbedo", 1 };
+const OGLFragData OGLConstants::G_SPECULAR = { "gSpecular", 2 };
+const OGLFragData OGLConstants::G_NORMAL = { "gNormal", 3 };
 
 const OGLUniformBlock OGLConstants::LIGHT = { "LightBlock", 0 };
 const OGLUniformBlock OGLConstants::MATERIAL = { "MaterialBlock", 1 };
+const OGLUniformBlock OGLConstants::LIGHT_CLUSTER = { "LightClusterBlock", 2 };
+const OGLUniformBlock OGLConstants::SHADOW = { "ShadowBlock", 3 };
 
 const char* OGLConstants::MODEL_VIEW_MATRIX = "modelViewMatrix";
 const char* OGLConstants::PROJECTION_MATRIX = "projectionMatrix";
@@ -50,10 +56,23 @@ const char* OGLConstants::TEXTURE_MATRIX = "textureMatrix";
 const char* OGLConstants::COLOR_MATRIX = "colorMatrix";
 const char* OGLConstants::N_LIGHTS = "nLights";
 const char* OGLConstants::GLOBAL_AMBIENT_LIGHT = "globalAmbientLight";
+const char* OGLConstants::MATERIAL_INDEX = "materialIndex";
 const char* OGLConstants::TIME = "time";
 
 const OGLSampler OGLConstants::TEXTURE0 = { "texture0", 0 };
 const OGLSampler OGLConstants::TEXTURE1 = { "texture1", 1 };
+const OGLSampler OGLConstants::DRAW_DATA = { "drawData", 2 };
+const OGLSampler OGLConstants::CLUSTER_LIGHTS = { "clusterLights", 3 };
+const OGLSampler OGLConstants::CLUSTER_LIGHT_INDICES = { "clusterLightIndices", 4 };
+const OGLSampler OGLConstants::CLUSTER_GRID = { "clusterGrid", 5 };
+const OGLSampler OGLConstants::MATERIALS = { "materials", 6 };
+const OGLSampler OGLConstants::SHADOW_MAP = { "shadowMap", 7 };
+const OGLSampler OGLConstants::G_BUFFER_BASE = { "gBufferBase", 8 };
+const OGLSampler OGLConstants::G_BUFFER_ALBEDO = { "gBufferAlbedo", 9 };
+const OGLSampler OGLConstants::G_BUFFER_SPECULAR = { "gBufferSpecular", 10 };
+const OGLSampler OGLConstants::G_BUFFER_NORMAL = { "gBufferNormal", 11 };
+const OGLSampler OGLConstants::G_BUFFER_DEPTH = { "gBufferDepth", 12 };
+const OGLSampler OGLConstants::DEFERRED_LIGHTS = { "deferredLights", 13 };
 
 
 void OGLConstants::bindAttribFragDataLocations(GLuint program) {
@@ -64,8 +83,12 @@ void OGLConstants::bindAttribFragDataLocations(GLuint program) {
   glBindAttribLocation(program, TEX_COORD_1.location, TEX_COORD_1.name);
   glBindAttribLocation(program, TANGENT.location, TANGENT.name);
   glBindAttribLocation(program, BINORMAL.location, BINORMAL.name);
+  glBindAttribLocation(program, DRAW_INDEX.location, DRAW_INDEX.name);
 
   glBindFragDataLocation(program, FRAG_COLOR.location, FRAG_COLOR.name);
+  glBindFragDataLocation(program, G_ALBEDO.location, G_ALBEDO.name);
+  glBindFragDataLocation(program, G_SPECULAR.location, G_SPECULAR.name);
+  glBindFragDataLocation(program, G_NORMAL.location, G_NORMAL.name);
 
   assert(!checkGLError());
 }
@@ -80,6 +103,14 @@ void OGLConstants::bindUniformBlocks(GLuint program) {
   if (materialIndex != GL_INVALID_INDEX) {
     glUniformBlockBinding(program, materialIndex, MATERIAL.bindingPoint);
   }
+  GLuint lightClusterIndex = glGetUniformBlockIndex(program, LIGHT_CLUSTER.name);
+  if (lightClusterIndex != GL_INVALID_INDEX) {
+    glUniformBlockBinding(program, lightClusterIndex, LIGHT_CLUSTER.bindingPoint);
+  }
+  GLuint shadowIndex = glGetUniformBlockIndex(program, SHADOW.name);
+  if (shadowIndex != GL_INVALID_INDEX) {
+    glUniformBlockBinding(program, shadowIndex, SHADOW.bindingPoint);
+  }
 
   assert(!checkGLError());
 }
@@ -90,6 +121,19 @@ void OGLConstants::bindSamplers(GLuint program) {
   SCG_SAVE_AND_SWITCH_PROGRAM(program, programOld);
   glUniform1i(glGetUniformLocation(program, TEXTURE0.name), TEXTURE0.texUnit);
   glUniform1i(glGetUniformLocation(program, TEXTURE1.name), TEXTURE1.texUnit);
+  glUniform1i(glGetUniformLocation(program, DRAW_DATA.name), DRAW_DATA.texUnit);
+  glUniform1i(glGetUniformLocation(program, CLUSTER_LIGHTS.name), CLUSTER_LIGHTS.texUnit);
+  glUniform1i(glGetUniformLocation(program, CLUSTER_LIGHT_INDICES.name),
+      CLUSTER_LIGHT_INDICES.texUnit);
+  glUniform1i(glGetUniformLocation(program, CLUSTER_GRID.name), CLUSTER_GRID.texUnit);
+  glUniform1i(glGetUniformLocation(program, MATERIALS.name), MATERIALS.texUnit);
+  glUniform1i(glGetUniformLocation(program, SHADOW_MAP.name), SHADOW_MAP.texUnit);
+  glUniform1i(glGetUniformLocation(program, G_BUFFER_BASE.name), G_BUFFER_BASE.texUnit);
+  glUniform1i(glGetUniformLocation(program, G_BUFFER_ALBEDO.name), G_BUFFER_ALBEDO.texUnit);
+  glUniform1i(glGetUniformLocation(program, G_BUFFER_SPECULAR.name), G_BUFFER_SPECULAR.texUnit);
+  glUniform1i(glGetUniformLocation(program, G_BUFFER_NORMAL.name), G_BUFFER_NORMAL.texUnit);
+  glUniform1i(glGetUniformLocation(program, G_BUFFER_DEPTH.name), G_BUFFER_DEPTH.texUnit);
+  glUniform1i(glGetUniformLocation(program, DEFERRED_LIGHTS.name), DEFERRED_LIGHTS.texUnit);
   SCG_RESTORE_PROGRAM(program, programOld);
 
   assert(!checkGLError());
@@ -151,6 +151,10 @@ SCG_DECLARE_CLASS(Controller);
 SCG_DECLARE_CLASS(ColorCore);
 SCG_DECLARE_CLASS(Core);
 SCG_DECLARE_CLASS(CubeMapCore);
+SCG_DECLARE_CLASS(DeferredRenderer);
+SCG_DECLARE_CLASS(FrameCapture);
+SCG_DECLARE_CLASS(FrameProfiler);
+SCG_DECLARE_CLASS(FrameSink);
 SCG_DECLARE_CLASS(GeometryCore);
 SCG_DECLARE_CLASS(GeometryCoreFactory);
 SCG_DECLARE_CLASS(Group);
@@ -158,21 +162,37 @@ SCG_DECLARE_CLASS(InfoTraverser);
 SCG_DECLARE_CLASS(KeyboardController);
 SCG_DECLARE_CLASS(Leaf);
 SCG_DECLARE_CLASS(Light);
+SCG_DECLARE_CLASS(LightCluster);
 SCG_DECLARE_CLASS(LightPosition);
 SCG_DECLARE_CLASS(MaterialCore);
+SCG_DECLARE_CLASS(MaterialTable);
 SCG_DECLARE_CLASS(MouseController);
 SCG_DECLARE_CLASS(Node);
 SCG_DECLARE_CLASS(OrthographicCamera);
+SCG_DECLARE_CLASS(PerformanceHUD);
 SCG_DECLARE_CLASS(PerspectiveCamera);
+SCG_DECLARE_CLASS(PipeSink);
+SCG_DECLARE_CLASS(PNGFileSink);
 SCG_DECLARE_CLASS(PreTraverser);
+SCG_DECLARE_CLASS(RawFileSink);
 SCG_DECLARE_CLASS(Renderer);
 SCG_DECLARE_CLASS(RenderState);
 SCG_DECLARE_CLASS(RenderTraverser);
+SCG_DECLARE_CLASS(ResourceCache);
+SCG_DECLARE_CLASS(ShaderBinaryCache);
 SCG_DECLARE_CLASS(ShaderCore);
 SCG_DECLARE_CLASS(ShaderCoreFactory);
+SCG_DECLARE_CLASS(ShadowMap);
 SCG_DECLARE_CLASS(Shape);
 SCG_DECLARE_CLASS(StandardRenderer);
+SCG_DECLARE_CLASS(StaticBatch);
+SCG_DECLARE_CLASS(StreamedTexture2DCore);
+SCG_DECLARE_CLASS(TextureArrayBuilder);
+SCG_DECLARE_CLASS(TextureContainer);
 SCG_DECLARE_CLASS(TextureCore);
+SCG_DECLARE_CLASS(TextureLayerCore);
+SCG_DECLARE_CLASS(TextureStreamer);
+SCG_DECLARE_CLASS(Texture2DArrayCore);
 SCG_DECLARE_CLASS(Texture2DCore);
 SCG_DECLARE_CLASS(TransformAnimation);
 SCG_DECLARE_CLASS(Transformation);
@@ -292,13 +312,19 @@ public:
   static const OGLAttrib TEX_COORD_1;
   static const OGLAttrib TANGENT;
   static const OGLAttrib BINORMAL;
+  static const OGLAttrib DRAW_INDEX;
 
   // fragment data names and locations, defined in internals.cpp
   static const OGLFragData FRAG_COLOR;
+  static const OGLFragData G_ALBEDO;
+  static const OGLFragData G_SPECULAR;
+  static const OGLFragData G_NORMAL;
 
   // uniform block names and indices, defined in internals.cpp
   static const OGLUniformBlock LIGHT;
   static const OGLUniformBlock MATERIAL;
+  static const OGLUniformBlock LIGHT_CLUSTER;
+  static const OGLUniformBlock SHADOW;
 
   // uniform names
   static const char* MODEL_VIEW_MATRIX;
@@ -309,11 +335,24 @@ public:
   static const char* COLOR_MATRIX;
   static const char* N_LIGHTS;
   static const char* GLOBAL_AMBIENT_LIGHT;
+  static const char* MATERIAL_INDEX;
   static const char* TIME;
 
   // sampler names and texture units
   static const OGLSampler TEXTURE0;
   static const OGLSampler TEXTURE1;
+  static const OGLSampler DRAW_DATA;
+  static const OGLSampler CLUSTER_LIGHTS;
+  static const OGLSampler CLUSTER_LIGHT_INDICES;
+  static const OGLSampler CLUSTER_GRID;
+  static const OGLSampler MATERIALS;
+  static const OGLSampler SHADOW_MAP;
+  static const OGLSampler G_BUFFER_BASE;
+  static const OGLSampler G_BUFFER_ALBEDO;
+  static const OGLSampler G_BUFFER_SPECULAR;
+  static const OGLSampler G_BUFFER_NORMAL;
+  static const OGLSampler G_BUFFER_DEPTH;
+  static const OGLSampler DEFERRED_LIGHTS;
 
   // parameters
   static const int MAX_NUMBER_OF_LIGHTS = 10;
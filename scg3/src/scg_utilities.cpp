@@ -21,40 +21,90 @@
  * limitations under the License.
  */
 
-#include <fstream>
+#include <chrono>
 #include <iostream>
-#include <map>
+#include "GLDebug.h"
+#include "NullGL.h"
 #include "scg_internals.h"
 #include "scg_utilities.h"
 
+#ifdef SCG_HEADLESS_EGL
+#include <EGL/egl.h>
+#endif
+
 namespace scg {
 
 
 int checkGLError() {
-  int result = 0;
-  std::map<GLenum, std::string> messages;
-  messages[GL_INVALID_ENUM] = "invalid enum";
-  messages[GL_INVALID_VALUE] = "invalid value";
-  messages[GL_INVALID_OPERATION] = "invalid operation";
-//  messages[GL_STACK_OVERFLOW] = "stack overflow";
-//  messages[GL_STACK_UNDERFLOW] = "stack underflow";
-  messages[GL_OUT_OF_MEMORY] = "out of memory";
-  messages[GL_INVALID_FRAMEBUFFER_OPERATION] = "invalid framebuffer operation";
-
-  GLenum error = glGetError();
-  if (error != GL_NO_ERROR) {
-    std::cerr << std::endl << "GL error: " << messages[error] << std::endl;
-    result = 1;
+  // errors reported by debug message callback (cf. GLDebug) have already been printed
+  int debugError = GLDebug::isActive() ? GLDebug::checkError() : 0;
+
+  // drain error flags, which are set independently of debug output
+  // (bounded loop, a lost context may report errors forever)
+  int glError = 0;
+  for (int i = 0; i < 16; ++i) {
+    GLenum error = glGetError();
+    if (error == GL_NO_ERROR) {
+      break;
+    }
+    glError = 1;
+    if (debugError) {
+      continue;
+    }
+    const char* message;
+    switch (error) {
+      case GL_INVALID_ENUM:
+        message = "invalid enum";
+        break;
+      case GL_INVALID_VALUE:
+        message = "invalid value";
+        break;
+      case GL_INVALID_OPERATION:
+        message = "invalid operation";
+        break;
+      case GL_STACK_OVERFLOW:
+        message = "stack overflow";
+        break;
+      case GL_STACK_UNDERFLOW:
+        message = "stack underflow";
+        break;
+      case GL_OUT_OF_MEMORY:
+        message = "out of memory";
+        break;
+      case GL_INVALID_FRAMEBUFFER_OPERATION:
+        message = "invalid framebuffer operation";
+        break;
+      default:
+        message = "unknown error";
+        break;
+    }
+    std::cerr << std::endl << "GL error: " << message << std::endl;
   }
-  return result;
+  return (debugError || glError) ? 1 : 0;
 }
 
 
 bool isGLContextActive() {
+  // null backend without context (cf. NullGL)
+  if (NullGL::isLoaded()) {
+    return true;
+  }
+#ifdef SCG_HEADLESS_EGL
+  // headless context created by EGL (cf. Viewer)
+  if (eglGetCurrentContext() != EGL_NO_CONTEXT) {
+    return true;
+  }
+#endif
   return glfwGetCurrentContext() != NULL;
 }
 
 
+double getTime() {
+  static const auto startTime = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+
 void getCursorPosPixels(GLFWwindow* window, double& xPixels, double& yPixels) {
   // get window size (screen coords) and framebuffer size (pixels)
   int wScreen, hScreen, wPixels, hPixels;
@@ -78,40 +128,6 @@ void setCursorPosPixels(GLFWwindow* window, double xPixels, double yPixels) {
 }
 
 
-void formatFilePath(std::string& filePath) {
-  for (char& c : filePath) {
-    if (c == '\\') {
-      c = '/';
-    }
-  }
-  if (filePath.back() != '/') {
-     filePath += '/';
-   }
-}
-
-
-std::string getFullFileName(const std::vector<std::string>& filePaths, const std::string& fileName) {
-  // first try to open local file, then search known paths
-  std::string result;
-  std::ifstream istr(fileName.c_str());
-  if (istr.is_open()) {
-    istr.close();
-    result = fileName;
-  }
-  else {
-    for (auto filePath : filePaths) {
-      istr.open((filePath + fileName).c_str());
-      if (istr.is_open()) {
-        istr.close();
-        result = filePath + fileName;
-        break;
-      }
-    }
-  }
-  return result;
-}
-
-
 void printUniformBlockInformation(GLuint program, int nMembers, const GLchar** uniformNames) {
   GLuint* uniformIndices = new GLuint[nMembers];
   glGetUniformIndices(program, nMembers, uniformNames, uniformIndices);
@@ -131,23 +147,5 @@ void printUniformBlockInformation(GLuint program, int nMembers, const GLchar** u
 }
 
 
-void splitFilePath(const std::string& filePath, std::vector<std::string>& splitPaths) {
-  std::string path;
-  size_t length = filePath.length();
-  size_t startPos = 0;
-  size_t endPos = length;
-  while (startPos < length) {
-    endPos = filePath.find_first_of(";,", startPos);
-    if (endPos == std::string::npos) {
-      endPos = length;
-    }
-    path = filePath.substr(startPos, endPos - startPos);
-    formatFilePath(path);
-    splitPaths.push_back(path);
-    startPos = endPos + 1;
-  }
-}
-
-
 } /* namespace scg */
 
@@ -27,22 +27,21 @@
 
 #include <string>
 #include <vector>
+#include "scg_core_utilities.h"
 #include "scg_glew_glad.h"
 #include <GLFW/glfw3.h>
 
 namespace scg {
 
 
-/**
- * Pi constant.
- */
-const float PI = 3.141592654f;
-
-
 /**
  * \brief Check if an OpenGL error has occured since last call of checkGLError().
  *
  * Can be used via assert(!checkGLError()) in order to get information on code file and line.
+ * All error flags are drained via glGetError(). If debug output is active (cf. GLDebug),
+ * errors reported by its message callback are checked as well, and drained errors are
+ * printed only if the callback has not already reported them, since messages may be
+ * filtered or missing.
  *
  * \return 0 for no error, 1 for error
  */
@@ -60,6 +59,16 @@ int checkGLError();
 bool isGLContextActive();
 
 
+/**
+ * \brief Get time in seconds since first call, thread-safe.
+ *
+ * Time source of all scg3 timings and animations, replaces glfwGetTime(), which returns 0
+ * if GLFW has not been initialized, e.g., in headless mode without GLFW null platform.
+ * Based on a monotonic clock, called by Viewer::init() to start the clock.
+ */
+double getTime();
+
+
 /**
  * \brief Get cursor (mouse pointer) position in pixels, as opposed to screen coordinates.
  *
@@ -80,38 +89,12 @@ void getCursorPosPixels(GLFWwindow* window, double& xPixels, double& yPixels);
 void setCursorPosPixels(GLFWwindow* window, double xPixels, double yPixels);
 
 
-/**
- * \brief Replace backslashes by slashes and ensure that the last character is a slash.
- */
-void formatFilePath(std::string& filePath);
-
-
-/**
- * \brief Try to find file name in a list of file paths.
- *
- * The local directory is searched first.
- *
- * \return full file name including path, empty string if the file has not been found
- */
-std::string getFullFileName(const std::vector<std::string>& filePaths, const std::string& fileName);
-
-
 /**
  * \brief Print information about uniform blocks in shaders.
  */
 void printUniformBlockInformation(GLuint program, int nMembers, const GLchar** uniformNames);
 
 
-/**
- * \brief Split string containing one or more file paths into a vector of single paths.
- *
- * Allowed delimiters: ';' and ','.
- *
- * For each split path formatFilePath() is called.
- */
-void splitFilePath(const std::string& filePath, std::vector<std::string>& splitPaths);
-
-
 } /* namespace scg */
 
 #endif /* SCG_UTILITIES_H_ */
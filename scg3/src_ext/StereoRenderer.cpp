@@ -55,5 +55,25 @@ std::string StereoRenderer::getInfo() {
 }
 
 
+void StereoRenderer::beginFrame() {
+  assert(concreteRenderer_);
+  concreteRenderer_->beginFrame();
+}
+
+
+void StereoRenderer::endFrame() {
+  assert(concreteRenderer_);
+  concreteRenderer_->endFrame();
+  storeRenderStats_(concreteRenderer_->getRenderStats());
+}
+
+
+void StereoRenderer::setFrameProfiler(FrameProfiler* frameProfiler) {
+  assert(concreteRenderer_);
+  Renderer::setFrameProfiler(frameProfiler);
+  concreteRenderer_->setFrameProfiler(frameProfiler);
+}
+
+
 
 } /* namespace scg */
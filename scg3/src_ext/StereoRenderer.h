@@ -73,12 +73,29 @@ public:
    */
   virtual std::string getInfo();
 
+  /**
+   * Begin frame, calls concreteRenderer_->beginFrame().
+   */
+  virtual void beginFrame();
+
   /**
    * Render the scene, called by Viewer::startMainLoop().
    * Should call concreteRenderer->render().
    */
   virtual void render() = 0;
 
+  /**
+   * End frame, calls concreteRenderer_->endFrame() and stores its render statistics,
+   * which cover both eyes.
+   */
+  virtual void endFrame();
+
+  /**
+   * Set frame profiler of this and the concrete renderer, whose render passes are timed
+   * for both eyes.
+   */
+  virtual void setFrameProfiler(FrameProfiler* frameProfiler);
+
 protected:
 
   RendererSP concreteRenderer_;
@@ -0,0 +1,638 @@
+/**
+ * \file main.cpp
+ * \brief scg3 frame benchmark with procedural stress scenes.
+ *
+ * Renders a parameterized scene (N teapots or OBJ instances in a transformation hierarchy,
+ * lights, textures, materials) along a fixed camera orbit for a given number of frames,
+ * with vertical synchronization disabled, and reports percentiles of the CPU and GPU
+ * frame times as well as render statistics (draws, triangles, state changes) of the
+ * last frame. Runs headless by default,
+ * e.g., with Mesa llvmpipe on servers without display, or without any OpenGL context
+ * using the null backend (cf. NullGL), reporting OpenGL calls and redundant calls.
+ *
+ * Usage: scg3_bench [--option=value ...], see printUsage() or --help.
+ *
+ * Example:
+ * \code
+ * scg3_bench --instances=1000 --depth=3 --fanout=10 --textures=100 --static-batch=1 \
+ *     --frames=300 --csv=frames.csv --json=summary.json
+ * \endcode
+ *
+ * Requires C++11 and OpenGL 3.3 (timer queries).
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <scg3.h>
+
+using namespace scg;
+
+
+/**
+ * \brief Benchmark parameters, set by command line options.
+ */
+struct BenchConfig {
+
+  BenchConfig()
+      : nInstances(100), depth(1), fanout(8), nLights(1), nTextures(0), nMaterials(1),
+        isTextureArray(false), isStaticBatch(false), isMultiDrawIndirect(true),
+        isDeferred(false), nFrames(200), nWarmupFrames(10), width(800), height(600),
+        isHeadless(true), isNullGL(false), isHUD(false),
+        shaderPath("../scg3/shaders;../../scg3/shaders"),
+        modelPath(".;../scg3/models;../../scg3/models") {
+  }
+
+  int nInstances;             // number of shapes
+  std::string objFile;        // OBJ model instead of teapot (if not empty)
+  int depth;                  // depth of transformation hierarchy (1: flat)
+  int fanout;                 // children per inner transformation node
+  int nLights;                // 1 directional light plus nLights - 1 point lights
+  int nTextures;              // number of distinct textures (0: untextured)
+  int nMaterials;             // number of distinct materials
+  bool isTextureArray;        // combine textures into texture array (TextureArrayBuilder)
+  bool isStaticBatch;         // merge shapes into StaticBatch
+  bool isMultiDrawIndirect;   // StaticBatch submission by multi-draw indirect
+  bool isDeferred;            // DeferredRenderer instead of StandardRenderer
+  int nFrames;
+  int nWarmupFrames;          // frames rendered before measurement
+  int width, height;
+  bool isHeadless;
+  bool isNullGL;              // null backend without OpenGL context (NullGL)
+  bool isHUD;                 // performance HUD (PerformanceHUD), profiled separately
+  std::string shaderPath;
+  std::string modelPath;
+  std::string csvFile;        // per-frame times (if not empty)
+  std::string jsonFile;       // summary (if not empty)
+  std::string captureFile;    // PNG file name pattern of captured frames (if not empty)
+  std::string traceFile;      // Chrome trace of scene creation and frames (if not empty)
+  std::string callsFile;      // OpenGL call stream of last frame (if not empty, null backend)
+
+};
+
+
+/**
+ * \brief Summary statistics of frame times (milliseconds).
+ */
+struct FrameStats {
+
+  FrameStats()
+      : mean(0.), min(0.), p50(0.), p90(0.), p95(0.), p99(0.), max(0.) {
+  }
+
+  double mean, min, p50, p90, p95, p99, max;
+
+};
+
+
+/**
+ * \brief Parse command line options into benchmark configuration.
+ * \return false if help is requested
+ */
+bool parseOptions(int argc, char* argv[], BenchConfig& config);
+
+
+/**
+ * \brief Print command line options.
+ */
+void printUsage();
+
+
+/**
+ * \brief Create procedural scene consisting of camera, lights, and shape instances.
+ * \return radius of bounding sphere of the shape instances
+ */
+float createScene(const BenchConfig& config, RendererSP renderer,
+    DeferredRendererSP deferredRenderer, CameraSP camera, GroupSP& scene);
+
+
+/**
+ * \brief Compute mean and percentiles (nearest rank) of frame times.
+ */
+FrameStats computeStats(std::vector<double> times);
+
+
+/**
+ * \brief Write per-frame times to CSV file.
+ */
+void writeCSV(const std::string& fileName, const std::vector<double>& cpuTimes,
+    const std::vector<double>& gpuTimes);
+
+
+/**
+ * \brief Write configuration and summary to JSON file.
+ */
+void writeJSON(const std::string& fileName, const BenchConfig& config,
+    const RenderStats& renderStats, const FrameStats& cpuStats, const FrameStats& gpuStats);
+
+
+/**
+ * \brief The main function.
+ */
+int main(int argc, char* argv[]) {
+
+  int result = 0;
+
+  try {
+    BenchConfig config;
+    if (!parseOptions(argc, argv, config)) {
+      printUsage();
+      return 0;
+    }
+    Tracer::setEnabled(!config.traceFile.empty());
+
+    // create viewer without vertical synchronization (timer queries require OpenGL 3.3)
+    auto viewer = Viewer::create();
+    OGLConfig oglConfig(3, 3, GL_TRUE, OGLProfile::CORE, glm::vec4(0.15f, 0.15f, 0.15f, 1.f));
+    oglConfig.swapInterval = 0;
+    oglConfig.headless = config.isHeadless;
+    oglConfig.nullGL = config.isNullGL;
+    viewer->setOpenGLConfig(oglConfig);
+    RendererSP renderer;
+    DeferredRendererSP deferredRenderer;
+    if (config.isDeferred) {
+      deferredRenderer = DeferredRenderer::create();
+      renderer = deferredRenderer;
+    }
+    else {
+      renderer = StandardRenderer::create();
+    }
+    viewer->init(renderer)
+        ->createWindow("s c g 3   b e n c h", config.width, config.height);
+
+    // create scene
+    auto camera = PerspectiveCamera::create();
+    renderer->setCamera(camera);
+    GroupSP scene;
+    float radius = createScene(config, renderer, deferredRenderer, camera, scene);
+    renderer->setScene(scene);
+
+    // optionally show performance HUD, profile its CPU and GPU time
+    if (config.isHUD) {
+      viewer->getViewState()->setHUDVisible(true);
+      viewer->getViewState()->getFrameProfiler()->setEnabled(true)->setWindowSize(config.nFrames);
+    }
+
+    // render first frame to build static batches
+    viewer->renderFrames(1);
+
+    // optionally capture frames for visual inspection (affects frame times)
+    FrameCaptureSP frameCapture;
+    if (!config.captureFile.empty()) {
+      frameCapture = FrameCapture::create();
+      frameCapture->addSink(PNGFileSink::create(config.captureFile));
+    }
+
+    // render frames along camera orbit, measure CPU time (wall time of frame including
+    // driver synchronization) and GPU time (timer queries)
+    const int nTotalFrames = config.nWarmupFrames + config.nFrames;
+    std::vector<GLuint> queries(config.nFrames);
+    glGenQueries(config.nFrames, queries.data());
+    std::vector<double> cpuTimes, gpuTimes;
+    for (int i = 0; i < nTotalFrames; ++i) {
+      float angle = 2.f * 3.14159265f * i / nTotalFrames;
+      glm::vec3 eye = 1.8f * radius * glm::vec3(std::sin(angle), 0.4f, std::cos(angle));
+      camera->setMatrix(glm::inverse(glm::lookAt(eye, glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f))));
+      int frame = i - config.nWarmupFrames;
+      if (frame == 0) {
+        viewer->setFrameCapture(frameCapture);
+        if (config.isNullGL) {
+          NullGL::resetCounters();
+        }
+      }
+      bool isRecordingCalls = !config.callsFile.empty() && i == nTotalFrames - 1;
+      NullGL::setRecording(isRecordingCalls);
+      if (frame >= 0) {
+        glBeginQuery(GL_TIME_ELAPSED, queries[frame]);
+      }
+      auto startTime = std::chrono::steady_clock::now();
+      viewer->renderFrames(1);
+      auto endTime = std::chrono::steady_clock::now();
+      NullGL::setRecording(false);
+      if (frame >= 0) {
+        glEndQuery(GL_TIME_ELAPSED);
+        cpuTimes.push_back(std::chrono::duration<double, std::milli>(endTime - startTime).count());
+      }
+    }
+    for (auto query : queries) {
+      GLuint64 elapsedTime = 0;
+      glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedTime);
+      gpuTimes.push_back(1e-6 * elapsedTime);
+    }
+    glDeleteQueries(config.nFrames, queries.data());
+
+    // report results, render statistics (draws, triangles, etc.) of last frame
+    const RenderStats& renderStats = renderer->getRenderStats();
+    FrameStats cpuStats = computeStats(cpuTimes);
+    FrameStats gpuStats = computeStats(gpuTimes);
+    std::cout << std::fixed << std::setprecision(3)
+        << "OpenGL renderer: " << glGetString(GL_RENDERER) << std::endl
+        << "frames: " << config.nFrames << ", draws: " << renderStats.nDrawCalls
+        << ", triangles: " << renderStats.nTriangles << std::endl
+        << "program switches: " << renderStats.nProgramSwitches << ", texture binds: "
+        << renderStats.nTextureBinds << ", buffer binds: " << renderStats.nBufferBinds
+        << ", uniform uploads: " << renderStats.nUniformUploads << ", uploaded bytes: "
+        << renderStats.nUploadedBytes << std::endl
+        << "CPU ms: mean " << cpuStats.mean << ", p50 " << cpuStats.p50 << ", p95 "
+        << cpuStats.p95 << ", p99 " << cpuStats.p99 << ", max " << cpuStats.max << std::endl
+        << "GPU ms: mean " << gpuStats.mean << ", p50 " << gpuStats.p50 << ", p95 "
+        << gpuStats.p95 << ", p99 " << gpuStats.p99 << ", max " << gpuStats.max << std::endl;
+    if (config.isHUD) {
+      const FrameProfiler* profiler = viewer->getViewState()->getFrameProfiler();
+      FrameTimeStats hudCPUStats = profiler->getCPUStats(FrameProfiler::HUD);
+      FrameTimeStats hudGPUStats = profiler->getGPUStats(FrameProfiler::HUD);
+      std::cout << "HUD ms: CPU avg " << hudCPUStats.avg << ", p99 " << hudCPUStats.p99
+          << ", max " << hudCPUStats.max << ", GPU avg " << hudGPUStats.avg << ", p99 "
+          << hudGPUStats.p99 << ", max " << hudGPUStats.max << ", uploaded bytes (last frame): "
+          << viewer->getPerformanceHUD()->getNUploadedBytes() << std::endl;
+    }
+    if (config.isNullGL) {
+      std::cout << "GL calls per frame: " << std::setprecision(1)
+          << static_cast<double>(NullGL::getNCalls()) / config.nFrames << ", redundant: "
+          << static_cast<double>(NullGL::getNRedundantCalls()) / config.nFrames << std::endl
+          << std::endl << NullGL::getReport();
+    }
+    if (!config.callsFile.empty()) {
+      NullGL::writeCallStream(config.callsFile);
+    }
+    if (!config.csvFile.empty()) {
+      writeCSV(config.csvFile, cpuTimes, gpuTimes);
+    }
+    if (!config.jsonFile.empty()) {
+      writeJSON(config.jsonFile, config, renderStats, cpuStats, gpuStats);
+    }
+    if (!config.traceFile.empty()) {
+      Tracer::setEnabled(false);
+      Tracer::writeChromeTrace(config.traceFile);
+    }
+  }
+  catch (const std::exception& exc) {
+    std::cerr << std::endl << "Exception: " << exc.what() << std::endl;
+    result = 1;
+  }
+  return result;
+}
+
+
+bool parseOptions(int argc, char* argv[], BenchConfig& config) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    if (arg == "--help" || arg == "-h") {
+      return false;
+    }
+    size_t pos = arg.find('=');
+    if (arg.compare(0, 2, "--") != 0 || pos == std::string::npos) {
+      throw std::runtime_error("Invalid option " + arg + " [parseOptions()]");
+    }
+    std::string name = arg.substr(2, pos - 2);
+    std::string value = arg.substr(pos + 1);
+    int intValue = std::atoi(value.c_str());
+    if (name == "instances") config.nInstances = std::max(intValue, 1);
+    else if (name == "obj") config.objFile = value;
+    else if (name == "depth") config.depth = std::max(intValue, 1);
+    else if (name == "fanout") config.fanout = std::max(intValue, 1);
+    else if (name == "lights") config.nLights = std::max(intValue, 1);
+    else if (name == "textures") config.nTextures = std::max(intValue, 0);
+    else if (name == "materials") config.nMaterials = std::max(intValue, 1);
+    else if (name == "texture-array") config.isTextureArray = intValue != 0;
+    else if (name == "static-batch") config.isStaticBatch = intValue != 0;
+    else if (name == "mdi") config.isMultiDrawIndirect = intValue != 0;
+    else if (name == "renderer") config.isDeferred = (value == "deferred");
+    else if (name == "frames") config.nFrames = std::max(intValue, 1);
+    else if (name == "warmup") config.nWarmupFrames = std::max(intValue, 0);
+    else if (name == "width") config.width = std::max(intValue, 1);
+    else if (name == "height") config.height = std::max(intValue, 1);
+    else if (name == "headless") config.isHeadless = intValue != 0;
+    else if (name == "null-gl") config.isNullGL = intValue != 0;
+    else if (name == "hud") config.isHUD = intValue != 0;
+    else if (name == "shaders") config.shaderPath = value;
+    else if (name == "models") config.modelPath = value;
+    else if (name == "csv") config.csvFile = value;
+    else if (name == "json") config.jsonFile = value;
+    else if (name == "capture") config.captureFile = value;
+    else if (name == "trace") config.traceFile = value;
+    else if (name == "calls") config.callsFile = value;
+    else {
+      throw std::runtime_error("Unknown option " + arg + " [parseOptions()]");
+    }
+  }
+  if (!config.callsFile.empty() && !config.isNullGL) {
+    throw std::runtime_error("Option --calls requires --null-gl=1 [parseOptions()]");
+  }
+  return true;
+}
+
+
+void printUsage() {
+  std::cout << "Usage: scg3_bench [--option=value ...]" << std::endl
+      << "  --instances=N      number of shapes (default: 100)" << std::endl
+      << "  --obj=FILE         OBJ model instead of teapot" << std::endl
+      << "  --depth=D          depth of transformation hierarchy (default: 1)" << std::endl
+      << "  --fanout=F         children per transformation node (default: 8)" << std::endl
+      << "  --lights=L         number of lights (default: 1)" << std::endl
+      << "  --textures=T       number of distinct textures (default: 0)" << std::endl
+      << "  --materials=M      number of distinct materials (default: 1)" << std::endl
+      << "  --texture-array=0|1  combine textures into texture array (default: 0)" << std::endl
+      << "  --static-batch=0|1   merge shapes into static batch (default: 0)" << std::endl
+      << "  --mdi=0|1          multi-draw indirect for static batch (default: 1)" << std::endl
+      << "  --renderer=standard|deferred  (default: standard)" << std::endl
+      << "  --frames=M         measured frames (default: 200)" << std::endl
+      << "  --warmup=W         frames before measurement (default: 10)" << std::endl
+      << "  --width=W, --height=H  frame buffer size (default: 800 x 600)" << std::endl
+      << "  --headless=0|1     offscreen rendering without window (default: 1)" << std::endl
+      << "  --null-gl=0|1      null backend without OpenGL context, reports GL calls"
+      << " (default: 0)" << std::endl
+      << "  --hud=0|1          show performance HUD, report its CPU and GPU time (default: 0)"
+      << std::endl
+      << "  --shaders=PATH, --models=PATH  search paths" << std::endl
+      << "  --csv=FILE         write per-frame CPU and GPU times" << std::endl
+      << "  --json=FILE        write configuration and summary" << std::endl
+      << "  --capture=PATTERN  write measured frames to PNG files, e.g., frame_%05d.png"
+      << std::endl
+      << "  --trace=FILE       write Chrome trace JSON of scene creation and frames" << std::endl
+      << "  --calls=FILE       write GL call stream of last frame (requires --null-gl=1)"
+      << std::endl;
+}
+
+
+float createScene(const BenchConfig& config, RendererSP renderer,
+    DeferredRendererSP deferredRenderer, CameraSP camera, GroupSP& scene) {
+
+  const bool isTextured = config.nTextures > 0;
+  const bool isClustered = !config.isDeferred
+      && config.nLights > OGLConstants::MAX_NUMBER_OF_LIGHTS;
+  if (config.isDeferred && config.isTextureArray) {
+    throw std::runtime_error("Texture arrays are not supported by deferred renderer"
+        " [createScene()]");
+  }
+
+  // shader
+  ShaderCoreFactory shaderFactory(config.shaderPath);
+  const char* vertexShader = config.isStaticBatch ? "phong_batch_vert.glsl"
+      : (config.isDeferred ? "phong_variant_vert.glsl" : "phong_vert.glsl");
+  ShaderCoreSP shader;
+  if (config.isDeferred) {
+    shader = shaderFactory.createShaderVariant({
+        ShaderFile(vertexShader, GL_VERTEX_SHADER),
+        ShaderFile("phong_variant_frag.glsl", GL_FRAGMENT_SHADER)},
+        {{"GBUFFER", "1"}, {"TEXTURE", isTextured ? "1" : "0"}});
+    deferredRenderer->setLightingShader(shaderFactory.createShaderFromSourceFiles({
+        ShaderFile("deferred_lighting_vert.glsl", GL_VERTEX_SHADER),
+        ShaderFile("deferred_lighting_frag.glsl", GL_FRAGMENT_SHADER)}));
+  }
+  else {
+    shader = shaderFactory.createShaderFromSourceFiles({
+        ShaderFile(vertexShader, GL_VERTEX_SHADER),
+        ShaderFile("phong_frag.glsl", GL_FRAGMENT_SHADER),
+        ShaderFile(isClustered ? "blinn_phong_clustered_lighting.glsl"
+            : "blinn_phong_lighting.glsl", GL_FRAGMENT_SHADER),
+        ShaderFile(!isTextured ? "texture_none.glsl" : (config.isTextureArray
+            ? "texture2d_array_modulate.glsl" : "texture2d_modulate.glsl"),
+            GL_FRAGMENT_SHADER)});
+  }
+
+  // geometry
+  GeometryCoreFactory geometryFactory(config.modelPath);
+  auto geometry = config.objFile.empty() ? geometryFactory.createTeapot(0.5f)
+      : geometryFactory.createModelFromOBJFile(config.objFile);
+
+  // materials
+  std::vector<MaterialCoreSP> materials;
+  for (int i = 0; i < config.nMaterials; ++i) {
+    float hue = static_cast<float>(i) / config.nMaterials;
+    auto material = MaterialCore::create();
+    material->setAmbientAndDiffuse(glm::vec4(0.5f + 0.5f * std::cos(6.283f * hue),
+        0.5f + 0.5f * std::cos(6.283f * (hue - 0.333f)),
+        0.5f + 0.5f * std::cos(6.283f * (hue - 0.667f)), 1.f))
+        ->setSpecular(glm::vec4(0.5f, 0.5f, 0.5f, 1.f))
+        ->setShininess(20.f)
+        ->init();
+    materials.push_back(material);
+  }
+
+  // procedural checkerboard textures, optionally combined into texture array
+  std::vector<CoreSP> textures;
+  TextureArrayBuilder textureArrayBuilder;
+  const GLsizei texSize = 64;
+  std::vector<unsigned char> rgbaData(4 * texSize * texSize);
+  for (int i = 0; i < config.nTextures; ++i) {
+    for (int y = 0; y < texSize; ++y) {
+      for (int x = 0; x < texSize; ++x) {
+        unsigned char* texel = &rgbaData[4 * (y * texSize + x)];
+        bool isDark = ((x / 8) + (y / 8)) % 2 != 0;
+        texel[0] = isDark ? static_cast<unsigned char>(37 * i) : 255;
+        texel[1] = isDark ? static_cast<unsigned char>(91 * i) : 255;
+        texel[2] = isDark ? static_cast<unsigned char>(53 * i) : 255;
+        texel[3] = 255;
+      }
+    }
+    if (config.isTextureArray) {
+      textures.push_back(textureArrayBuilder.addTexture(texSize, texSize, rgbaData.data()));
+    }
+    else {
+      auto texture = Texture2DCore::create();
+      texture->setTexture(texSize, texSize, rgbaData.data(), GL_REPEAT, GL_REPEAT,
+          GL_LINEAR, GL_LINEAR);
+      textures.push_back(texture);
+    }
+  }
+
+  // transformation hierarchy, shapes are distributed among the leaves
+  auto content = Transformation::create();
+  std::vector<TransformationSP> leaves(1, content);
+  for (int level = 1; level < config.depth
+      && static_cast<int>(leaves.size()) * config.fanout <= config.nInstances; ++level) {
+    std::vector<TransformationSP> children;
+    for (auto& leaf : leaves) {
+      for (int i = 0; i < config.fanout; ++i) {
+        auto child = Transformation::create();
+        leaf->addChild(child);
+        children.push_back(child);
+      }
+    }
+    leaves.swap(children);
+  }
+
+  // shapes on a cubic grid
+  const int gridSize = static_cast<int>(std::ceil(std::cbrt(static_cast<double>(config.nInstances))));
+  const float spacing = 1.5f;
+  const float offset = 0.5f * spacing * (gridSize - 1);
+  for (int i = 0; i < config.nInstances; ++i) {
+    auto transformation = Transformation::create();
+    transformation->translate(glm::vec3(spacing * (i % gridSize) - offset,
+        spacing * ((i / gridSize) % gridSize) - offset,
+        spacing * (i / (gridSize * gridSize)) - offset))
+        ->rotate(37.f * i, glm::vec3(0.f, 1.f, 0.f));
+    auto shape = Shape::create();
+    shape->addCore(materials[i % materials.size()]);
+    if (isTextured) {
+      shape->addCore(textures[i % textures.size()]);
+    }
+    shape->addCore(geometry);
+    transformation->addChild(shape);
+    leaves[i % leaves.size()]->addChild(transformation);
+  }
+  NodeSP contentRoot = content;
+  if (config.isStaticBatch) {
+    auto batch = StaticBatch::create();
+    batch->setMultiDrawIndirect(config.isMultiDrawIndirect);
+    batch->addNode(content);
+    contentRoot = batch;
+  }
+  float radius = 0.87f * spacing * gridSize;
+
+  // scene: camera, directional key light, point lights (Light nodes, light cluster,
+  // or deferred lights), content
+  scene = Group::create();
+  scene->addCore(shader);
+  if (isTextured && config.isTextureArray) {
+    scene->addCore(textureArrayBuilder.build(GL_REPEAT, GL_REPEAT, GL_LINEAR, GL_LINEAR));
+  }
+  camera->translate(glm::vec3(0.f, 0.f, 1.8f * radius));
+  scene->addChild(camera);
+  auto keyLight = Light::create();
+  keyLight->setDiffuseAndSpecular(glm::vec4(0.8f, 0.8f, 0.8f, 1.f))
+      ->setPosition(glm::vec4(1.f, 1.f, 1.f, 0.f))
+      ->init();
+  scene->addChild(keyLight);
+  CompositeSP parent = keyLight;
+  LightClusterSP lightCluster;
+  if (isClustered) {
+    lightCluster = LightCluster::create();
+    parent->addChild(lightCluster);
+    parent = lightCluster;
+  }
+  for (int i = 1; i < config.nLights; ++i) {
+    float angle = 2.399963f * i;     // golden angle
+    float r = radius * std::sqrt(static_cast<float>(i) / config.nLights);
+    auto light = Light::create();
+    light->setDiffuseAndSpecular(glm::vec4(0.4f, 0.4f, 0.4f, 1.f))
+        ->setPosition(glm::vec4(r * std::cos(angle), 0.5f * radius * std::sin(0.7f * i),
+            r * std::sin(angle), 1.f))
+        ->init();
+    if (config.isDeferred) {
+      deferredRenderer->addLight(light, 0.5f * radius);
+    }
+    else if (isClustered) {
+      lightCluster->addLight(light, 0.5f * radius);
+    }
+    else {
+      parent->addChild(light);
+      parent = light;
+    }
+  }
+  parent->addChild(contentRoot);
+
+  return radius;
+}
+
+
+FrameStats computeStats(std::vector<double> times) {
+  FrameStats stats;
+  if (times.empty()) {
+    return stats;
+  }
+  std::sort(times.begin(), times.end());
+  auto percentile = [&times](double p) {
+    size_t rank = static_cast<size_t>(std::ceil(p / 100. * times.size()));
+    return times[std::min(std::max(rank, static_cast<size_t>(1)), times.size()) - 1];
+  };
+  for (auto time : times) {
+    stats.mean += time;
+  }
+  stats.mean /= times.size();
+  stats.min = times.front();
+  stats.p50 = percentile(50.);
+  stats.p90 = percentile(90.);
+  stats.p95 = percentile(95.);
+  stats.p99 = percentile(99.);
+  stats.max = times.back();
+  return stats;
+}
+
+
+void writeCSV(const std::string& fileName, const std::vector<double>& cpuTimes,
+    const std::vector<double>& gpuTimes) {
+  std::ofstream stream(fileName);
+  if (!stream) {
+    throw std::runtime_error("Cannot open file " + fileName + " [writeCSV()]");
+  }
+  stream << std::fixed << std::setprecision(4) << "frame,cpu_ms,gpu_ms" << std::endl;
+  for (size_t i = 0; i < cpuTimes.size(); ++i) {
+    stream << i << "," << cpuTimes[i] << "," << gpuTimes[i] << std::endl;
+  }
+}
+
+
+void writeJSON(const std::string& fileName, const BenchConfig& config,
+    const RenderStats& renderStats, const FrameStats& cpuStats, const FrameStats& gpuStats) {
+  std::ofstream stream(fileName);
+  if (!stream) {
+    throw std::runtime_error("Cannot open file " + fileName + " [writeJSON()]");
+  }
+  auto writeStats = [&stream](const char* name, const FrameStats& stats) {
+    stream << "  \"" << name << "\": {\"mean\": " << stats.mean << ", \"min\": " << stats.min
+        << ", \"p50\": " << stats.p50 << ", \"p90\": " << stats.p90 << ", \"p95\": " << stats.p95
+        << ", \"p99\": " << stats.p99 << ", \"max\": " << stats.max << "}";
+  };
+  stream << std::fixed << std::setprecision(4) << "{" << std::endl
+      << "  \"renderer\": \"" << (config.isDeferred ? "deferred" : "standard") << "\"," << std::endl
+      << "  \"glRenderer\": \"" << glGetString(GL_RENDERER) << "\"," << std::endl
+      << "  \"instances\": " << config.nInstances << "," << std::endl
+      << "  \"model\": \"" << (config.objFile.empty() ? "teapot" : config.objFile) << "\","
+      << std::endl
+      << "  \"depth\": " << config.depth << "," << std::endl
+      << "  \"fanout\": " << config.fanout << "," << std::endl
+      << "  \"lights\": " << config.nLights << "," << std::endl
+      << "  \"textures\": " << config.nTextures << "," << std::endl
+      << "  \"materials\": " << config.nMaterials << "," << std::endl
+      << "  \"textureArray\": " << (config.isTextureArray ? "true" : "false") << "," << std::endl
+      << "  \"staticBatch\": " << (config.isStaticBatch ? "true" : "false") << "," << std::endl
+      << "  \"multiDrawIndirect\": " << (config.isMultiDrawIndirect ? "true" : "false") << ","
+      << std::endl
+      << "  \"width\": " << config.width << "," << std::endl
+      << "  \"height\": " << config.height << "," << std::endl
+      << "  \"frames\": " << config.nFrames << "," << std::endl
+      << "  \"draws\": " << renderStats.nDrawCalls << "," << std::endl
+      << "  \"triangles\": " << renderStats.nTriangles << "," << std::endl
+      << "  \"vertices\": " << renderStats.nVertices << "," << std::endl
+      << "  \"shapesVisited\": " << renderStats.nShapesVisited << "," << std::endl
+      << "  \"shapesCulled\": " << renderStats.nShapesCulled << "," << std::endl
+      << "  \"programSwitches\": " << renderStats.nProgramSwitches << "," << std::endl
+      << "  \"textureBinds\": " << renderStats.nTextureBinds << "," << std::endl
+      << "  \"bufferBinds\": " << renderStats.nBufferBinds << "," << std::endl
+      << "  \"uniformUploads\": " << renderStats.nUniformUploads << "," << std::endl
+      << "  \"uploadedBytes\": " << renderStats.nUploadedBytes << "," << std::endl;
+  writeStats("cpuMs", cpuStats);
+  stream << "," << std::endl;
+  writeStats("gpuMs", gpuStats);
+  stream << std::endl << "}" << std::endl;
+}
@@ -0,0 +1,419 @@
+/**
+ * \file microbench.cpp
+ * \brief scg3 CPU microbenchmarks of scene graph hot paths, with OpenGL calls stubbed out.
+ *
+ * Measures matrix stack operations, traversal of wide and deep trees, adding children,
+ * uniform location lookup, OBJ file parsing, and sphere and teapot generation,
+ * and reports nanoseconds, heap allocations, and OpenGL calls per operation. No OpenGL
+ * context is created: the OpenGL functions are replaced by the null backend (cf. NullGL),
+ * such that only the CPU work around the OpenGL calls is measured.
+ *
+ * Usage: scg3_microbench [--filter=SUBSTRING] [--min-time=SECONDS] [--models=PATH]
+ *
+ * \author Volker Ahlers\n
+ *         volker.ahlers@hs-hannover.de
+ */
+
+/*
+ * Copyright 2026 Volker Ahlers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <scg3.h>
+
+using namespace scg;
+
+
+// --- heap allocation counter ---
+
+
+static std::atomic<long> nAllocations(0);
+
+// prevents benchmarked computations from being optimized away
+static volatile long resultSink = 0;
+
+
+void* operator new(size_t size) {
+  ++nAllocations;
+  void* ptr = std::malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  ++nAllocations;
+  return std::malloc(size ? size : 1);
+}
+
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return operator new(size, std::nothrow);
+}
+
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+
+// sized deallocation (C++14)
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+
+void operator delete[](void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+#endif
+
+
+// over-aligned allocation (C++17)
+#if defined(__cpp_aligned_new)
+void* operator new(size_t size, std::align_val_t alignment) {
+  ++nAllocations;
+#if defined(_WIN32)
+  void* ptr = _aligned_malloc(size ? size : 1, static_cast<size_t>(alignment));
+#else
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, static_cast<size_t>(alignment), size ? size : 1) != 0) {
+    ptr = nullptr;
+  }
+#endif
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return operator new(size, alignment);
+}
+
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
+
+
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
+
+
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
+#endif
+
+
+// --- benchmark framework ---
+
+
+/**
+ * \brief Benchmark result per operation.
+ */
+struct BenchResult {
+  long nIterations;
+  double nsPerOp;
+  double allocationsPerOp;
+  double glCallsPerOp;
+};
+
+
+/**
+ * \brief Run operation repeatedly, doubling the number of iterations until the
+ *   minimum time is reached.
+ *
+ * \param operation function performing the given number of operations
+ * \param nOpsPerIteration number of operations per call (for ns/op)
+ */
+BenchResult runBenchmark(const std::function<void(long)>& operation, long nOpsPerIteration,
+    double minTime) {
+  BenchResult result = {1, 0., 0., 0.};
+  while (true) {
+    long allocationsStart = nAllocations;
+    long glCallsStart = NullGL::getNCalls();
+    auto startTime = std::chrono::steady_clock::now();
+    operation(result.nIterations);
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    long allocations = nAllocations - allocationsStart;
+    long glCalls = NullGL::getNCalls() - glCallsStart;
+    if (time >= minTime || result.nIterations >= (1L << 40)) {
+      double nOps = static_cast<double>(result.nIterations) * nOpsPerIteration;
+      result.nsPerOp = 1e9 * time / nOps;
+      result.allocationsPerOp = allocations / nOps;
+      result.glCallsPerOp = glCalls / nOps;
+      return result;
+    }
+    result.nIterations *= (time > 0.01 * minTime) ? 2 : 16;
+  }
+}
+
+
+/**
+ * \brief Exposes protected OBJ parser of MeshFactory.
+ */
+class OBJParser: public MeshFactory {
+
+public:
+
+  OBJParser(const std::string& filePath)
+      : MeshFactory(filePath) {
+  }
+
+  int parse(const std::string& fileName, int& nTriangles) const {
+    OBJModel model;
+    int error = loadOBJFile_(fileName, model);
+    nTriangles = model.nTriangles;
+    return error;
+  }
+
+};
+
+
+/**
+ * \brief Create tree of transformations with given depth and fanout.
+ */
+TransformationSP createTree(int depth, int fanout, int& nNodes) {
+  auto node = Transformation::create();
+  node->translate(glm::vec3(0.f, 0.f, 1.f));
+  ++nNodes;
+  if (depth > 1) {
+    for (int i = 0; i < fanout; ++i) {
+      node->addChild(createTree(depth - 1, fanout, nNodes));
+    }
+  }
+  return node;
+}
+
+
+/**
+ * \brief The main function.
+ */
+int main(int argc, char* argv[]) {
+
+  int result = 0;
+
+  try {
+    std::string filter;
+    double minTime = 0.5;
+    std::string modelPath = "../scg3/models;../../scg3/models";
+    for (int i = 1; i < argc; ++i) {
+      std::string arg(argv[i]);
+      if (arg.compare(0, 9, "--filter=") == 0) filter = arg.substr(9);
+      else if (arg.compare(0, 11, "--min-time=") == 0) minTime = std::atof(arg.c_str() + 11);
+      else if (arg.compare(0, 9, "--models=") == 0) modelPath = arg.substr(9);
+      else {
+        std::cout << "Usage: scg3_microbench [--filter=SUBSTRING] [--min-time=SECONDS]"
+            " [--models=PATH]" << std::endl;
+        return (arg == "--help") ? 0 : 1;
+      }
+    }
+
+    // replace OpenGL functions by null backend, no context required
+    NullGL::load();
+
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right << std::setw(14)
+        << "iterations" << std::setw(14) << "ns/op" << std::setw(14) << "allocs/op"
+        << std::setw(14) << "GL calls/op" << std::endl;
+    auto run = [&](const std::string& name, long nOpsPerIteration,
+        const std::function<void(long)>& operation) {
+      if (!filter.empty() && name.find(filter) == std::string::npos) {
+        return;
+      }
+      BenchResult benchResult = runBenchmark(operation, nOpsPerIteration, minTime);
+      std::cout << std::left << std::setw(40) << name << std::right << std::setw(14)
+          << benchResult.nIterations << std::fixed << std::setprecision(2) << std::setw(14)
+          << benchResult.nsPerOp << std::setw(14) << benchResult.allocationsPerOp
+          << std::setw(14) << benchResult.glCallsPerOp << std::endl;
+    };
+
+    // matrix stack
+    {
+      MatrixStack stack;
+      glm::mat4 matrix = glm::translate(glm::mat4(1.f), glm::vec3(1.f, 2.f, 3.f));
+      run("MatrixStack push/mult/pop", 1, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          stack.pushMatrix();
+          stack.multMatrix(matrix);
+          stack.popMatrix();
+        }
+      });
+      run("MatrixStack push/mult x16, pop x16", 16, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          for (int j = 0; j < 16; ++j) {
+            stack.pushMatrix();
+            stack.multMatrix(matrix);
+          }
+          for (int j = 0; j < 16; ++j) {
+            stack.popMatrix();
+          }
+        }
+      });
+    }
+
+    // traversal of wide and deep trees (per node)
+    {
+      RenderState renderState;
+      InfoTraverser traverser(&renderState);
+      int nNodes = 0;
+      auto wideTree = createTree(2, 10000, nNodes);
+      run("Composite::traverse wide (10001 nodes)", nNodes, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          traverser.clear();
+          wideTree->traverse(&traverser);
+        }
+      });
+      nNodes = 0;
+      auto deepTree = createTree(1000, 1, nNodes);
+      run("Composite::traverse deep (1000 nodes)", nNodes, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          traverser.clear();
+          deepTree->traverse(&traverser);
+        }
+      });
+      nNodes = 0;
+      auto balancedTree = createTree(5, 10, nNodes);
+      run("Composite::traverse 10^4 (11111 nodes)", nNodes, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          traverser.clear();
+          balancedTree->traverse(&traverser);
+        }
+      });
+    }
+
+    // adding children, i.e., Node::addSibling_(), which walks the sibling list (linear time
+    // per child, quadratic for all children), and removing them again as left child
+    // (constant time per child)
+    for (int nChildren : {10, 100, 1000}) {
+      auto group = Group::create();
+      std::vector<TransformationSP> children;
+      for (int i = 0; i < nChildren; ++i) {
+        children.push_back(Transformation::create());
+      }
+      run("Composite::addChild (" + std::to_string(nChildren) + " children)", nChildren,
+          [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          for (auto& child : children) {
+            group->addChild(child);
+          }
+          for (auto& child : children) {
+            group->removeChild(child.get());
+          }
+        }
+      });
+    }
+
+    // uniform location lookup (cached)
+    {
+      auto shaderCore = ShaderCore::create(glCreateProgram(), std::vector<ShaderID>());
+      const std::vector<std::string> names = {"modelViewMatrix", "projectionMatrix",
+          "mvpMatrix", "normalMatrix", "textureMatrix", "colorMatrix", "texture0", "nLights"};
+      for (auto& name : names) {
+        shaderCore->getUniformLoc(name);
+      }
+      GLint sum = 0;
+      run("ShaderCore::getUniformLoc", static_cast<long>(names.size()), [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          for (auto& name : names) {
+            sum += shaderCore->getUniformLoc(name);
+          }
+        }
+      });
+      resultSink = sum;
+    }
+
+    // OBJ parsing (per triangle)
+    {
+      OBJParser parser(modelPath);
+      int nTriangles = 0;
+      if (parser.parse("cessna.obj", nTriangles) == 0 && nTriangles > 0) {
+        run("loadOBJFile_ cessna.obj (per triangle)", nTriangles, [&](long n) {
+          for (long i = 0; i < n; ++i) {
+            parser.parse("cessna.obj", nTriangles);
+          }
+        });
+      }
+      else if (filter.empty() || std::string("loadOBJFile_").find(filter) != std::string::npos) {
+        std::cout << "loadOBJFile_: cessna.obj not found in " << modelPath << std::endl;
+      }
+    }
+
+    // geometry generation incl. (stubbed) upload (per core)
+    {
+      GeometryCoreFactory geometryFactory;
+      run("createSphere(1, 64, 32)", 1, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          geometryFactory.createSphere(1.f, 64, 32);
+        }
+      });
+      run("createTeapot(1)", 1, [&](long n) {
+        for (long i = 0; i < n; ++i) {
+          geometryFactory.createTeapot(1.f);
+        }
+      });
+    }
+  }
+  catch (const std::exception& exc) {
+    std::cerr << std::endl << "Exception: " << exc.what() << std::endl;
+    result = 1;
+  }
+  return result;
+}